@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+namespace bench {
+
+/// Stop the optimizer from discarding a value that is computed but not used
+template <typename T> inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Time fn, returning the best-of-five seconds per call
+ * @details Each of the five runs repeats fn until at least min_seconds have
+ * elapsed, so short functions are measured over many calls
+ */
+template <typename F>
+auto seconds_per_call(F&& fn, double min_seconds = 0.05) -> double {
+    using clock = std::chrono::steady_clock;
+    double best = 1e30;
+    for (int run = 0; run < 5; ++run) {
+        size_t calls = 0;
+        auto t0 = clock::now();
+        double elapsed = 0.0;
+        do {
+            fn();
+            ++calls;
+            elapsed = std::chrono::duration<double>(clock::now() - t0).count();
+        } while (elapsed < min_seconds);
+        best = std::min(best, elapsed / double(calls));
+    }
+    return best;
+}
+
+} // namespace bench
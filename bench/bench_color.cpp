@@ -0,0 +1,312 @@
+/*
+ * Throughput of the public API at the sizes it is used at: a single call,
+ * 1K and 1M items, and a 4K frame of pixels. Run with --json to get the
+ * results as JSON on stdout, for tracking across versions:
+ *
+ *     bench_color [--json] [--filter <substring>] [--min-time <seconds>]
+ */
+#include "bench.hpp"
+
+#include <color/color_space_rgb.hpp>
+#include <color/image_conversion.hpp>
+#include <color/parallel.hpp>
+#include <color/quantize.hpp>
+#include <color/simd.hpp>
+#include <color/spd_array.hpp>
+#include <color/spd_conversion.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(COLOR_VERSION)
+#define COLOR_VERSION "unknown"
+#endif
+
+using namespace color;
+
+namespace {
+struct Size {
+    const char* label;
+    size_t items;
+};
+
+// spectra are 41 samples each, so a 4K frame of them won't fit in memory
+const Size k_spectral_sizes[] = {{"single", 1}, {"1K", 1024}, {"1M", 1 << 20}};
+const Size k_pixel_sizes[] = {
+    {"single", 1}, {"1K", 1024}, {"1M", 1 << 20}, {"4K frame", 3840 * 2160}};
+
+struct Result {
+    std::string name;
+    const char* size;
+    size_t items;
+    double seconds;
+};
+
+class Suite {
+public:
+    Suite(std::string filter, double min_seconds)
+        : _filter(std::move(filter)), _min_seconds(min_seconds) {}
+
+    bool enabled(const std::string& name) const {
+        return name.find(_filter) != std::string::npos;
+    }
+
+    /// Time fn, which processes size.items items
+    template <typename F> void run(const std::string& name, Size size, F fn) {
+        if (!enabled(name)) {
+            return;
+        }
+        // small sizes are repeated within a timed call, so that reading the
+        // clock costs little next to them
+        const size_t reps = std::max(size_t(1), size_t(1024) / size.items);
+        const double seconds = bench::seconds_per_call(
+                                   [&]() {
+                                       for (size_t r = 0; r < reps; ++r) {
+                                           fn();
+                                       }
+                                   },
+                                   _min_seconds) /
+                               double(reps);
+        results.push_back({name, size.label, size.items, seconds});
+        if (_progress) {
+            print(results.back());
+        }
+    }
+
+    void print_header() {
+        _progress = true;
+        fmt::print("simd level {}, {} threads\n\n", to_string(simd_level()),
+                   num_threads());
+        fmt::print("{:<32} {:>9} {:>14} {:>14}\n", "benchmark", "size",
+                   "ns/call", "Mitems/s");
+    }
+
+    void print_json() const {
+        fmt::print("{{\n");
+        fmt::print("  \"library\": \"color\",\n");
+        fmt::print("  \"version\": \"{}\",\n", COLOR_VERSION);
+        fmt::print("  \"simd_level\": \"{}\",\n", to_string(simd_level()));
+        fmt::print("  \"threads\": {},\n", num_threads());
+        fmt::print("  \"benchmarks\": [");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            fmt::print("{}\n    {{\"name\": \"{}\", \"size\": \"{}\", "
+                       "\"items\": {}, \"seconds\": {:.6e}, "
+                       "\"items_per_second\": {:.6e}}}",
+                       i ? "," : "", r.name, r.size, r.items, r.seconds,
+                       double(r.items) / r.seconds);
+        }
+        fmt::print("\n  ]\n}}\n");
+    }
+
+    std::vector<Result> results;
+
+private:
+    static void print(const Result& r) {
+        fmt::print("{:<32} {:>9} {:>14.1f} {:>14.3f}\n", r.name, r.size,
+                   r.seconds * 1e9, double(r.items) / r.seconds * 1e-6);
+    }
+
+    std::string _filter;
+    double _min_seconds;
+    bool _progress = false;
+};
+
+// a smooth reflectance-like spectrum, different for each s
+void fill_spectrum(float* v, size_t n, size_t s) {
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = 0.5f + 0.4f * sinf(float(s % 97) * 0.1f + float(i) * 0.05f);
+    }
+}
+
+// colours covering [0, 1) in each channel, different for each pixel
+void fill_colours(std::vector<RGBf32>& c) {
+    for (size_t i = 0; i < c.size(); ++i) {
+        c[i] = RGBf32(float(i % 1021) / 1021.0f, float(i % 509) / 509.0f,
+                      float(i % 251) / 251.0f);
+    }
+}
+
+void bench_spectral(Suite& suite) {
+    const auto& cs = ColorSpaceRGB::ITUR_sRGB;
+    const CMF& cmf = cs.cmf;
+    const size_t max_items = 1 << 20;
+
+    // reflectances over 380-780nm at 10nm
+    SPDArray spectra(max_items, 380.0f, 790.0f, 10.0f);
+    for (size_t s = 0; s < spectra.size(); ++s) {
+        fill_spectrum(spectra[s], spectra.num_samples(), s);
+    }
+    // D65 resampled onto the same grid
+    SPD d65(380.0f, 790.0f, 10.0f);
+    d65.interpolate_from(Illuminant::D65);
+
+    std::vector<float> lambdas(max_items);
+    for (size_t i = 0; i < max_items; ++i) {
+        lambdas[i] = 380.0f + float(i % 4001) * 0.1f;
+    }
+    std::vector<XYZ> xyz(max_items);
+    std::vector<RGBf32> rgb(max_items);
+
+    for (const Size& size : k_spectral_sizes) {
+        const size_t n = size.items;
+        suite.run("SPD::value", size, [&]() {
+            float sum = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                sum += d65.value(lambdas[i]);
+            }
+            bench::do_not_optimize(sum);
+        });
+
+        // D65 at 5nm onto the 10nm grid, once per item
+        suite.run("SPD::interpolate_from", size, [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                d65.interpolate_from(Illuminant::D65);
+            }
+            bench::do_not_optimize(d65);
+        });
+
+        suite.run("spd_to_xyz/spectrum", size, [&]() {
+            for (size_t s = 0; s < n; ++s) {
+                xyz[s] = spd_to_xyz(spectra.view(s), cmf);
+            }
+            bench::do_not_optimize(xyz[0]);
+        });
+
+        suite.run("spd_to_rgb/spectrum", size, [&]() {
+            for (size_t s = 0; s < n; ++s) {
+                rgb[s] = spd_to_rgb(spectra.view(s), cs);
+            }
+            bench::do_not_optimize(rgb[0]);
+        });
+
+        if (suite.enabled("spd_to_xyz/batch") ||
+            suite.enabled("spd_to_rgb/batch")) {
+            // the batch functions take whole arrays
+            SPDArray batch(n, 380.0f, 790.0f, 10.0f);
+            for (size_t s = 0; s < n; ++s) {
+                std::memcpy(batch[s], spectra[s],
+                            sizeof(float) * spectra.num_samples());
+            }
+            suite.run("spd_to_xyz/batch", size, [&]() {
+                spd_to_xyz(batch, cmf, xyz.data());
+                bench::do_not_optimize(xyz[0]);
+            });
+            suite.run("spd_to_rgb/batch", size, [&]() {
+                spd_to_rgb(batch, cs, rgb.data());
+                bench::do_not_optimize(rgb[0]);
+            });
+        }
+    }
+}
+
+void bench_pixels(Suite& suite) {
+    const auto& cs = ColorSpaceRGB::ITUR_sRGB;
+    const size_t max_items = 3840 * 2160;
+
+    std::vector<RGBf32> src(max_items), dst(max_items);
+    fill_colours(src);
+    std::vector<RGBu8> u8s(max_items);
+    std::vector<f32> values(3 * max_items);
+
+    const TransferFunction oetf(OETF::sRGB), eotf(EOTF::sRGB);
+    const struct {
+        const char* name;
+        const TransferFunction& tf;
+        Accuracy accuracy;
+    } transfers[] = {{"transfer/sRGB_OETF", oetf, Accuracy::Exact},
+                     {"transfer/sRGB_OETF/U16", oetf, Accuracy::U16},
+                     {"transfer/sRGB_OETF/U8", oetf, Accuracy::U8},
+                     {"transfer/sRGB_EOTF", eotf, Accuracy::Exact},
+                     {"transfer/sRGB_EOTF/U16", eotf, Accuracy::U16}};
+
+    for (const Size& size : k_pixel_sizes) {
+        const size_t n = size.items;
+        // a single row, so the image functions see n pixels however many
+        // there are
+        const auto src_image = ImageView<f32>::interleaved(&src[0].r, n, 1);
+        const auto dst_image = ImageView<f32>::interleaved(&dst[0].r, n, 1);
+
+        suite.run("xyz_to_rgb/pixel", size, [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = xyz_to_rgb(XYZ(src[i].r, src[i].g, src[i].b), cs);
+            }
+            bench::do_not_optimize(dst[0]);
+        });
+
+        suite.run("xyz_to_rgb/image", size, [&]() {
+            xyz_to_rgb(src_image, dst_image, cs);
+            bench::do_not_optimize(dst[0]);
+        });
+
+        suite.run("rgb_to_xyz/pixel", size, [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                XYZ x = rgb_to_xyz(src[i], cs);
+                dst[i] = RGBf32(x.x, x.y, x.z);
+            }
+            bench::do_not_optimize(dst[0]);
+        });
+
+        suite.run("rgb_to_xyz/image", size, [&]() {
+            rgb_to_xyz(src_image, dst_image, cs);
+            bench::do_not_optimize(dst[0]);
+        });
+
+        // channel values, converted in place from a fresh copy each call
+        for (const auto& t : transfers) {
+            suite.run(t.name, size, [&]() {
+                std::memcpy(values.data(), &src[0].r, sizeof(f32) * 3 * n);
+                t.tf.apply(values.data(), 3 * n, t.accuracy);
+                bench::do_not_optimize(values[0]);
+            });
+        }
+
+        suite.run("rgb_cast/u8", size, [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                u8s[i] = rgb_cast<u8>(src[i]);
+            }
+            bench::do_not_optimize(u8s[0]);
+        });
+
+        suite.run("quantize/u8", size, [&]() {
+            quantize(src.data(), u8s.data(), n);
+            bench::do_not_optimize(u8s[0]);
+        });
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    bool json = false;
+    std::string filter;
+    double min_seconds = 0.05;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_seconds = atof(argv[++i]);
+        } else {
+            fmt::print(stderr,
+                       "usage: {} [--json] [--filter <substring>] "
+                       "[--min-time <seconds>]\n",
+                       argv[0]);
+            return 1;
+        }
+    }
+
+    Suite suite(filter, min_seconds);
+    if (!json) {
+        suite.print_header();
+    }
+    bench_spectral(suite);
+    bench_pixels(suite);
+    if (json) {
+        suite.print_json();
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "bench.hpp"
+
+#include <color/lut3d.hpp>
+
+#include <vector>
+
+using namespace color;
+
+int main() {
+    // BT.709 to sRGB primaries under a D50 white, so that there is a full
+    // 3x3 matrix between the two transfer functions
+    const auto& bt709 = ColorSpaceRGB::ITUR_BT709;
+    const ColorSpaceRGB srgb_d50("sRGB (D50)",
+                                 ColorSpaceRGB::Primaries::itur_bt709,
+                                 ColorSpaceRGB::WhitePoint::D50, OETF::sRGB,
+                                 EOTF::sRGB);
+    Pipeline p;
+    p.convert(ColorSpaceConversion(bt709, srgb_d50,
+                                   ChromaticAdaptation::Bradford));
+
+    fmt::print("{:>6} {:>10} {:>12} {:>12} {:>12}\n", "size", "bytes",
+               "kernel", "max error", "mean error");
+    for (const auto& a : lut_accuracy_report(p, {9, 17, 33, 65})) {
+        fmt::print("{:>6} {:>10} {:>12} {:>12.3e} {:>12.3e}\n", a.size,
+                   a.bytes,
+                   a.interpolation == LutInterpolation::Trilinear
+                       ? "trilinear"
+                       : "tetrahedral",
+                   a.max_error, a.mean_error);
+    }
+
+    // a 1080p frame
+    const size_t width = 1920, height = 1080;
+    std::vector<f32> image(width * height * 3);
+    for (size_t i = 0; i < image.size(); ++i) {
+        image[i] = f32(i % 1021) / 1020.0f;
+    }
+    auto view = ImageView<f32>::interleaved(image.data(), width, height);
+
+    const double pixels = double(width * height);
+    double t = bench::seconds_per_call([&]() { p.apply(view, view); }, 0.2);
+    fmt::print("\n{:<28} {:>12.3f} Mpixels/s\n", "exact pipeline",
+               pixels / t * 1e-6);
+
+    Lut3D lut(p, 33);
+    for (auto interpolation :
+         {LutInterpolation::Trilinear, LutInterpolation::Tetrahedral}) {
+        t = bench::seconds_per_call(
+            [&]() { lut.apply(view, view, interpolation); }, 0.2);
+        fmt::print("{:<28} {:>12.3f} Mpixels/s\n",
+                   interpolation == LutInterpolation::Trilinear
+                       ? "33^3 lut, trilinear"
+                       : "33^3 lut, tetrahedral",
+                   pixels / t * 1e-6);
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "bench.hpp"
+
+#include <color/spectral_power_distribution.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace color;
+
+namespace {
+// The nested scan SPD::interpolate_from used before the resampling engine:
+// the search for the bracketing source samples restarts from the first
+// wavelength for every output sample
+void legacy_interpolate(const std::vector<float>& src_w,
+                        const std::vector<float>& src_v,
+                        const std::vector<float>& dst_w,
+                        std::vector<float>& dst_v) {
+    for (size_t i = 0; i < dst_w.size(); ++i) {
+        size_t j1 = 0;
+        while (j1 < src_w.size() - 1 && src_w[j1] < dst_w[i])
+            ++j1;
+        size_t j0 = j1 > 0 ? j1 - 1 : 0;
+        float t = j1 > j0 ? (dst_w[i] - src_w[j0]) / (src_w[j1] - src_w[j0])
+                          : 0.0f;
+        dst_v[i] = lerp(src_v[j0], src_v[j1], t);
+    }
+}
+} // namespace
+
+int main() {
+    fmt::print("{:>8} {:>8} {:>14} {:>14} {:>14} {:>14} {:>9}\n", "src",
+               "dst", "legacy (us)", "merge (us)", "uniform (us)", "plan (us)",
+               "speedup");
+
+    for (size_t n = 64; n <= 16384; n *= 4) {
+        // an irregular source grid over 360-830nm so the merge walk is used,
+        // and a uniform one over the same range for the direct-index path
+        std::vector<float> w(n), v(n);
+        for (size_t i = 0; i < n; ++i) {
+            float t = float(i) / float(n - 1);
+            w[i] = 360.0f + 470.0f * (t + 0.02f * t * (1.0f - t));
+            v[i] = 1.0f + sinf(w[i] * 0.05f);
+        }
+        SPD irregular(w, v);
+        SPD uniform(360.0f, 830.0f, 470.0f / float(n), std::vector<float>(v));
+
+        // resample onto a grid with half the number of samples
+        size_t m = n / 2;
+        SPD dst(400.0f, 700.0f, 300.0f / float(m));
+        std::vector<float> dst_w(dst.num_samples()), dst_v(dst.num_samples());
+        for (size_t i = 0; i < dst_w.size(); ++i) {
+            dst_w[i] = dst.grid()[i];
+        }
+
+        double t_legacy = bench::seconds_per_call([&]() {
+            legacy_interpolate(w, v, dst_w, dst_v);
+            bench::do_not_optimize(dst_v[0]);
+        });
+        double t_merge = bench::seconds_per_call([&]() {
+            dst.interpolate_from(irregular);
+            bench::do_not_optimize(dst.value(500.0f));
+        });
+        double t_uniform = bench::seconds_per_call([&]() {
+            dst.interpolate_from(uniform);
+            bench::do_not_optimize(dst.value(500.0f));
+        });
+
+        // the same resampling with the bracketing precomputed once
+        ResamplePlan plan(irregular.grid(), dst.grid());
+        double t_plan = bench::seconds_per_call([&]() {
+            plan.apply(v.data(), dst_v.data());
+            bench::do_not_optimize(dst_v[0]);
+        });
+
+        fmt::print(
+            "{:>8} {:>8} {:>14.2f} {:>14.2f} {:>14.2f} {:>14.2f} {:>8.1f}x\n",
+            n, dst.num_samples(), t_legacy * 1e6, t_merge * 1e6,
+            t_uniform * 1e6, t_plan * 1e6, t_legacy / t_merge);
+    }
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "bench.hpp"
+
+#include <color/parallel.hpp>
+#include <color/spd_conversion.hpp>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace color;
+
+int main() {
+    // a reflectance database's worth of smooth spectra over 380-780nm at 5nm
+    const size_t count = 100000;
+    SPDArray spectra(count, 380.0f, 785.0f, 5.0f);
+    for (size_t s = 0; s < count; ++s) {
+        float* v = spectra[s];
+        for (size_t i = 0; i < spectra.num_samples(); ++i) {
+            v[i] = 0.5f + 0.4f * sinf(float(s % 97) * 0.1f + float(i) * 0.05f);
+        }
+    }
+
+    const auto& cs = ColorSpaceRGB::ITUR_sRGB;
+    std::vector<RGBf32> rgb(count);
+
+    double t_single = bench::seconds_per_call([&]() {
+        for (size_t s = 0; s < count; ++s) {
+            rgb[s] = spd_to_rgb(spectra.view(s), cs);
+        }
+        bench::do_not_optimize(rgb[0]);
+    }, 0.2);
+    fmt::print("{:<28} {:>12.3f} Mspectra/s\n", "spd_to_rgb per spectrum",
+               count / t_single * 1e-6);
+
+    int hw = std::max(1, int(std::thread::hardware_concurrency()));
+    for (int threads : {1, 4, hw}) {
+        set_num_threads(threads);
+        double t = bench::seconds_per_call([&]() {
+            spd_to_rgb(spectra, cs, rgb.data());
+            bench::do_not_optimize(rgb[0]);
+        }, 0.2);
+        fmt::print("{:<28} {:>12.3f} Mspectra/s\n",
+                   fmt::format("spd_to_rgb batch, {} threads", threads),
+                   count / t * 1e-6);
+    }
+
+    return 0;
+}
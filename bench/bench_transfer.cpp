@@ -0,0 +1,102 @@
+#include "bench.hpp"
+
+#include <color/quantize.hpp>
+#include <color/simd.hpp>
+#include <color/transfer_function.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace color;
+
+int main() {
+    // small enough to stay in cache, so that the copy back to the source
+    // values between runs costs little next to the curves
+    const size_t n = 16384;
+    std::vector<f32> src(n);
+    for (size_t i = 0; i < n; ++i) {
+        src[i] = f32(i % 4093) / 4092.0f;
+    }
+    std::vector<f32> v(n);
+
+    using Curve = TransferFunction::Curve;
+    const struct {
+        const char* name;
+        Curve curve;
+    } curves[] = {{"sRGB OETF", Curve::sRGB_OETF},
+                  {"sRGB EOTF", Curve::sRGB_EOTF},
+                  {"Rec.709 OETF", Curve::Rec709_OETF},
+                  {"Rec.709 EOTF", Curve::Rec709_EOTF}};
+    const struct {
+        const char* name;
+        Accuracy accuracy;
+    } tiers[] = {{"powf", Accuracy::Exact},
+                 {"U16", Accuracy::U16},
+                 {"U8", Accuracy::U8}};
+
+    // COLOR_SIMD_LEVEL compares levels
+    fmt::print("simd level: {}\n\n", to_string(simd_level()));
+    fmt::print("{:<14} {:>8} {:>14} {:>12}\n", "curve", "accuracy",
+               "Mvalues/s", "max error");
+    for (const auto& c : curves) {
+        TransferFunction tf(c.curve);
+        std::vector<f32> exact = src;
+        tf.apply(exact.data(), n);
+        for (const auto& t : tiers) {
+            double s = bench::seconds_per_call([&]() {
+                v = src;
+                tf.apply(v.data(), n, t.accuracy);
+                bench::do_not_optimize(v[0]);
+            }, 0.2);
+            float err = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                err = std::max(err, std::abs(v[i] - exact[i]));
+            }
+            fmt::print("{:<14} {:>8} {:>14.1f} {:>12.3e}\n", c.name, t.name,
+                       n / s * 1e-6, err);
+        }
+    }
+
+    // quantizing to 8 bits, per colour with rgb_cast() against the packed
+    // vector loop
+    const size_t num_colours = n / 3;
+    const RGBf32* colours = reinterpret_cast<const RGBf32*>(src.data());
+    std::vector<RGBu8> q(num_colours);
+    double s_cast = bench::seconds_per_call([&]() {
+        for (size_t i = 0; i < num_colours; ++i) {
+            q[i] = rgb_cast<u8>(colours[i]);
+        }
+        bench::do_not_optimize(q[0]);
+    }, 0.2);
+    double s_quantize = bench::seconds_per_call([&]() {
+        quantize(colours, q.data(), num_colours);
+        bench::do_not_optimize(q[0]);
+    }, 0.2);
+    fmt::print("\n{:<14} {:>14}\n", "f32 -> u8", "Mvalues/s");
+    fmt::print("{:<14} {:>14.1f}\n", "rgb_cast",
+               3 * num_colours / s_cast * 1e-6);
+    fmt::print("{:<14} {:>14.1f}\n", "quantize",
+               3 * num_colours / s_quantize * 1e-6);
+
+    // dithering is fused into the quantize loop, so should cost little
+    const size_t width = 91, height = num_colours / width;
+    const struct {
+        const char* name;
+        Dither dither;
+    } dithers[] = {{"no dither", Dither::None},
+                   {"ordered", Dither::Ordered},
+                   {"blue noise", Dither::BlueNoise}};
+    for (const auto& d : dithers) {
+        // build the mask outside the timing
+        dither_mask(d.dither);
+        double s = bench::seconds_per_call([&]() {
+            quantize(colours, q.data(), width, height, d.dither);
+            bench::do_not_optimize(q[0]);
+        }, 0.2);
+        fmt::print("{:<14} {:>14.1f}\n", d.name,
+                   3 * width * height / s * 1e-6);
+    }
+
+    return 0;
+}
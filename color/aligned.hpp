@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace color {
+
+/// Alignment in bytes of buffers used by batch kernels. Wide enough for a
+/// cache line or an AVX-512 register
+constexpr size_t simd_alignment = 64;
+
+/// std::allocator replacement returning storage aligned to Alignment bytes
+template <typename T, size_t Alignment = simd_alignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U> struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(size_t n) {
+        void* p = nullptr;
+        if (posix_memalign(&p, Alignment, n * sizeof(T)) != 0) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) { free(p); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const {
+        return false;
+    }
+};
+
+template <typename T> using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+} // namespace color
@@ -0,0 +1,101 @@
+#include "color/chromatic_adaptation.hpp"
+
+namespace color {
+
+namespace {
+using M33 = double[3][3];
+
+// cone response matrices, taking XYZ to LMS
+const M33 k_von_kries = {{0.40024, 0.70760, -0.08081},
+                         {-0.22630, 1.16532, 0.04570},
+                         {0.0, 0.0, 0.91822}};
+const M33 k_bradford = {{0.8951, 0.2664, -0.1614},
+                        {-0.7502, 1.7135, 0.0367},
+                        {0.0389, -0.0685, 1.0296}};
+const M33 k_cat02 = {{0.7328, 0.4296, -0.1624},
+                     {-0.7036, 1.6975, 0.0061},
+                     {0.0030, 0.0136, 0.9834}};
+const M33 k_cat16 = {{0.401288, 0.650173, -0.051461},
+                     {-0.250268, 1.204414, 0.045854},
+                     {-0.002079, 0.048952, 0.953127}};
+
+void multiply(const M33& a, const M33& b, M33& out) {
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            out[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] +
+                        a[i][2] * b[2][j];
+        }
+    }
+}
+
+void invert(const M33& m, M33& out) {
+    double det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+                 m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+                 m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    out[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) / det;
+    out[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) / det;
+    out[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / det;
+    out[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) / det;
+    out[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / det;
+    out[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) / det;
+    out[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) / det;
+    out[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) / det;
+    out[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / det;
+}
+
+auto cone_response(ChromaticAdaptation method) -> const M33& {
+    switch (method) {
+    case ChromaticAdaptation::VonKries:
+        return k_von_kries;
+    case ChromaticAdaptation::CAT02:
+        return k_cat02;
+    case ChromaticAdaptation::CAT16:
+        return k_cat16;
+    case ChromaticAdaptation::Bradford:
+    default:
+        return k_bradford;
+    }
+}
+} // namespace
+
+auto xy_to_xyz(V2f xy) -> XYZ {
+    return XYZ(xy.x / xy.y, 1.0f, (1.0f - xy.x - xy.y) / xy.y);
+}
+
+auto chromatic_adaptation_matrix(V2f src_white, V2f dst_white,
+                                 ChromaticAdaptation method) -> M33f {
+    if (method == ChromaticAdaptation::None ||
+        (src_white.x == dst_white.x && src_white.y == dst_white.y)) {
+        return M33f();
+    }
+
+    const M33& m = cone_response(method);
+    double ws[3] = {src_white.x / src_white.y, 1.0,
+                    (1.0 - src_white.x - src_white.y) / src_white.y};
+    double wd[3] = {dst_white.x / dst_white.y, 1.0,
+                    (1.0 - dst_white.x - dst_white.y) / dst_white.y};
+
+    // scale each cone response by the ratio of the whites' responses
+    M33 scaled;
+    for (int i = 0; i < 3; ++i) {
+        double s = m[i][0] * ws[0] + m[i][1] * ws[1] + m[i][2] * ws[2];
+        double d = m[i][0] * wd[0] + m[i][1] * wd[1] + m[i][2] * wd[2];
+        for (int j = 0; j < 3; ++j) {
+            scaled[i][j] = m[i][j] * d / s;
+        }
+    }
+
+    M33 m_inv, adapt;
+    invert(m, m_inv);
+    multiply(m_inv, scaled, adapt);
+
+    M33f result;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            result[i][j] = float(adapt[i][j]);
+        }
+    }
+    return result;
+}
+
+} // namespace color
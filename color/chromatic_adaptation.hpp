@@ -0,0 +1,32 @@
+#pragma once
+
+#include "color/types.hpp"
+
+namespace color {
+
+/// Methods of adapting XYZ values from one white point to another
+enum class ChromaticAdaptation : int {
+    /// No adaptation, XYZ values are used as-is
+    None = 0,
+    /// von Kries scaling of Hunt-Pointer-Estevez cone responses
+    VonKries,
+    Bradford,
+    /// The transform from CIECAM02
+    CAT02,
+    /// The transform from CAM16
+    CAT16
+};
+
+/// XYZ with Y = 1 of the colour with chromaticity xy
+auto xy_to_xyz(V2f xy) -> XYZ;
+
+/**
+ * @brief Matrix taking XYZ under src_white to XYZ under dst_white
+ * @details The whites are given as chromaticities. Matrices are computed in
+ * double precision. Cheap enough to call per conversion, and
+ * ColorSpaceConversion keeps the matrices it builds
+ */
+auto chromatic_adaptation_matrix(V2f src_white, V2f dst_white,
+                                 ChromaticAdaptation method) -> M33f;
+
+} // namespace color
@@ -1,7 +1,1409 @@
 #include "color/cmf.hpp"
+#include "color/registry.hpp"
 
 namespace color {
 
+namespace {
+// tabulated at 1nm, in read-only data referenced by the SPDs below
+constexpr float k_cie_1931_2_x[] = {
+    0.000129900000, 0.000145847000, 0.000163802100, 0.000184003700,
+    0.000206690200, 0.000232100000, 0.000260728000, 0.000293075000,
+    0.000329388000, 0.000369914000, 0.000414900000, 0.000464158700,
+    0.000518986000, 0.000581854000, 0.000655234700, 0.000741600000,
+    0.000845029600, 0.000964526800, 0.001094949000, 0.001231154000,
+    0.001368000000, 0.001502050000, 0.001642328000, 0.001802382000,
+    0.001995757000, 0.002236000000, 0.002535385000, 0.002892603000,
+    0.003300829000, 0.003753236000, 0.004243000000, 0.004762389000,
+    0.005330048000, 0.005978712000, 0.006741117000, 0.007650000000,
+    0.008751373000, 0.010028880000, 0.011421700000, 0.012869010000,
+    0.014310000000, 0.015704430000, 0.017147440000, 0.018781220000,
+    0.020748010000, 0.023190000000, 0.026207360000, 0.029782480000,
+    0.033880920000, 0.038468240000, 0.043510000000, 0.048995600000,
+    0.055022600000, 0.061718800000, 0.069212000000, 0.077630000000,
+    0.086958110000, 0.097176720000, 0.108406300000, 0.120767200000,
+    0.134380000000, 0.149358200000, 0.165395700000, 0.181983100000,
+    0.198611000000, 0.214770000000, 0.230186800000, 0.244879700000,
+    0.258777300000, 0.271807900000, 0.283900000000, 0.294943800000,
+    0.304896500000, 0.313787300000, 0.321645400000, 0.328500000000,
+    0.334351300000, 0.339210100000, 0.343121300000, 0.346129600000,
+    0.348280000000, 0.349599900000, 0.350147400000, 0.350013000000,
+    0.349287000000, 0.348060000000, 0.346373300000, 0.344262400000,
+    0.341808800000, 0.339094100000, 0.336200000000, 0.333197700000,
+    0.330041100000, 0.326635700000, 0.322886800000, 0.318700000000,
+    0.314025100000, 0.308884000000, 0.303290400000, 0.297257900000,
+    0.290800000000, 0.283970100000, 0.276721400000, 0.268917800000,
+    0.260422700000, 0.251100000000, 0.240847500000, 0.229851200000,
+    0.218407200000, 0.206811500000, 0.195360000000, 0.184213600000,
+    0.173327300000, 0.162688100000, 0.152283300000, 0.142100000000,
+    0.132178600000, 0.122569600000, 0.113275200000, 0.104297900000,
+    0.095640000000, 0.087299550000, 0.079308040000, 0.071717760000,
+    0.064580990000, 0.057950010000, 0.051862110000, 0.046281520000,
+    0.041150880000, 0.036412830000, 0.032010000000, 0.027917200000,
+    0.024144400000, 0.020687000000, 0.017540400000, 0.014700000000,
+    0.012161790000, 0.009919960000, 0.007967240000, 0.006296346000,
+    0.004900000000, 0.003777173000, 0.002945320000, 0.002424880000,
+    0.002236293000, 0.002400000000, 0.002925520000, 0.003836560000,
+    0.005174840000, 0.006982080000, 0.009300000000, 0.012149490000,
+    0.015535880000, 0.019477520000, 0.023992770000, 0.029100000000,
+    0.034814850000, 0.041120160000, 0.047985040000, 0.055378610000,
+    0.063270000000, 0.071635010000, 0.080462240000, 0.089739960000,
+    0.099456450000, 0.109600000000, 0.120167400000, 0.131114500000,
+    0.142367900000, 0.153854200000, 0.165500000000, 0.177257100000,
+    0.189140000000, 0.201169400000, 0.213365800000, 0.225749900000,
+    0.238320900000, 0.251066800000, 0.263992200000, 0.277101700000,
+    0.290400000000, 0.303891200000, 0.317572600000, 0.331438400000,
+    0.345482800000, 0.359700000000, 0.374083900000, 0.388639600000,
+    0.403378400000, 0.418311500000, 0.433449900000, 0.448795300000,
+    0.464336000000, 0.480064000000, 0.495971300000, 0.512050100000,
+    0.528295900000, 0.544691600000, 0.561209400000, 0.577821500000,
+    0.594500000000, 0.611220900000, 0.627975800000, 0.644760200000,
+    0.661569700000, 0.678400000000, 0.695239200000, 0.712058600000,
+    0.728828400000, 0.745518800000, 0.762100000000, 0.778543200000,
+    0.794825600000, 0.810926400000, 0.826824800000, 0.842500000000,
+    0.857932500000, 0.873081600000, 0.887894400000, 0.902318100000,
+    0.916300000000, 0.929799500000, 0.942798400000, 0.955277600000,
+    0.967217900000, 0.978600000000, 0.989385600000, 0.999548800000,
+    1.009089200000, 1.018006400000, 1.026300000000, 1.033982700000,
+    1.040986000000, 1.047188000000, 1.052466700000, 1.056700000000,
+    1.059794400000, 1.061799200000, 1.062806800000, 1.062909600000,
+    1.062200000000, 1.060735200000, 1.058443600000, 1.055224400000,
+    1.050976800000, 1.045600000000, 1.039036900000, 1.031360800000,
+    1.022666200000, 1.013047700000, 1.002600000000, 0.991367500000,
+    0.979331400000, 0.966491600000, 0.952847900000, 0.938400000000,
+    0.923194000000, 0.907244000000, 0.890502000000, 0.872920000000,
+    0.854449900000, 0.835084000000, 0.814946000000, 0.794186000000,
+    0.772954000000, 0.751400000000, 0.729583600000, 0.707588800000,
+    0.685602200000, 0.663810400000, 0.642400000000, 0.621514900000,
+    0.601113800000, 0.581105200000, 0.561397700000, 0.541900000000,
+    0.522599500000, 0.503546400000, 0.484743600000, 0.466193900000,
+    0.447900000000, 0.429861300000, 0.412098000000, 0.394644000000,
+    0.377533300000, 0.360800000000, 0.344456300000, 0.328516800000,
+    0.313019200000, 0.298001100000, 0.283500000000, 0.269544800000,
+    0.256118400000, 0.243189600000, 0.230727200000, 0.218700000000,
+    0.207097100000, 0.195923200000, 0.185170800000, 0.174832300000,
+    0.164900000000, 0.155366700000, 0.146230000000, 0.137490000000,
+    0.129146700000, 0.121200000000, 0.113639700000, 0.106465000000,
+    0.099690440000, 0.093330610000, 0.087400000000, 0.081900960000,
+    0.076804280000, 0.072077120000, 0.067686640000, 0.063600000000,
+    0.059806850000, 0.056282160000, 0.052971040000, 0.049818610000,
+    0.046770000000, 0.043784050000, 0.040875360000, 0.038072640000,
+    0.035404610000, 0.032900000000, 0.030564190000, 0.028380560000,
+    0.026344840000, 0.024452750000, 0.022700000000, 0.021084290000,
+    0.019599880000, 0.018237320000, 0.016987170000, 0.015840000000,
+    0.014790640000, 0.013831320000, 0.012948680000, 0.012129200000,
+    0.011359160000, 0.010629350000, 0.009938846000, 0.009288422000,
+    0.008678854000, 0.008110916000, 0.007582388000, 0.007088746000,
+    0.006627313000, 0.006195408000, 0.005790346000, 0.005409826000,
+    0.005052583000, 0.004717512000, 0.004403507000, 0.004109457000,
+    0.003833913000, 0.003575748000, 0.003334342000, 0.003109075000,
+    0.002899327000, 0.002704348000, 0.002523020000, 0.002354168000,
+    0.002196616000, 0.002049190000, 0.001910960000, 0.001781438000,
+    0.001660110000, 0.001546459000, 0.001439971000, 0.001340042000,
+    0.001246275000, 0.001158471000, 0.001076430000, 0.000999949300,
+    0.000928735800, 0.000862433200, 0.000800750300, 0.000743396000,
+    0.000690078600, 0.000640515600, 0.000594502100, 0.000551864600,
+    0.000512429000, 0.000476021300, 0.000442453600, 0.000411511700,
+    0.000382981400, 0.000356649100, 0.000332301100, 0.000309758600,
+    0.000288887100, 0.000269539400, 0.000251568200, 0.000234826100,
+    0.000219171000, 0.000204525800, 0.000190840500, 0.000178065400,
+    0.000166150500, 0.000155023600, 0.000144621900, 0.000134909800,
+    0.000125852000, 0.000117413000, 0.000109551500, 0.000102224500,
+    0.000095394450, 0.000089023900, 0.000083075270, 0.000077512690,
+    0.000072313040, 0.000067457780, 0.000062928440, 0.000058706520,
+    0.000054770280, 0.000051099180, 0.000047676540, 0.000044485670,
+    0.000041509940, 0.000038733240, 0.000036142030, 0.000033723520,
+    0.000031464870, 0.000029353260, 0.000027375730, 0.000025524330,
+    0.000023793760, 0.000022178700, 0.000020673830, 0.000019272260,
+    0.000017966400, 0.000016749910, 0.000015616480, 0.000014559770,
+    0.000013573870, 0.000012654360, 0.000011797230, 0.000010998440,
+    0.000010253980, 0.000009559646, 0.000008912044, 0.000008308358,
+    0.000007745769, 0.000007221456, 0.000006732475, 0.000006276423,
+    0.000005851304, 0.000005455118, 0.000005085868, 0.000004741466,
+    0.000004420236, 0.000004120783, 0.000003841716, 0.000003581652,
+    0.000003339127, 0.000003112949, 0.000002902121, 0.000002705645,
+    0.000002522525, 0.000002351726, 0.000002192415, 0.000002043902,
+    0.000001905497, 0.000001776509, 0.000001656215, 0.000001544022,
+    0.000001439440, 0.000001341977, 0.000001251141};
+
+constexpr float k_cie_1931_2_y[] = {
+    0.000003917000, 0.000004393581, 0.000004929604, 0.000005532136,
+    0.000006208245, 0.000006965000, 0.000007813219, 0.000008767336,
+    0.000009839844, 0.000011043230, 0.000012390000, 0.000013886410,
+    0.000015557280, 0.000017442960, 0.000019583750, 0.000022020000,
+    0.000024839650, 0.000028041260, 0.000031531040, 0.000035215210,
+    0.000039000000, 0.000042826400, 0.000046914600, 0.000051589600,
+    0.000057176400, 0.000064000000, 0.000072344210, 0.000082212240,
+    0.000093508160, 0.000106136100, 0.000120000000, 0.000134984000,
+    0.000151492000, 0.000170208000, 0.000191816000, 0.000217000000,
+    0.000246906700, 0.000281240000, 0.000318520000, 0.000357266700,
+    0.000396000000, 0.000433714700, 0.000473024000, 0.000517876000,
+    0.000572218700, 0.000640000000, 0.000724560000, 0.000825500000,
+    0.000941160000, 0.001069880000, 0.001210000000, 0.001362091000,
+    0.001530752000, 0.001720368000, 0.001935323000, 0.002180000000,
+    0.002454800000, 0.002764000000, 0.003117800000, 0.003526400000,
+    0.004000000000, 0.004546240000, 0.005159320000, 0.005829280000,
+    0.006546160000, 0.007300000000, 0.008086507000, 0.008908720000,
+    0.009767680000, 0.010664430000, 0.011600000000, 0.012573170000,
+    0.013582720000, 0.014629680000, 0.015715090000, 0.016840000000,
+    0.018007360000, 0.019214480000, 0.020453920000, 0.021718240000,
+    0.023000000000, 0.024294610000, 0.025610240000, 0.026958570000,
+    0.028351250000, 0.029800000000, 0.031310830000, 0.032883680000,
+    0.034521120000, 0.036225710000, 0.038000000000, 0.039846670000,
+    0.041768000000, 0.043766000000, 0.045842670000, 0.048000000000,
+    0.050243680000, 0.052573040000, 0.054980560000, 0.057458720000,
+    0.060000000000, 0.062601970000, 0.065277520000, 0.068042080000,
+    0.070911090000, 0.073900000000, 0.077016000000, 0.080266400000,
+    0.083666800000, 0.087232800000, 0.090980000000, 0.094917550000,
+    0.099045840000, 0.103367400000, 0.107884600000, 0.112600000000,
+    0.117532000000, 0.122674400000, 0.127992800000, 0.133452800000,
+    0.139020000000, 0.144676400000, 0.150469300000, 0.156461900000,
+    0.162717700000, 0.169300000000, 0.176243100000, 0.183558100000,
+    0.191273500000, 0.199418000000, 0.208020000000, 0.217119900000,
+    0.226734500000, 0.236857100000, 0.247481200000, 0.258600000000,
+    0.270184900000, 0.282293900000, 0.295050500000, 0.308578000000,
+    0.323000000000, 0.338402100000, 0.354685800000, 0.371698600000,
+    0.389287500000, 0.407300000000, 0.425629900000, 0.444309600000,
+    0.463394400000, 0.482939500000, 0.503000000000, 0.523569300000,
+    0.544512000000, 0.565690000000, 0.586965300000, 0.608200000000,
+    0.629345600000, 0.650306800000, 0.670875200000, 0.690842400000,
+    0.710000000000, 0.728185200000, 0.745463600000, 0.761969400000,
+    0.777836800000, 0.793200000000, 0.808110400000, 0.822496200000,
+    0.836306800000, 0.849491600000, 0.862000000000, 0.873810800000,
+    0.884962400000, 0.895493600000, 0.905443200000, 0.914850100000,
+    0.923734800000, 0.932092400000, 0.939922600000, 0.947225200000,
+    0.954000000000, 0.960256100000, 0.966007400000, 0.971260600000,
+    0.976022500000, 0.980300000000, 0.984092400000, 0.987418200000,
+    0.990312800000, 0.992811600000, 0.994950100000, 0.996710800000,
+    0.998098300000, 0.999112000000, 0.999748200000, 1.000000000000,
+    0.999856700000, 0.999304600000, 0.998325500000, 0.996898700000,
+    0.995000000000, 0.992600500000, 0.989742600000, 0.986444400000,
+    0.982724100000, 0.978600000000, 0.974083700000, 0.969171200000,
+    0.963856800000, 0.958134900000, 0.952000000000, 0.945450400000,
+    0.938499200000, 0.931162800000, 0.923457600000, 0.915400000000,
+    0.907006400000, 0.898277200000, 0.889204800000, 0.879781600000,
+    0.870000000000, 0.859861300000, 0.849392000000, 0.838622000000,
+    0.827581300000, 0.816300000000, 0.804794700000, 0.793082000000,
+    0.781192000000, 0.769154700000, 0.757000000000, 0.744754100000,
+    0.732422400000, 0.720003600000, 0.707496500000, 0.694900000000,
+    0.682219200000, 0.669471600000, 0.656674400000, 0.643844800000,
+    0.631000000000, 0.618155500000, 0.605314400000, 0.592475600000,
+    0.579637900000, 0.566800000000, 0.553961100000, 0.541137200000,
+    0.528352800000, 0.515632300000, 0.503000000000, 0.490468800000,
+    0.478030400000, 0.465677600000, 0.453403200000, 0.441200000000,
+    0.429080000000, 0.417036000000, 0.405032000000, 0.393032000000,
+    0.381000000000, 0.368918400000, 0.356827200000, 0.344776800000,
+    0.332817600000, 0.321000000000, 0.309338100000, 0.297850400000,
+    0.286593600000, 0.275624500000, 0.265000000000, 0.254763200000,
+    0.244889600000, 0.235334400000, 0.226052800000, 0.217000000000,
+    0.208161600000, 0.199548800000, 0.191155200000, 0.182974400000,
+    0.175000000000, 0.167223500000, 0.159646400000, 0.152277600000,
+    0.145125900000, 0.138200000000, 0.131500300000, 0.125024800000,
+    0.118779200000, 0.112769100000, 0.107000000000, 0.101476200000,
+    0.096188640000, 0.091122960000, 0.086264850000, 0.081600000000,
+    0.077120640000, 0.072825520000, 0.068710080000, 0.064769760000,
+    0.061000000000, 0.057396210000, 0.053955040000, 0.050673760000,
+    0.047549650000, 0.044580000000, 0.041758720000, 0.039084960000,
+    0.036563840000, 0.034200480000, 0.032000000000, 0.029962610000,
+    0.028076640000, 0.026329360000, 0.024708050000, 0.023200000000,
+    0.021800770000, 0.020501120000, 0.019281080000, 0.018120690000,
+    0.017000000000, 0.015903790000, 0.014837180000, 0.013810680000,
+    0.012834780000, 0.011920000000, 0.011068310000, 0.010273390000,
+    0.009533311000, 0.008846157000, 0.008210000000, 0.007623781000,
+    0.007085424000, 0.006591476000, 0.006138485000, 0.005723000000,
+    0.005343059000, 0.004995796000, 0.004676404000, 0.004380075000,
+    0.004102000000, 0.003838453000, 0.003589099000, 0.003354219000,
+    0.003134093000, 0.002929000000, 0.002738139000, 0.002559876000,
+    0.002393244000, 0.002237275000, 0.002091000000, 0.001953587000,
+    0.001824580000, 0.001703580000, 0.001590187000, 0.001484000000,
+    0.001384496000, 0.001291268000, 0.001204092000, 0.001122744000,
+    0.001047000000, 0.000976589600, 0.000911108800, 0.000850133200,
+    0.000793238400, 0.000740000000, 0.000690082700, 0.000643310000,
+    0.000599496000, 0.000558454700, 0.000520000000, 0.000483913600,
+    0.000450052800, 0.000418345200, 0.000388718400, 0.000361100000,
+    0.000335383500, 0.000311440400, 0.000289165600, 0.000268453900,
+    0.000249200000, 0.000231301900, 0.000214685600, 0.000199288400,
+    0.000185047500, 0.000171900000, 0.000159778100, 0.000148604400,
+    0.000138301600, 0.000128792500, 0.000120000000, 0.000111859500,
+    0.000104322400, 0.000097335600, 0.000090845870, 0.000084800000,
+    0.000079146670, 0.000073858000, 0.000068916000, 0.000064302670,
+    0.000060000000, 0.000055981870, 0.000052225600, 0.000048718400,
+    0.000045447470, 0.000042400000, 0.000039561040, 0.000036915120,
+    0.000034448680, 0.000032148160, 0.000030000000, 0.000027991250,
+    0.000026113560, 0.000024360240, 0.000022724610, 0.000021200000,
+    0.000019778550, 0.000018452850, 0.000017216870, 0.000016064590,
+    0.000014990000, 0.000013987280, 0.000013051550, 0.000012178180,
+    0.000011362540, 0.000010600000, 0.000009885877, 0.000009217304,
+    0.000008592362, 0.000008009133, 0.000007465700, 0.000006959567,
+    0.000006487995, 0.000006048699, 0.000005639396, 0.000005257800,
+    0.000004901771, 0.000004569720, 0.000004260194, 0.000003971739,
+    0.000003702900, 0.000003452163, 0.000003218302, 0.000003000300,
+    0.000002797139, 0.000002607800, 0.000002431220, 0.000002266531,
+    0.000002113013, 0.000001969943, 0.000001836600, 0.000001712230,
+    0.000001596228, 0.000001488090, 0.000001387314, 0.000001293400,
+    0.000001205820, 0.000001124143, 0.000001048009, 0.000000977058,
+    0.000000910930, 0.000000849251, 0.000000791721, 0.000000738090,
+    0.000000688110, 0.000000641530, 0.000000598090, 0.000000557575,
+    0.000000519808, 0.000000484612, 0.000000451810};
+
+constexpr float k_cie_1931_2_z[] = {
+    0.000606100000, 0.000680879200, 0.000765145600, 0.000860012400,
+    0.000966592800, 0.001086000000, 0.001220586000, 0.001372729000,
+    0.001543579000, 0.001734286000, 0.001946000000, 0.002177777000,
+    0.002435809000, 0.002731953000, 0.003078064000, 0.003486000000,
+    0.003975227000, 0.004540880000, 0.005158320000, 0.005802907000,
+    0.006450001000, 0.007083216000, 0.007745488000, 0.008501152000,
+    0.009414544000, 0.010549990000, 0.011965800000, 0.013655870000,
+    0.015588050000, 0.017730150000, 0.020050010000, 0.022511360000,
+    0.025202880000, 0.028279720000, 0.031897040000, 0.036210000000,
+    0.041437710000, 0.047503720000, 0.054119880000, 0.060998030000,
+    0.067850010000, 0.074486320000, 0.081361560000, 0.089153640000,
+    0.098540480000, 0.110200000000, 0.124613300000, 0.141701700000,
+    0.161303500000, 0.183256800000, 0.207400000000, 0.233692100000,
+    0.262611400000, 0.294774600000, 0.330798500000, 0.371300000000,
+    0.416209100000, 0.465464200000, 0.519694800000, 0.579530300000,
+    0.645600000000, 0.718483800000, 0.796713300000, 0.877845900000,
+    0.959439000000, 1.039050100000, 1.115367300000, 1.188497100000,
+    1.258123300000, 1.323929600000, 1.385600000000, 1.442635200000,
+    1.494803500000, 1.542190300000, 1.584880700000, 1.622960000000,
+    1.656404800000, 1.685295900000, 1.709874500000, 1.730382100000,
+    1.747060000000, 1.760044600000, 1.769623300000, 1.776263700000,
+    1.780433400000, 1.782600000000, 1.782968200000, 1.781699800000,
+    1.779198200000, 1.775867100000, 1.772110000000, 1.768258900000,
+    1.764039000000, 1.758943800000, 1.752466300000, 1.744100000000,
+    1.733559500000, 1.720858100000, 1.705936900000, 1.688737200000,
+    1.669200000000, 1.647528700000, 1.623412700000, 1.596022300000,
+    1.564528000000, 1.528100000000, 1.486111400000, 1.439521500000,
+    1.389879900000, 1.338736200000, 1.287640000000, 1.237422300000,
+    1.187824300000, 1.138761100000, 1.090148000000, 1.041900000000,
+    0.994197600000, 0.947347300000, 0.901453100000, 0.856619300000,
+    0.812950100000, 0.770517300000, 0.729444800000, 0.689913600000,
+    0.652104900000, 0.616200000000, 0.582328600000, 0.550416200000,
+    0.520337600000, 0.491967300000, 0.465180000000, 0.439924600000,
+    0.416183600000, 0.393882200000, 0.372945900000, 0.353300000000,
+    0.334857800000, 0.317552100000, 0.301337500000, 0.286168600000,
+    0.272000000000, 0.258817100000, 0.246483800000, 0.234771800000,
+    0.223453300000, 0.212300000000, 0.201169200000, 0.190119600000,
+    0.179225400000, 0.168560800000, 0.158200000000, 0.148138300000,
+    0.138375800000, 0.128994200000, 0.120075100000, 0.111700000000,
+    0.103904800000, 0.096667480000, 0.089982720000, 0.083845310000,
+    0.078249990000, 0.073208990000, 0.068678160000, 0.064567840000,
+    0.060788350000, 0.057250010000, 0.053904350000, 0.050746640000,
+    0.047752760000, 0.044898590000, 0.042160000000, 0.039507280000,
+    0.036935640000, 0.034458360000, 0.032088720000, 0.029840000000,
+    0.027711810000, 0.025694440000, 0.023787160000, 0.021989250000,
+    0.020300000000, 0.018718050000, 0.017240360000, 0.015863640000,
+    0.014584610000, 0.013400000000, 0.012307230000, 0.011301880000,
+    0.010377920000, 0.009529306000, 0.008749999000, 0.008035200000,
+    0.007381600000, 0.006785400000, 0.006242800000, 0.005749999000,
+    0.005303600000, 0.004899800000, 0.004534200000, 0.004202400000,
+    0.003900000000, 0.003623200000, 0.003370600000, 0.003141400000,
+    0.002934800000, 0.002749999000, 0.002585200000, 0.002438600000,
+    0.002309400000, 0.002196800000, 0.002100000000, 0.002017733000,
+    0.001948200000, 0.001889800000, 0.001840933000, 0.001800000000,
+    0.001766267000, 0.001737800000, 0.001711200000, 0.001683067000,
+    0.001650001000, 0.001610133000, 0.001564400000, 0.001513600000,
+    0.001458533000, 0.001400000000, 0.001336667000, 0.001270000000,
+    0.001205000000, 0.001146667000, 0.001100000000, 0.001068800000,
+    0.001049400000, 0.001035600000, 0.001021200000, 0.001000000000,
+    0.000968640000, 0.000929920000, 0.000886880000, 0.000842560000,
+    0.000800000000, 0.000760960000, 0.000723680000, 0.000685920000,
+    0.000645440000, 0.000600000000, 0.000547866700, 0.000491600000,
+    0.000435400000, 0.000383466700, 0.000340000000, 0.000307253300,
+    0.000283160000, 0.000265440000, 0.000251813300, 0.000240000000,
+    0.000229546700, 0.000220640000, 0.000211960000, 0.000202186700,
+    0.000190000000, 0.000174213300, 0.000155640000, 0.000135960000,
+    0.000116853300, 0.000100000000, 0.000086133330, 0.000074600000,
+    0.000065000000, 0.000056933330, 0.000049999990, 0.000044160000,
+    0.000039480000, 0.000035720000, 0.000032640000, 0.000030000000,
+    0.000027653330, 0.000025560000, 0.000023640000, 0.000021813330,
+    0.000020000000, 0.000018133330, 0.000016200000, 0.000014200000,
+    0.000012133330, 0.000010000000, 0.000007733333, 0.000005400000,
+    0.000003200000, 0.000001333333, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000};
+
+constexpr float k_cie_1964_10_x[] = {
+    0.000000122200, 0.000000185138, 0.000000278830, 0.000000417470,
+    0.000000621330, 0.000000919270, 0.000001351980, 0.000001976540,
+    0.000002872500, 0.000004149500, 0.000005958600, 0.000008505600,
+    0.000012068600, 0.000017022600, 0.000023868000, 0.000033266000,
+    0.000046087000, 0.000063472000, 0.000086892000, 0.000118246000,
+    0.000159952000, 0.000215080000, 0.000287490000, 0.000381990000,
+    0.000504550000, 0.000662440000, 0.000864500000, 0.001121500000,
+    0.001446160000, 0.001853590000, 0.002361600000, 0.002990600000,
+    0.003764500000, 0.004710200000, 0.005858100000, 0.007242300000,
+    0.008899600000, 0.010870900000, 0.013198900000, 0.015929200000,
+    0.019109700000, 0.022788000000, 0.027011000000, 0.031829000000,
+    0.037278000000, 0.043400000000, 0.050223000000, 0.057764000000,
+    0.066038000000, 0.075033000000, 0.084736000000, 0.095041000000,
+    0.105836000000, 0.117066000000, 0.128682000000, 0.140638000000,
+    0.152893000000, 0.165416000000, 0.178191000000, 0.191214000000,
+    0.204492000000, 0.217650000000, 0.230267000000, 0.242311000000,
+    0.253793000000, 0.264737000000, 0.275195000000, 0.285301000000,
+    0.295143000000, 0.304869000000, 0.314679000000, 0.324355000000,
+    0.333570000000, 0.342243000000, 0.350312000000, 0.357719000000,
+    0.364482000000, 0.370493000000, 0.375727000000, 0.380158000000,
+    0.383734000000, 0.386327000000, 0.387858000000, 0.388396000000,
+    0.387978000000, 0.386726000000, 0.384696000000, 0.382006000000,
+    0.378709000000, 0.374915000000, 0.370702000000, 0.366089000000,
+    0.361045000000, 0.355518000000, 0.349486000000, 0.342957000000,
+    0.335893000000, 0.328284000000, 0.320150000000, 0.311475000000,
+    0.302273000000, 0.292858000000, 0.283502000000, 0.274044000000,
+    0.264263000000, 0.254085000000, 0.243392000000, 0.232187000000,
+    0.220488000000, 0.208198000000, 0.195618000000, 0.183034000000,
+    0.170222000000, 0.157348000000, 0.144650000000, 0.132349000000,
+    0.120584000000, 0.109456000000, 0.099042000000, 0.089388000000,
+    0.080507000000, 0.072034000000, 0.063710000000, 0.055694000000,
+    0.048117000000, 0.041072000000, 0.034642000000, 0.028896000000,
+    0.023876000000, 0.019628000000, 0.016172000000, 0.013300000000,
+    0.010759000000, 0.008542000000, 0.006661000000, 0.005132000000,
+    0.003982000000, 0.003239000000, 0.002934000000, 0.003114000000,
+    0.003816000000, 0.005095000000, 0.006936000000, 0.009299000000,
+    0.012147000000, 0.015444000000, 0.019156000000, 0.023250000000,
+    0.027690000000, 0.032444000000, 0.037465000000, 0.042956000000,
+    0.049114000000, 0.055920000000, 0.063349000000, 0.071358000000,
+    0.079901000000, 0.088909000000, 0.098293000000, 0.107949000000,
+    0.117749000000, 0.127839000000, 0.138450000000, 0.149516000000,
+    0.161041000000, 0.172953000000, 0.185209000000, 0.197755000000,
+    0.210538000000, 0.223460000000, 0.236491000000, 0.249633000000,
+    0.262972000000, 0.276515000000, 0.290269000000, 0.304213000000,
+    0.318361000000, 0.332705000000, 0.347232000000, 0.361926000000,
+    0.376772000000, 0.391683000000, 0.406594000000, 0.421539000000,
+    0.436517000000, 0.451584000000, 0.466782000000, 0.482147000000,
+    0.497738000000, 0.513606000000, 0.529826000000, 0.546440000000,
+    0.563426000000, 0.580726000000, 0.598290000000, 0.616053000000,
+    0.633948000000, 0.651901000000, 0.669824000000, 0.687632000000,
+    0.705224000000, 0.722773000000, 0.740483000000, 0.758273000000,
+    0.776083000000, 0.793832000000, 0.811436000000, 0.828822000000,
+    0.845879000000, 0.862525000000, 0.878655000000, 0.894208000000,
+    0.909206000000, 0.923672000000, 0.937638000000, 0.951162000000,
+    0.964283000000, 0.977068000000, 0.989590000000, 1.001910000000,
+    1.014160000000, 1.026500000000, 1.038800000000, 1.051000000000,
+    1.062900000000, 1.074300000000, 1.085200000000, 1.095200000000,
+    1.104200000000, 1.112000000000, 1.118520000000, 1.123800000000,
+    1.128000000000, 1.131100000000, 1.133200000000, 1.134300000000,
+    1.134300000000, 1.133300000000, 1.131200000000, 1.128100000000,
+    1.123990000000, 1.118900000000, 1.112900000000, 1.105900000000,
+    1.098000000000, 1.089100000000, 1.079200000000, 1.068400000000,
+    1.056700000000, 1.044000000000, 1.030480000000, 1.016000000000,
+    1.000800000000, 0.984790000000, 0.968080000000, 0.950740000000,
+    0.932800000000, 0.914340000000, 0.895390000000, 0.876030000000,
+    0.856297000000, 0.836350000000, 0.816290000000, 0.796050000000,
+    0.775610000000, 0.754930000000, 0.733990000000, 0.712780000000,
+    0.691290000000, 0.669520000000, 0.647467000000, 0.625110000000,
+    0.602520000000, 0.579890000000, 0.557370000000, 0.535110000000,
+    0.513240000000, 0.491860000000, 0.471080000000, 0.450960000000,
+    0.431567000000, 0.412870000000, 0.394750000000, 0.377210000000,
+    0.360190000000, 0.343690000000, 0.327690000000, 0.312170000000,
+    0.297110000000, 0.282500000000, 0.268329000000, 0.254590000000,
+    0.241300000000, 0.228480000000, 0.216140000000, 0.204300000000,
+    0.192950000000, 0.182110000000, 0.171770000000, 0.161920000000,
+    0.152568000000, 0.143670000000, 0.135200000000, 0.127130000000,
+    0.119480000000, 0.112210000000, 0.105310000000, 0.098786000000,
+    0.092610000000, 0.086773000000, 0.081260600000, 0.076048000000,
+    0.071114000000, 0.066454000000, 0.062062000000, 0.057930000000,
+    0.054050000000, 0.050412000000, 0.047006000000, 0.043823000000,
+    0.040850800000, 0.038072000000, 0.035468000000, 0.033031000000,
+    0.030753000000, 0.028623000000, 0.026635000000, 0.024781000000,
+    0.023052000000, 0.021441000000, 0.019941300000, 0.018544000000,
+    0.017241000000, 0.016027000000, 0.014896000000, 0.013842000000,
+    0.012862000000, 0.011949000000, 0.011100000000, 0.010311000000,
+    0.009576880000, 0.008894000000, 0.008258100000, 0.007666400000,
+    0.007116300000, 0.006605200000, 0.006130600000, 0.005690300000,
+    0.005281900000, 0.004903300000, 0.004552630000, 0.004227500000,
+    0.003925800000, 0.003645700000, 0.003385900000, 0.003144700000,
+    0.002920800000, 0.002713000000, 0.002520200000, 0.002341100000,
+    0.002174960000, 0.002020600000, 0.001877300000, 0.001744100000,
+    0.001620500000, 0.001505700000, 0.001399200000, 0.001300400000,
+    0.001208700000, 0.001123600000, 0.001044760000, 0.000971560000,
+    0.000903600000, 0.000840480000, 0.000781870000, 0.000727450000,
+    0.000676900000, 0.000629960000, 0.000586370000, 0.000545870000,
+    0.000508258000, 0.000473300000, 0.000440800000, 0.000410580000,
+    0.000382490000, 0.000356380000, 0.000332110000, 0.000309550000,
+    0.000288580000, 0.000269090000, 0.000250969000, 0.000234130000,
+    0.000218470000, 0.000203910000, 0.000190350000, 0.000177730000,
+    0.000165970000, 0.000155020000, 0.000144800000, 0.000135280000,
+    0.000126390000, 0.000118100000, 0.000110370000, 0.000103150000,
+    0.000096427000, 0.000090151000, 0.000084294000, 0.000078830000,
+    0.000073729000, 0.000068969000, 0.000064525800, 0.000060376000,
+    0.000056500000, 0.000052880000, 0.000049498000, 0.000046339000,
+    0.000043389000, 0.000040634000, 0.000038060000, 0.000035657000,
+    0.000033411700, 0.000031315000, 0.000029355000, 0.000027524000,
+    0.000025811000, 0.000024209000, 0.000022711000, 0.000021308000,
+    0.000019994000, 0.000018764000, 0.000017611500, 0.000016532000,
+    0.000015521000, 0.000014574000, 0.000013686000, 0.000012855000,
+    0.000012075000, 0.000011345000, 0.000010659000, 0.000010017000,
+    0.000009413630, 0.000008847900, 0.000008317100, 0.000007819000,
+    0.000007351600, 0.000006913000, 0.000006501500, 0.000006115300,
+    0.000005752900, 0.000005412700, 0.000005093470, 0.000004793800,
+    0.000004512500, 0.000004248300, 0.000004000200, 0.000003767100,
+    0.000003548000, 0.000003342100, 0.000003148500, 0.000002966500,
+    0.000002795310, 0.000002634500, 0.000002483400, 0.000002341400,
+    0.000002207800, 0.000002082000, 0.000001963600, 0.000001851900,
+    0.000001746500, 0.000001647100, 0.000001553140};
+
+constexpr float k_cie_1964_10_y[] = {
+    0.000000013398, 0.000000020294, 0.000000030560, 0.000000045740,
+    0.000000068050, 0.000000100650, 0.000000147980, 0.000000216270,
+    0.000000314200, 0.000000453700, 0.000000651100, 0.000000928800,
+    0.000001317500, 0.000001857200, 0.000002602000, 0.000003625000,
+    0.000005019000, 0.000006907000, 0.000009449000, 0.000012848000,
+    0.000017364000, 0.000023327000, 0.000031150000, 0.000041350000,
+    0.000054560000, 0.000071560000, 0.000093300000, 0.000120870000,
+    0.000155640000, 0.000199200000, 0.000253400000, 0.000320200000,
+    0.000402400000, 0.000502300000, 0.000623200000, 0.000768500000,
+    0.000941700000, 0.001147800000, 0.001390300000, 0.001674000000,
+    0.002004400000, 0.002386000000, 0.002822000000, 0.003319000000,
+    0.003880000000, 0.004509000000, 0.005209000000, 0.005985000000,
+    0.006833000000, 0.007757000000, 0.008756000000, 0.009816000000,
+    0.010918000000, 0.012058000000, 0.013237000000, 0.014456000000,
+    0.015717000000, 0.017025000000, 0.018399000000, 0.019848000000,
+    0.021391000000, 0.022992000000, 0.024598000000, 0.026213000000,
+    0.027841000000, 0.029497000000, 0.031195000000, 0.032927000000,
+    0.034738000000, 0.036654000000, 0.038676000000, 0.040792000000,
+    0.042946000000, 0.045114000000, 0.047333000000, 0.049602000000,
+    0.051934000000, 0.054337000000, 0.056822000000, 0.059399000000,
+    0.062077000000, 0.064737000000, 0.067285000000, 0.069764000000,
+    0.072218000000, 0.074704000000, 0.077272000000, 0.079979000000,
+    0.082874000000, 0.086000000000, 0.089456000000, 0.092947000000,
+    0.096275000000, 0.099535000000, 0.102829000000, 0.106256000000,
+    0.109901000000, 0.113835000000, 0.118167000000, 0.122932000000,
+    0.128201000000, 0.133457000000, 0.138323000000, 0.143042000000,
+    0.147787000000, 0.152761000000, 0.158102000000, 0.163941000000,
+    0.170362000000, 0.177425000000, 0.185190000000, 0.193025000000,
+    0.200313000000, 0.207156000000, 0.213644000000, 0.219940000000,
+    0.226170000000, 0.232467000000, 0.239025000000, 0.245997000000,
+    0.253589000000, 0.261876000000, 0.270643000000, 0.279645000000,
+    0.288694000000, 0.297665000000, 0.306469000000, 0.315035000000,
+    0.323335000000, 0.331366000000, 0.339133000000, 0.347860000000,
+    0.358326000000, 0.370001000000, 0.382464000000, 0.395379000000,
+    0.408482000000, 0.421588000000, 0.434619000000, 0.447601000000,
+    0.460777000000, 0.474340000000, 0.488200000000, 0.502340000000,
+    0.516740000000, 0.531360000000, 0.546190000000, 0.561180000000,
+    0.576290000000, 0.591500000000, 0.606741000000, 0.622150000000,
+    0.637830000000, 0.653710000000, 0.669680000000, 0.685660000000,
+    0.701550000000, 0.717230000000, 0.732570000000, 0.747460000000,
+    0.761757000000, 0.775340000000, 0.788220000000, 0.800460000000,
+    0.812140000000, 0.823330000000, 0.834120000000, 0.844600000000,
+    0.854870000000, 0.865040000000, 0.875211000000, 0.885370000000,
+    0.895370000000, 0.905150000000, 0.914650000000, 0.923810000000,
+    0.932550000000, 0.940810000000, 0.948520000000, 0.955600000000,
+    0.961988000000, 0.967540000000, 0.972230000000, 0.976170000000,
+    0.979460000000, 0.982200000000, 0.984520000000, 0.986520000000,
+    0.988320000000, 0.990020000000, 0.991761000000, 0.993530000000,
+    0.995230000000, 0.996770000000, 0.998090000000, 0.999110000000,
+    0.999770000000, 1.000000000000, 0.999710000000, 0.998850000000,
+    0.997340000000, 0.995260000000, 0.992740000000, 0.989750000000,
+    0.986300000000, 0.982380000000, 0.977980000000, 0.973110000000,
+    0.967740000000, 0.961890000000, 0.955552000000, 0.948601000000,
+    0.940981000000, 0.932798000000, 0.924158000000, 0.915175000000,
+    0.905954000000, 0.896608000000, 0.887249000000, 0.877986000000,
+    0.868934000000, 0.860164000000, 0.851519000000, 0.842963000000,
+    0.834393000000, 0.825623000000, 0.816764000000, 0.807544000000,
+    0.797947000000, 0.787893000000, 0.777405000000, 0.766490000000,
+    0.755309000000, 0.743845000000, 0.732190000000, 0.720353000000,
+    0.708281000000, 0.696055000000, 0.683621000000, 0.671048000000,
+    0.658341000000, 0.645545000000, 0.632718000000, 0.619815000000,
+    0.606887000000, 0.593878000000, 0.580781000000, 0.567653000000,
+    0.554490000000, 0.541228000000, 0.527963000000, 0.514634000000,
+    0.501363000000, 0.488124000000, 0.474935000000, 0.461834000000,
+    0.448823000000, 0.435917000000, 0.423153000000, 0.410526000000,
+    0.398057000000, 0.385835000000, 0.373951000000, 0.362311000000,
+    0.350863000000, 0.339554000000, 0.328309000000, 0.317118000000,
+    0.305936000000, 0.294737000000, 0.283493000000, 0.272222000000,
+    0.260990000000, 0.249877000000, 0.238946000000, 0.228254000000,
+    0.217853000000, 0.207780000000, 0.198072000000, 0.188748000000,
+    0.179828000000, 0.171285000000, 0.163059000000, 0.155151000000,
+    0.147535000000, 0.140211000000, 0.133170000000, 0.126400000000,
+    0.119892000000, 0.113640000000, 0.107633000000, 0.101870000000,
+    0.096347000000, 0.091063000000, 0.086010000000, 0.081187000000,
+    0.076583000000, 0.072198000000, 0.068024000000, 0.064052000000,
+    0.060281000000, 0.056697000000, 0.053292000000, 0.050059000000,
+    0.046998000000, 0.044096000000, 0.041345000000, 0.038750700000,
+    0.036297800000, 0.033983200000, 0.031800400000, 0.029739500000,
+    0.027791800000, 0.025955100000, 0.024226300000, 0.022601700000,
+    0.021077900000, 0.019650500000, 0.018315300000, 0.017068600000,
+    0.015905100000, 0.014818300000, 0.013800800000, 0.012849500000,
+    0.011960700000, 0.011130300000, 0.010355500000, 0.009633200000,
+    0.008959900000, 0.008332400000, 0.007748800000, 0.007204600000,
+    0.006697500000, 0.006225100000, 0.005785000000, 0.005375100000,
+    0.004994100000, 0.004639200000, 0.004309300000, 0.004002800000,
+    0.003717740000, 0.003452620000, 0.003205830000, 0.002976230000,
+    0.002762810000, 0.002564560000, 0.002380480000, 0.002209710000,
+    0.002051320000, 0.001904490000, 0.001768470000, 0.001642360000,
+    0.001525350000, 0.001416720000, 0.001315950000, 0.001222390000,
+    0.001135550000, 0.001054940000, 0.000980140000, 0.000910660000,
+    0.000846190000, 0.000786290000, 0.000730680000, 0.000678990000,
+    0.000631010000, 0.000586440000, 0.000545110000, 0.000506720000,
+    0.000471110000, 0.000438050000, 0.000407410000, 0.000378962000,
+    0.000352543000, 0.000328001000, 0.000305208000, 0.000284041000,
+    0.000264375000, 0.000246109000, 0.000229143000, 0.000213376000,
+    0.000198730000, 0.000185115000, 0.000172454000, 0.000160678000,
+    0.000149730000, 0.000139550000, 0.000130086000, 0.000121290000,
+    0.000113106000, 0.000105501000, 0.000098428000, 0.000091853000,
+    0.000085738000, 0.000080048000, 0.000074751000, 0.000069819000,
+    0.000065222000, 0.000060939000, 0.000056942000, 0.000053217000,
+    0.000049737000, 0.000046491000, 0.000043464000, 0.000040635000,
+    0.000038000000, 0.000035540500, 0.000033244800, 0.000031100600,
+    0.000029099000, 0.000027230700, 0.000025486000, 0.000023856100,
+    0.000022333200, 0.000020910400, 0.000019580800, 0.000018338400,
+    0.000017177700, 0.000016093400, 0.000015080000, 0.000014133600,
+    0.000013249000, 0.000012422600, 0.000011649900, 0.000010927700,
+    0.000010251900, 0.000009619600, 0.000009028100, 0.000008474000,
+    0.000007954800, 0.000007468600, 0.000007012800, 0.000006585800,
+    0.000006185700, 0.000005810700, 0.000005459000, 0.000005129800,
+    0.000004820600, 0.000004531200, 0.000004259100, 0.000004004200,
+    0.000003764730, 0.000003539950, 0.000003329140, 0.000003131150,
+    0.000002945290, 0.000002770810, 0.000002607050, 0.000002453290,
+    0.000002308940, 0.000002173380, 0.000002046130, 0.000001926620,
+    0.000001814400, 0.000001708950, 0.000001609880, 0.000001516770,
+    0.000001429210, 0.000001346860, 0.000001269450, 0.000001196620,
+    0.000001128090, 0.000001063680, 0.000001003130, 0.000000946220,
+    0.000000892630, 0.000000842160, 0.000000794640, 0.000000749780,
+    0.000000707440, 0.000000667480, 0.000000629700};
+
+constexpr float k_cie_1964_10_z[] = {
+    0.000000535027, 0.000000810720, 0.000001221200, 0.000001828700,
+    0.000002722200, 0.000004028300, 0.000005925700, 0.000008665100,
+    0.000012596000, 0.000018201000, 0.000026143700, 0.000037330000,
+    0.000052987000, 0.000074764000, 0.000104870000, 0.000146220000,
+    0.000202660000, 0.000279230000, 0.000382450000, 0.000520720000,
+    0.000704776000, 0.000948230000, 0.001268200000, 0.001686100000,
+    0.002228500000, 0.002927800000, 0.003823700000, 0.004964200000,
+    0.006406700000, 0.008219300000, 0.010482200000, 0.013289000000,
+    0.016747000000, 0.020980000000, 0.026127000000, 0.032344000000,
+    0.039802000000, 0.048691000000, 0.059210000000, 0.071576000000,
+    0.086010900000, 0.102740000000, 0.122000000000, 0.144020000000,
+    0.168990000000, 0.197120000000, 0.228570000000, 0.263470000000,
+    0.301900000000, 0.343870000000, 0.389366000000, 0.437970000000,
+    0.489220000000, 0.542900000000, 0.598810000000, 0.656760000000,
+    0.716580000000, 0.778120000000, 0.841310000000, 0.906110000000,
+    0.972542000000, 1.038900000000, 1.103100000000, 1.165100000000,
+    1.224900000000, 1.282500000000, 1.338200000000, 1.392600000000,
+    1.446100000000, 1.499400000000, 1.553480000000, 1.607200000000,
+    1.658900000000, 1.708200000000, 1.754800000000, 1.798500000000,
+    1.839200000000, 1.876600000000, 1.910500000000, 1.940800000000,
+    1.967280000000, 1.989100000000, 2.005700000000, 2.017400000000,
+    2.024400000000, 2.027300000000, 2.026400000000, 2.022300000000,
+    2.015300000000, 2.006000000000, 1.994800000000, 1.981400000000,
+    1.965300000000, 1.946400000000, 1.924800000000, 1.900700000000,
+    1.874100000000, 1.845100000000, 1.813900000000, 1.780600000000,
+    1.745370000000, 1.709100000000, 1.672300000000, 1.634700000000,
+    1.595600000000, 1.554900000000, 1.512200000000, 1.467300000000,
+    1.419900000000, 1.370000000000, 1.317560000000, 1.262400000000,
+    1.205000000000, 1.146600000000, 1.088000000000, 1.030200000000,
+    0.973830000000, 0.919430000000, 0.867460000000, 0.818280000000,
+    0.772125000000, 0.728290000000, 0.686040000000, 0.645530000000,
+    0.606850000000, 0.570060000000, 0.535220000000, 0.502340000000,
+    0.471400000000, 0.442390000000, 0.415254000000, 0.390024000000,
+    0.366399000000, 0.344015000000, 0.322689000000, 0.302356000000,
+    0.283036000000, 0.264816000000, 0.247848000000, 0.232318000000,
+    0.218502000000, 0.205851000000, 0.193596000000, 0.181736000000,
+    0.170281000000, 0.159249000000, 0.148673000000, 0.138609000000,
+    0.129096000000, 0.120215000000, 0.112044000000, 0.104710000000,
+    0.098196000000, 0.092361000000, 0.087088000000, 0.082248000000,
+    0.077744000000, 0.073456000000, 0.069268000000, 0.065060000000,
+    0.060709000000, 0.056457000000, 0.052609000000, 0.049122000000,
+    0.045954000000, 0.043050000000, 0.040368000000, 0.037839000000,
+    0.035384000000, 0.032949000000, 0.030451000000, 0.028029000000,
+    0.025862000000, 0.023920000000, 0.022174000000, 0.020584000000,
+    0.019127000000, 0.017740000000, 0.016403000000, 0.015064000000,
+    0.013676000000, 0.012308000000, 0.011056000000, 0.009915000000,
+    0.008872000000, 0.007918000000, 0.007030000000, 0.006223000000,
+    0.005453000000, 0.004714000000, 0.003988000000, 0.003289000000,
+    0.002646000000, 0.002063000000, 0.001533000000, 0.001091000000,
+    0.000711000000, 0.000407000000, 0.000184000000, 0.000047000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000};
+
+constexpr float k_cie_2012_2_x[] = {
+    0.003769647000, 0.004532416000, 0.005446553000, 0.006538868000,
+    0.007839699000, 0.009382967000, 0.011206080000, 0.013349650000,
+    0.015856900000, 0.018772860000, 0.022143020000, 0.026012850000,
+    0.030430360000, 0.035443250000, 0.041096400000, 0.047429860000,
+    0.054473940000, 0.062236120000, 0.070700480000, 0.079825130000,
+    0.089538030000, 0.099748480000, 0.110401900000, 0.121456600000,
+    0.132874100000, 0.144621400000, 0.156646800000, 0.168790100000,
+    0.180832800000, 0.192521600000, 0.203572900000, 0.213753100000,
+    0.223134800000, 0.231924500000, 0.240389200000, 0.248852300000,
+    0.257589600000, 0.266499100000, 0.275353200000, 0.283892100000,
+    0.291824600000, 0.298920000000, 0.305299300000, 0.311203100000,
+    0.316904700000, 0.322708700000, 0.328819400000, 0.334924200000,
+    0.340545200000, 0.345168800000, 0.348255400000, 0.349415300000,
+    0.348907500000, 0.347174600000, 0.344670500000, 0.341848300000,
+    0.339024000000, 0.335992600000, 0.332427600000, 0.328015700000,
+    0.322463700000, 0.315622500000, 0.307820100000, 0.299477100000,
+    0.290977600000, 0.282664600000, 0.274796200000, 0.267431200000,
+    0.260584700000, 0.254274900000, 0.248525400000, 0.243303900000,
+    0.238341400000, 0.233325300000, 0.227961900000, 0.221978100000,
+    0.215173500000, 0.207561900000, 0.199218300000, 0.190229000000,
+    0.180690500000, 0.170715400000, 0.160447100000, 0.150024400000,
+    0.139570500000, 0.129192000000, 0.118985900000, 0.109061500000,
+    0.099514240000, 0.090418500000, 0.081828950000, 0.073768170000,
+    0.066194770000, 0.059063800000, 0.052342420000, 0.046008650000,
+    0.040061540000, 0.034543730000, 0.029490910000, 0.024921400000,
+    0.020839810000, 0.017235910000, 0.014079240000, 0.011345160000,
+    0.009019658000, 0.007097731000, 0.005571145000, 0.004394566000,
+    0.003516303000, 0.002887638000, 0.002461588000, 0.002206348000,
+    0.002149559000, 0.002337091000, 0.002818931000, 0.003649178000,
+    0.004891359000, 0.006629364000, 0.008942902000, 0.011902240000,
+    0.015569890000, 0.019976680000, 0.025046980000, 0.030675300000,
+    0.036749990000, 0.043151710000, 0.049785840000, 0.056685540000,
+    0.063916510000, 0.071543520000, 0.079629170000, 0.088214730000,
+    0.097269780000, 0.106750400000, 0.116619200000, 0.126846800000,
+    0.137406000000, 0.148247100000, 0.159307600000, 0.170518100000,
+    0.181802600000, 0.193109000000, 0.204508500000, 0.216116600000,
+    0.228065000000, 0.240501500000, 0.253544100000, 0.267130000000,
+    0.281135100000, 0.295416400000, 0.309811700000, 0.324167800000,
+    0.338431900000, 0.352578600000, 0.366583900000, 0.380424400000,
+    0.394098800000, 0.407697200000, 0.421348400000, 0.435200300000,
+    0.449420600000, 0.464161600000, 0.479439500000, 0.495218000000,
+    0.511439500000, 0.528023300000, 0.544869600000, 0.561889800000,
+    0.579013700000, 0.596188200000, 0.613378400000, 0.630589700000,
+    0.647922300000, 0.665486600000, 0.683378200000, 0.701677400000,
+    0.720411000000, 0.739449500000, 0.758628500000, 0.777788500000,
+    0.796775000000, 0.815453000000, 0.833738900000, 0.851549300000,
+    0.868786200000, 0.885337600000, 0.901158800000, 0.916527800000,
+    0.931824500000, 0.947452400000, 0.963838800000, 0.981259600000,
+    0.999295300000, 1.017343000000, 1.034790000000, 1.051011000000,
+    1.065522000000, 1.078421000000, 1.089944000000, 1.100320000000,
+    1.109767000000, 1.118438000000, 1.126266000000, 1.133138000000,
+    1.138952000000, 1.143620000000, 1.147095000000, 1.149464000000,
+    1.150838000000, 1.151326000000, 1.151033000000, 1.150002000000,
+    1.148061000000, 1.144998000000, 1.140622000000, 1.134757000000,
+    1.127298000000, 1.118342000000, 1.108033000000, 1.096515000000,
+    1.083928000000, 1.070387000000, 1.055934000000, 1.040592000000,
+    1.024385000000, 1.007344000000, 0.989526800000, 0.971121300000,
+    0.952325700000, 0.933324800000, 0.914287700000, 0.895279800000,
+    0.876015700000, 0.856160700000, 0.835423500000, 0.813556500000,
+    0.790456500000, 0.766436400000, 0.741877700000, 0.717121900000,
+    0.692471700000, 0.668160000000, 0.644269700000, 0.620845000000,
+    0.597924300000, 0.575541000000, 0.553729600000, 0.532541200000,
+    0.512021800000, 0.492207000000, 0.473122400000, 0.454741700000,
+    0.436871900000, 0.419312100000, 0.401898000000, 0.384498600000,
+    0.367059200000, 0.349716700000, 0.332630500000, 0.315934100000,
+    0.299737400000, 0.284118900000, 0.269105300000, 0.254707700000,
+    0.240931900000, 0.227779200000, 0.215243100000, 0.203301000000,
+    0.191927600000, 0.181098700000, 0.170791400000, 0.160984200000,
+    0.151657700000, 0.142793600000, 0.134373700000, 0.126380800000,
+    0.118797900000, 0.111608800000, 0.104797500000, 0.098348350000,
+    0.092245970000, 0.086475060000, 0.081019860000, 0.075865140000,
+    0.070996330000, 0.066399600000, 0.062062250000, 0.057974090000,
+    0.054125330000, 0.050506000000, 0.047106060000, 0.043914110000,
+    0.040914110000, 0.038090670000, 0.035430340000, 0.032921380000,
+    0.030556720000, 0.028341460000, 0.026280330000, 0.024374650000,
+    0.022623060000, 0.021019350000, 0.019546470000, 0.018187270000,
+    0.016927270000, 0.015754170000, 0.014658540000, 0.013635710000,
+    0.012682050000, 0.011793940000, 0.010967780000, 0.010199640000,
+    0.009484317000, 0.008816851000, 0.008192921000, 0.007608750000,
+    0.007061391000, 0.006549509000, 0.006071970000, 0.005627476000,
+    0.005214608000, 0.004831848000, 0.004477579000, 0.004150166000,
+    0.003847988000, 0.003569452000, 0.003312857000, 0.003076022000,
+    0.002856894000, 0.002653681000, 0.002464821000, 0.002289060000,
+    0.002125694000, 0.001974121000, 0.001833723000, 0.001703876000,
+    0.001583904000, 0.001472939000, 0.001370151000, 0.001274803000,
+    0.001186238000, 0.001103871000, 0.001027194000, 0.000955749300,
+    0.000889126200, 0.000826953500, 0.000768935100, 0.000714942500,
+    0.000664859000, 0.000618542100, 0.000575830300, 0.000536504600,
+    0.000500184200, 0.000466500500, 0.000435138600, 0.000405830300,
+    0.000378373300, 0.000352689200, 0.000328719900, 0.000306399800,
+    0.000285657700, 0.000266410800, 0.000248546200, 0.000231952900,
+    0.000216530000, 0.000202185300, 0.000188833800, 0.000176393500,
+    0.000164789500, 0.000153954200, 0.000143827000, 0.000134357200,
+    0.000125514100, 0.000117270600, 0.000109598300, 0.000102468500,
+    0.000095847150, 0.000089683160, 0.000083927340, 0.000078537080,
+    0.000073475510, 0.000068715760, 0.000064252570, 0.000060082920,
+    0.000056200980, 0.000052598700, 0.000049262790, 0.000046166230,
+    0.000043282120, 0.000040587150, 0.000038061140, 0.000035688180,
+    0.000033460230, 0.000031370900, 0.000029413710, 0.000027582220,
+    0.000025869510, 0.000024267010, 0.000022766390, 0.000021360090,
+    0.000020041220, 0.000018803800, 0.000017643580, 0.000016556710,
+    0.000015539390, 0.000014587920, 0.000013698530, 0.000012867050,
+    0.000012089470, 0.000011362070, 0.000010681410, 0.000010044110,
+    0.000009446399, 0.000008884754, 0.000008356050, 0.000007857521,
+    0.000007386996, 0.000006943576, 0.000006526548, 0.000006135087,
+    0.000005768284, 0.000005425069, 0.000005103974, 0.000004803525,
+    0.000004522350, 0.000004259166, 0.000004012715, 0.000003781597,
+    0.000003564496, 0.000003360236, 0.000003167765, 0.000002986206,
+    0.000002814999, 0.000002653663, 0.000002501725, 0.000002358723,
+    0.000002224206, 0.000002097737, 0.000001978894, 0.000001867268,
+    0.000001762465};
+
+constexpr float k_cie_2012_2_y[] = {
+    0.000414616100, 0.000502833300, 0.000608499100, 0.000734443600,
+    0.000883738900, 0.001059646000, 0.001265532000, 0.001504753000,
+    0.001780493000, 0.002095572000, 0.002452194000, 0.002852216000,
+    0.003299115000, 0.003797466000, 0.004352768000, 0.004971717000,
+    0.005661014000, 0.006421615000, 0.007250312000, 0.008140173000,
+    0.009079860000, 0.010056080000, 0.011064560000, 0.012105220000,
+    0.013180140000, 0.014293770000, 0.015450040000, 0.016640930000,
+    0.017853020000, 0.019070180000, 0.020273690000, 0.021448050000,
+    0.022600410000, 0.023747890000, 0.024912470000, 0.026121060000,
+    0.027399230000, 0.028749930000, 0.030169090000, 0.031651450000,
+    0.033190380000, 0.034779120000, 0.036414950000, 0.038095690000,
+    0.039818430000, 0.041579400000, 0.043370980000, 0.045171800000,
+    0.046954200000, 0.048687180000, 0.050336570000, 0.051876110000,
+    0.053322180000, 0.054706030000, 0.056063350000, 0.057433930000,
+    0.058851070000, 0.060308090000, 0.061786440000, 0.063265700000,
+    0.064723520000, 0.066147490000, 0.067572560000, 0.069049280000,
+    0.070632800000, 0.072383390000, 0.074359600000, 0.076593830000,
+    0.079114360000, 0.081953450000, 0.085148160000, 0.088726570000,
+    0.092660080000, 0.096897230000, 0.101374600000, 0.106014500000,
+    0.110737700000, 0.115511100000, 0.120312200000, 0.125116100000,
+    0.129895700000, 0.134629900000, 0.139330900000, 0.144023500000,
+    0.148737200000, 0.153506600000, 0.158364400000, 0.163319900000,
+    0.168376100000, 0.173536500000, 0.178804800000, 0.184181900000,
+    0.189655900000, 0.195210100000, 0.200825900000, 0.206482800000,
+    0.212182600000, 0.218027900000, 0.224158600000, 0.230730200000,
+    0.237916000000, 0.245870600000, 0.254602300000, 0.264076000000,
+    0.274249000000, 0.285068000000, 0.296483700000, 0.308501000000,
+    0.321139300000, 0.334417500000, 0.348353600000, 0.362960100000,
+    0.378227500000, 0.394135900000, 0.410658200000, 0.427759500000,
+    0.445399300000, 0.463539600000, 0.482137600000, 0.501143000000,
+    0.520497200000, 0.540138700000, 0.560020800000, 0.580097200000,
+    0.600317200000, 0.620625600000, 0.640939800000, 0.661077200000,
+    0.680813400000, 0.699904400000, 0.718089000000, 0.735159300000,
+    0.751182100000, 0.766314300000, 0.780735200000, 0.794644800000,
+    0.808207400000, 0.821381700000, 0.834070100000, 0.846171100000,
+    0.857579900000, 0.868240800000, 0.878306100000, 0.887990700000,
+    0.897521100000, 0.907134700000, 0.916994700000, 0.926929500000,
+    0.936673100000, 0.945948200000, 0.954467500000, 0.961983400000,
+    0.968439000000, 0.973828900000, 0.978151900000, 0.981410600000,
+    0.983666900000, 0.985208100000, 0.986381300000, 0.987535700000,
+    0.989022800000, 0.991081100000, 0.993491300000, 0.995917200000,
+    0.998020500000, 0.999460800000, 0.999993000000, 0.999755700000,
+    0.998983900000, 0.997912300000, 0.996773700000, 0.995735600000,
+    0.994711500000, 0.993553400000, 0.992115600000, 0.990254900000,
+    0.987859600000, 0.984932400000, 0.981503600000, 0.977603500000,
+    0.973261100000, 0.968476400000, 0.963136900000, 0.957106200000,
+    0.950254000000, 0.942456900000, 0.933689700000, 0.924289300000,
+    0.914670700000, 0.905233300000, 0.896361300000, 0.888306900000,
+    0.880846200000, 0.873644500000, 0.866375500000, 0.858720300000,
+    0.850429500000, 0.841504700000, 0.832010900000, 0.822015400000,
+    0.811586800000, 0.800787400000, 0.789651500000, 0.778205300000,
+    0.766473300000, 0.754478500000, 0.742247300000, 0.729822900000,
+    0.717252500000, 0.704581800000, 0.691855300000, 0.679100900000,
+    0.666284600000, 0.653359500000, 0.640280700000, 0.627006600000,
+    0.613514800000, 0.599849400000, 0.586068200000, 0.572226100000,
+    0.558374600000, 0.544553500000, 0.530767300000, 0.517013000000,
+    0.503288900000, 0.489595000000, 0.475944200000, 0.462395800000,
+    0.449015400000, 0.435862200000, 0.422989700000, 0.410415200000,
+    0.398035600000, 0.385730000000, 0.373390700000, 0.360924500000,
+    0.348286000000, 0.335570200000, 0.322896300000, 0.310370400000,
+    0.298086500000, 0.286116000000, 0.274482200000, 0.263195300000,
+    0.252262800000, 0.241690200000, 0.231480900000, 0.221637800000,
+    0.212162200000, 0.203054200000, 0.194312400000, 0.185922700000,
+    0.177827400000, 0.169965400000, 0.162284100000, 0.154739700000,
+    0.147308100000, 0.140016900000, 0.132901300000, 0.125991300000,
+    0.119312000000, 0.112882000000, 0.106711300000, 0.100805200000,
+    0.095166530000, 0.089795940000, 0.084690440000, 0.079840090000,
+    0.075233720000, 0.070860610000, 0.066710450000, 0.062773600000,
+    0.059041790000, 0.055507030000, 0.052161390000, 0.048996990000,
+    0.046005780000, 0.043178850000, 0.040507550000, 0.037983760000,
+    0.035599820000, 0.033348560000, 0.031223320000, 0.029217800000,
+    0.027326010000, 0.025542230000, 0.023861210000, 0.022278590000,
+    0.020790200000, 0.019391850000, 0.018079390000, 0.016848170000,
+    0.015691880000, 0.014604460000, 0.013580620000, 0.012615730000,
+    0.011706960000, 0.010856080000, 0.010064760000, 0.009333376000,
+    0.008661284000, 0.008046048000, 0.007481130000, 0.006959987000,
+    0.006477070000, 0.006027677000, 0.005608169000, 0.005216691000,
+    0.004851785000, 0.004512008000, 0.004195941000, 0.003902057000,
+    0.003628371000, 0.003373005000, 0.003134315000, 0.002910864000,
+    0.002701528000, 0.002505796000, 0.002323231000, 0.002153333000,
+    0.001995557000, 0.001849316000, 0.001713976000, 0.001588899000,
+    0.001473453000, 0.001367022000, 0.001268954000, 0.001178421000,
+    0.001094644000, 0.001016943000, 0.000944726900, 0.000877517100,
+    0.000815043800, 0.000757075500, 0.000703375500, 0.000653705000,
+    0.000607804800, 0.000565343500, 0.000526004600, 0.000489506100,
+    0.000455597000, 0.000424054800, 0.000394686000, 0.000367317800,
+    0.000341794100, 0.000317973800, 0.000295744100, 0.000275055800,
+    0.000255864000, 0.000238114200, 0.000221744500, 0.000206671100,
+    0.000192747400, 0.000179831500, 0.000167802300, 0.000156556600,
+    0.000146016800, 0.000136153500, 0.000126945100, 0.000118367100,
+    0.000110392800, 0.000102990800, 0.000096118360, 0.000089733230,
+    0.000083796940, 0.000078274420, 0.000073133120, 0.000068341420,
+    0.000063870350, 0.000059693890, 0.000055788620, 0.000052135090,
+    0.000048721790, 0.000045538450, 0.000042574430, 0.000039818840,
+    0.000037258770, 0.000034874670, 0.000032647650, 0.000030561400,
+    0.000028601750, 0.000026758410, 0.000025029430, 0.000023413730,
+    0.000021909140, 0.000020512590, 0.000019219020, 0.000018017960,
+    0.000016898990, 0.000015853090, 0.000014872430, 0.000013950850,
+    0.000013085280, 0.000012273270, 0.000011512330, 0.000010800010,
+    0.000010133640, 0.000009509919, 0.000008925630, 0.000008377852,
+    0.000007863920, 0.000007381539, 0.000006929096, 0.000006505136,
+    0.000006108221, 0.000005736935, 0.000005389831, 0.000005065269,
+    0.000004761667, 0.000004477561, 0.000004211597, 0.000003962457,
+    0.000003728674, 0.000003508881, 0.000003301868, 0.000003106561,
+    0.000002922119, 0.000002748208, 0.000002584560, 0.000002430867,
+    0.000002286786, 0.000002151905, 0.000002025656, 0.000001907464,
+    0.000001796794, 0.000001693147, 0.000001596032, 0.000001504903,
+    0.000001419245, 0.000001338600, 0.000001262556, 0.000001190771,
+    0.000001123031, 0.000001059151, 0.000000998951, 0.000000942251,
+    0.000000888880, 0.000000838669, 0.000000791454, 0.000000747077,
+    0.000000705386};
+
+constexpr float k_cie_2012_2_z[] = {
+    0.018472600000, 0.022211010000, 0.026698190000, 0.032069370000,
+    0.038478320000, 0.046097840000, 0.055119530000, 0.065752570000,
+    0.078221130000, 0.092760130000, 0.109609000000, 0.129007700000,
+    0.151204700000, 0.176444100000, 0.204951700000, 0.236924600000,
+    0.272512300000, 0.311782000000, 0.354706400000, 0.401147300000,
+    0.450836900000, 0.503416400000, 0.558636100000, 0.616273400000,
+    0.676098200000, 0.737882200000, 0.801301900000, 0.865557300000,
+    0.929579100000, 0.992129300000, 1.051821000000, 1.107509000000,
+    1.159527000000, 1.208869000000, 1.256834000000, 1.305008000000,
+    1.354758000000, 1.405594000000, 1.456414000000, 1.505960000000,
+    1.552826000000, 1.595902000000, 1.635768000000, 1.673573000000,
+    1.710604000000, 1.748280000000, 1.787504000000, 1.826609000000,
+    1.863108000000, 1.894332000000, 1.917479000000, 1.930529000000,
+    1.934819000000, 1.932650000000, 1.926395000000, 1.918437000000,
+    1.910430000000, 1.901224000000, 1.889000000000, 1.871996000000,
+    1.848545000000, 1.817792000000, 1.781627000000, 1.742514000000,
+    1.702749000000, 1.664439000000, 1.629207000000, 1.597360000000,
+    1.568896000000, 1.543823000000, 1.522157000000, 1.503611000000,
+    1.486673000000, 1.469595000000, 1.450709000000, 1.428440000000,
+    1.401587000000, 1.370094000000, 1.334220000000, 1.294275000000,
+    1.250610000000, 1.203696000000, 1.154316000000, 1.103284000000,
+    1.051347000000, 0.999178900000, 0.947395800000, 0.896622200000,
+    0.847398100000, 0.800157600000, 0.755237900000, 0.712787900000,
+    0.672519800000, 0.634097600000, 0.597243300000, 0.561731300000,
+    0.527492100000, 0.494880900000, 0.464258600000, 0.435884100000,
+    0.409931300000, 0.386426100000, 0.365056600000, 0.345481200000,
+    0.327409500000, 0.310593900000, 0.294810200000, 0.279819400000,
+    0.265410000000, 0.251408400000, 0.237675300000, 0.224121100000,
+    0.210748400000, 0.197583900000, 0.184657400000, 0.172001800000,
+    0.159691800000, 0.147941500000, 0.136942800000, 0.126827900000,
+    0.117679600000, 0.109497000000, 0.102094300000, 0.095279930000,
+    0.088900750000, 0.082835480000, 0.077009820000, 0.071440010000,
+    0.066154360000, 0.061171990000, 0.056504070000, 0.052151210000,
+    0.048095660000, 0.044317200000, 0.040797340000, 0.037519120000,
+    0.034468460000, 0.031637640000, 0.029019010000, 0.026603640000,
+    0.024381640000, 0.022340970000, 0.020464150000, 0.018734560000,
+    0.017137880000, 0.015661740000, 0.014296440000, 0.013037020000,
+    0.011878970000, 0.010817250000, 0.009846470000, 0.008960687000,
+    0.008152811000, 0.007416025000, 0.006744115000, 0.006131421000,
+    0.005572778000, 0.005063463000, 0.004599169000, 0.004175971000,
+    0.003790291000, 0.003438952000, 0.003119341000, 0.002829038000,
+    0.002565722000, 0.002327186000, 0.002111280000, 0.001915766000,
+    0.001738589000, 0.001577920000, 0.001432128000, 0.001299781000,
+    0.001179667000, 0.001070694000, 0.000971862300, 0.000882253100,
+    0.000801023100, 0.000727388400, 0.000660634700, 0.000600114600,
+    0.000545241600, 0.000495484700, 0.000450364200, 0.000409445500,
+    0.000372334500, 0.000338673900, 0.000308139600, 0.000280437000,
+    0.000255299600, 0.000232485900, 0.000211777200, 0.000192975800,
+    0.000175902400, 0.000160394700, 0.000146305900, 0.000133503100,
+    0.000121866000, 0.000111285700, 0.000101663400, 0.000092910030,
+    0.000084944680, 0.000077694250, 0.000071092470, 0.000065079360,
+    0.000059600610, 0.000054607060, 0.000050054170, 0.000045901570,
+    0.000042112680, 0.000038654370, 0.000035496610, 0.000032612200,
+    0.000029976430, 0.000027566930, 0.000025363390, 0.000023347380,
+    0.000021502210, 0.000019812680, 0.000018265000, 0.000016846670,
+    0.000015546310, 0.000014353600, 0.000013259150, 0.000012254430,
+    0.000011331690, 0.000010483870, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000};
+
+constexpr float k_cie_2012_10_x[] = {
+    0.002952420000, 0.003577275000, 0.004332146000, 0.005241609000,
+    0.006333902000, 0.007641137000, 0.009199401000, 0.011048690000,
+    0.013232620000, 0.015797910000, 0.018793380000, 0.022269490000,
+    0.026279780000, 0.030878620000, 0.036118900000, 0.042049860000,
+    0.048712560000, 0.056128680000, 0.064298660000, 0.073198180000,
+    0.082773310000, 0.092953270000, 0.103713700000, 0.115052000000,
+    0.126977100000, 0.139512700000, 0.152666100000, 0.166305400000,
+    0.180219700000, 0.194144800000, 0.207764700000, 0.220791100000,
+    0.233235500000, 0.245246200000, 0.257039700000, 0.268898900000,
+    0.281067700000, 0.293396700000, 0.305593300000, 0.317316500000,
+    0.328179800000, 0.337867800000, 0.346509700000, 0.354395300000,
+    0.361865500000, 0.369308400000, 0.377010700000, 0.384685000000,
+    0.391859100000, 0.398019200000, 0.402618900000, 0.405263700000,
+    0.406248200000, 0.406066000000, 0.405228300000, 0.404252900000,
+    0.403480800000, 0.402536200000, 0.400867500000, 0.397932700000,
+    0.393213900000, 0.386410800000, 0.377951300000, 0.368417600000,
+    0.358347300000, 0.348221400000, 0.338383000000, 0.328830900000,
+    0.319497700000, 0.310334500000, 0.301311200000, 0.292375400000,
+    0.283327300000, 0.273946300000, 0.264035200000, 0.253422100000,
+    0.242013500000, 0.229934600000, 0.217361700000, 0.204467200000,
+    0.191417600000, 0.178367200000, 0.165440700000, 0.152739100000,
+    0.140343900000, 0.128316700000, 0.116712400000, 0.105612100000,
+    0.095085690000, 0.085182060000, 0.075931200000, 0.067331590000,
+    0.059320180000, 0.051841060000, 0.044861190000, 0.038367700000,
+    0.032372960000, 0.026920950000, 0.022040700000, 0.017739510000,
+    0.014007450000, 0.010822910000, 0.008168996000, 0.006044623000,
+    0.004462638000, 0.003446810000, 0.003009513000, 0.003090744000,
+    0.003611221000, 0.004491435000, 0.005652072000, 0.007035322000,
+    0.008669631000, 0.010607550000, 0.012904680000, 0.015619560000,
+    0.018816400000, 0.022569230000, 0.026944560000, 0.031999100000,
+    0.037781850000, 0.044306350000, 0.051465160000, 0.059122240000,
+    0.067142200000, 0.075389410000, 0.083766970000, 0.092335810000,
+    0.101194000000, 0.110436200000, 0.120151100000, 0.130396000000,
+    0.141131000000, 0.152294400000, 0.163828800000, 0.175683200000,
+    0.187811400000, 0.200162100000, 0.212682200000, 0.225319900000,
+    0.238025400000, 0.250778700000, 0.263677800000, 0.276860700000,
+    0.290479200000, 0.304699100000, 0.319648500000, 0.335244700000,
+    0.351329000000, 0.367714800000, 0.384185600000, 0.400531200000,
+    0.416666900000, 0.432542000000, 0.448106300000, 0.463310900000,
+    0.478144000000, 0.492748300000, 0.507331500000, 0.522131500000,
+    0.537417000000, 0.553421700000, 0.570124200000, 0.587409300000,
+    0.605126900000, 0.623089200000, 0.641099900000, 0.659065900000,
+    0.676943600000, 0.694714300000, 0.712384900000, 0.729997800000,
+    0.747647800000, 0.765425000000, 0.783400900000, 0.801627700000,
+    0.820104100000, 0.838684300000, 0.857193600000, 0.875465200000,
+    0.893340800000, 0.910677200000, 0.927355400000, 0.943250200000,
+    0.958224400000, 0.972130400000, 0.984923700000, 0.997006700000,
+    1.008907000000, 1.021163000000, 1.034327000000, 1.048753000000,
+    1.063937000000, 1.079166000000, 1.093723000000, 1.106886000000,
+    1.118106000000, 1.127493000000, 1.135317000000, 1.141838000000,
+    1.147304000000, 1.151897000000, 1.155582000000, 1.158284000000,
+    1.159934000000, 1.160477000000, 1.159890000000, 1.158259000000,
+    1.155692000000, 1.152293000000, 1.148163000000, 1.143345000000,
+    1.137685000000, 1.130993000000, 1.123097000000, 1.113846000000,
+    1.103152000000, 1.091121000000, 1.077902000000, 1.063644000000,
+    1.048485000000, 1.032546000000, 1.015870000000, 0.998485900000,
+    0.980422700000, 0.961711100000, 0.942411900000, 0.922704900000,
+    0.902780400000, 0.882812300000, 0.862958100000, 0.843273100000,
+    0.823474200000, 0.803234200000, 0.782271500000, 0.760349800000,
+    0.737373900000, 0.713647000000, 0.689533600000, 0.665356700000,
+    0.641398400000, 0.617872300000, 0.594848400000, 0.572360000000,
+    0.550435300000, 0.529097900000, 0.508372800000, 0.488300600000,
+    0.468917100000, 0.450248600000, 0.432312600000, 0.415079000000,
+    0.398365700000, 0.381984600000, 0.365782100000, 0.349635800000,
+    0.333493700000, 0.317477600000, 0.301729800000, 0.286368400000,
+    0.271490000000, 0.257163200000, 0.243410200000, 0.230238900000,
+    0.217652700000, 0.205650700000, 0.194225100000, 0.183353000000,
+    0.173009700000, 0.163171600000, 0.153816300000, 0.144923000000,
+    0.136472900000, 0.128448300000, 0.120832000000, 0.113607200000,
+    0.106757900000, 0.100268500000, 0.094123940000, 0.088309290000,
+    0.082810100000, 0.077612080000, 0.072700640000, 0.068061670000,
+    0.063681760000, 0.059548150000, 0.055649170000, 0.051975430000,
+    0.048517880000, 0.045267370000, 0.042214730000, 0.039349540000,
+    0.036657300000, 0.034124070000, 0.031737680000, 0.029487520000,
+    0.027367170000, 0.025381130000, 0.023533560000, 0.021825580000,
+    0.020255900000, 0.018818920000, 0.017499300000, 0.016281670000,
+    0.015153010000, 0.014102300000, 0.013121060000, 0.012205090000,
+    0.011351140000, 0.010555930000, 0.009816228000, 0.009128517000,
+    0.008488116000, 0.007890589000, 0.007332061000, 0.006809147000,
+    0.006319204000, 0.005861036000, 0.005433624000, 0.005035802000,
+    0.004666298000, 0.004323750000, 0.004006709000, 0.003713708000,
+    0.003443294000, 0.003194041000, 0.002964424000, 0.002752492000,
+    0.002556406000, 0.002374564000, 0.002205568000, 0.002048294000,
+    0.001902113000, 0.001766485000, 0.001640857000, 0.001524672000,
+    0.001417322000, 0.001318031000, 0.001226059000, 0.001140743000,
+    0.001061495000, 0.000987794900, 0.000919184700, 0.000855256800,
+    0.000795643300, 0.000740012000, 0.000688098000, 0.000639786400,
+    0.000594972600, 0.000553529100, 0.000515311300, 0.000480123400,
+    0.000447624500, 0.000417484600, 0.000389422100, 0.000363196900,
+    0.000338627900, 0.000315645200, 0.000294196600, 0.000274223500,
+    0.000255662400, 0.000238439000, 0.000222452500, 0.000207603600,
+    0.000193801800, 0.000180964900, 0.000169016700, 0.000157883900,
+    0.000147499300, 0.000137802600, 0.000128739400, 0.000120264400,
+    0.000112350200, 0.000104972500, 0.000098105960, 0.000091724770,
+    0.000085798610, 0.000080281740, 0.000075130130, 0.000070305650,
+    0.000065775320, 0.000061515080, 0.000057520250, 0.000053788130,
+    0.000050313500, 0.000047089160, 0.000044103220, 0.000041331500,
+    0.000038749920, 0.000036337620, 0.000034076530, 0.000031952420,
+    0.000029958080, 0.000028087810, 0.000026335810, 0.000024696300,
+    0.000023163110, 0.000021728550, 0.000020385190, 0.000019126250,
+    0.000017945550, 0.000016837760, 0.000015799070, 0.000014826040,
+    0.000013915270, 0.000013063450, 0.000012267200, 0.000011522790,
+    0.000010826630, 0.000010175400, 0.000009565993, 0.000008995405,
+    0.000008460253, 0.000007957382, 0.000007483997, 0.000007037621,
+    0.000006616311, 0.000006219265, 0.000005845844, 0.000005495311,
+    0.000005166853, 0.000004859511, 0.000004571973, 0.000004302920,
+    0.000004051121, 0.000003815429, 0.000003594719, 0.000003387736,
+    0.000003193301, 0.000003010363, 0.000002837980, 0.000002675365,
+    0.000002522020, 0.000002377511, 0.000002241417, 0.000002113325,
+    0.000001992830, 0.000001879542, 0.000001773083, 0.000001673086,
+    0.000001579199};
+
+constexpr float k_cie_2012_10_y[] = {
+    0.000407677900, 0.000497776900, 0.000606475400, 0.000737004000,
+    0.000892938800, 0.001078166000, 0.001296816000, 0.001553159000,
+    0.001851463000, 0.002195795000, 0.002589775000, 0.003036799000,
+    0.003541926000, 0.004111422000, 0.004752618000, 0.005474207000,
+    0.006285034000, 0.007188068000, 0.008181786000, 0.009260417000,
+    0.010413030000, 0.011626420000, 0.012898840000, 0.014234420000,
+    0.015640800000, 0.017129680000, 0.018712650000, 0.020383940000,
+    0.022129350000, 0.023929850000, 0.025761330000, 0.027601560000,
+    0.029455130000, 0.031338840000, 0.033275750000, 0.035295540000,
+    0.037427050000, 0.039671370000, 0.042019980000, 0.044461660000,
+    0.046982260000, 0.049567420000, 0.052212190000, 0.054913870000,
+    0.057669190000, 0.060474290000, 0.063321950000, 0.066192710000,
+    0.069061850000, 0.071901900000, 0.074682880000, 0.077384520000,
+    0.080036010000, 0.082685240000, 0.085387450000, 0.088205370000,
+    0.091189250000, 0.094310410000, 0.097513460000, 0.100734900000,
+    0.103903000000, 0.106963900000, 0.109967600000, 0.112999200000,
+    0.116154100000, 0.119538900000, 0.123250300000, 0.127304700000,
+    0.131696400000, 0.136417800000, 0.141458600000, 0.146800300000,
+    0.152400200000, 0.158202100000, 0.164140000000, 0.170137300000,
+    0.176123300000, 0.182089600000, 0.188046300000, 0.194006500000,
+    0.199985900000, 0.206005400000, 0.212098100000, 0.218304100000,
+    0.224668600000, 0.231242600000, 0.238074100000, 0.245179800000,
+    0.252568200000, 0.260247900000, 0.268227100000, 0.276500500000,
+    0.285003500000, 0.293647500000, 0.302331900000, 0.310943800000,
+    0.319410500000, 0.327868300000, 0.336526300000, 0.345617600000,
+    0.355401800000, 0.366089300000, 0.377585700000, 0.389696000000,
+    0.402194700000, 0.414822700000, 0.427353900000, 0.439820600000,
+    0.452336000000, 0.465029800000, 0.478048200000, 0.491517300000,
+    0.505422400000, 0.519705700000, 0.534301200000, 0.549134400000,
+    0.564130200000, 0.579241600000, 0.594426400000, 0.609638800000,
+    0.624829600000, 0.639965600000, 0.655094300000, 0.670290300000,
+    0.685637500000, 0.701229200000, 0.717110300000, 0.733091700000,
+    0.748904100000, 0.764253000000, 0.778819900000, 0.792341000000,
+    0.804851000000, 0.816474700000, 0.827352000000, 0.837635800000,
+    0.847465300000, 0.856886800000, 0.865924200000, 0.874604100000,
+    0.882955200000, 0.891027400000, 0.898949500000, 0.906875300000,
+    0.914965200000, 0.923385800000, 0.932232500000, 0.941286200000,
+    0.950237800000, 0.958764700000, 0.966532500000, 0.973250400000,
+    0.978841500000, 0.983286700000, 0.986572000000, 0.988688700000,
+    0.989705600000, 0.989984900000, 0.989962400000, 0.990073100000,
+    0.990750000000, 0.992282600000, 0.994383700000, 0.996622100000,
+    0.998564900000, 0.999777500000, 0.999944000000, 0.999220000000,
+    0.997879300000, 0.996193400000, 0.994430400000, 0.992783100000,
+    0.991157800000, 0.989392500000, 0.987328800000, 0.984812700000,
+    0.981725300000, 0.978071400000, 0.973886000000, 0.969202800000,
+    0.964054500000, 0.958440900000, 0.952237900000, 0.945296800000,
+    0.937477300000, 0.928649500000, 0.918795300000, 0.908301400000,
+    0.897635200000, 0.887240100000, 0.877536000000, 0.868792000000,
+    0.860747400000, 0.853023300000, 0.845253500000, 0.837083800000,
+    0.828240900000, 0.818732000000, 0.808635200000, 0.798029600000,
+    0.786995000000, 0.775604000000, 0.763899600000, 0.751915700000,
+    0.739683200000, 0.727230900000, 0.714587800000, 0.701792600000,
+    0.688886600000, 0.675910300000, 0.662903500000, 0.649891100000,
+    0.636841000000, 0.623709200000, 0.610454100000, 0.597037500000,
+    0.583439500000, 0.569704400000, 0.555889200000, 0.542047500000,
+    0.528229600000, 0.514474600000, 0.500788100000, 0.487168700000,
+    0.473616000000, 0.460130800000, 0.446726000000, 0.433458900000,
+    0.420391900000, 0.407581000000, 0.395075500000, 0.382889400000,
+    0.370919000000, 0.359044700000, 0.347161500000, 0.335179400000,
+    0.323056200000, 0.310885900000, 0.298784000000, 0.286852700000,
+    0.275180700000, 0.263834300000, 0.252833000000, 0.242183500000,
+    0.231890400000, 0.221956400000, 0.212382600000, 0.203169800000,
+    0.194317900000, 0.185825000000, 0.177688200000, 0.169892600000,
+    0.162382200000, 0.155098600000, 0.147991800000, 0.141020300000,
+    0.134161400000, 0.127440100000, 0.120888700000, 0.114534500000,
+    0.108399600000, 0.102500700000, 0.096845880000, 0.091439440000,
+    0.086283180000, 0.081376870000, 0.076717080000, 0.072294040000,
+    0.068096960000, 0.064115490000, 0.060339760000, 0.056760540000,
+    0.053369920000, 0.050160270000, 0.047124050000, 0.044253830000,
+    0.041542050000, 0.038980420000, 0.036560910000, 0.034275970000,
+    0.032118520000, 0.030081920000, 0.028160010000, 0.026346980000,
+    0.024637310000, 0.023025740000, 0.021507430000, 0.020078380000,
+    0.018734740000, 0.017472690000, 0.016288410000, 0.015177670000,
+    0.014134730000, 0.013154080000, 0.012230920000, 0.011361060000,
+    0.010541900000, 0.009775050000, 0.009061962000, 0.008402962000,
+    0.007797457000, 0.007243230000, 0.006734381000, 0.006265001000,
+    0.005830085000, 0.005425391000, 0.005047634000, 0.004695140000,
+    0.004366592000, 0.004060685000, 0.003776140000, 0.003511578000,
+    0.003265211000, 0.003035344000, 0.002820496000, 0.002619372000,
+    0.002430960000, 0.002254796000, 0.002090489000, 0.001937586000,
+    0.001795595000, 0.001663989000, 0.001542195000, 0.001429639000,
+    0.001325752000, 0.001229980000, 0.001141734000, 0.001060269000,
+    0.000984885400, 0.000914970300, 0.000849990300, 0.000789515800,
+    0.000733303800, 0.000681145800, 0.000632828700, 0.000588137500,
+    0.000546838900, 0.000508634900, 0.000473240300, 0.000440401600,
+    0.000409892800, 0.000381513700, 0.000355090200, 0.000330466800,
+    0.000307503000, 0.000286071800, 0.000266071800, 0.000247458600,
+    0.000230191900, 0.000214222500, 0.000199494900, 0.000185933600,
+    0.000173406700, 0.000161786500, 0.000150964100, 0.000140846600,
+    0.000131364200, 0.000122490500, 0.000114206000, 0.000106488600,
+    0.000099314390, 0.000092655120, 0.000086472250, 0.000080727800,
+    0.000075387160, 0.000070418780, 0.000065793380, 0.000061482500,
+    0.000057460080, 0.000053702720, 0.000050189340, 0.000046902450,
+    0.000043831670, 0.000040967800, 0.000038301230, 0.000035822180,
+    0.000033519030, 0.000031374190, 0.000029370680, 0.000027493800,
+    0.000025730830, 0.000024072490, 0.000022517040, 0.000021063500,
+    0.000019709910, 0.000018453530, 0.000017289790, 0.000016209280,
+    0.000015202620, 0.000014261690, 0.000013379460, 0.000012550380,
+    0.000011771690, 0.000011041180, 0.000010356620, 0.000009715798,
+    0.000009116316, 0.000008555201, 0.000008029561, 0.000007536768,
+    0.000007074424, 0.000006640464, 0.000006233437, 0.000005852035,
+    0.000005494963, 0.000005160948, 0.000004848687, 0.000004556705,
+    0.000004283580, 0.000004027993, 0.000003788729, 0.000003564599,
+    0.000003354285, 0.000003156557, 0.000002970326, 0.000002794625,
+    0.000002628701, 0.000002472248, 0.000002325030, 0.000002186768,
+    0.000002057152, 0.000001935813, 0.000001822239, 0.000001715914,
+    0.000001616355, 0.000001523114, 0.000001435750, 0.000001353771,
+    0.000001276714, 0.000001204166, 0.000001135758, 0.000001071181,
+    0.000001010243, 0.000000952778, 0.000000898622, 0.000000847617,
+    0.000000799605, 0.000000754436, 0.000000711962, 0.000000672042,
+    0.000000634538};
+
+constexpr float k_cie_2012_10_z[] = {
+    0.013187520000, 0.015978790000, 0.019357580000, 0.023437580000,
+    0.028350210000, 0.034245880000, 0.041294670000, 0.049686410000,
+    0.059629640000, 0.071349260000, 0.085082540000, 0.101075300000,
+    0.119583800000, 0.140864700000, 0.165164400000, 0.192706500000,
+    0.223678200000, 0.258210900000, 0.296363200000, 0.338101800000,
+    0.383282200000, 0.431688400000, 0.483244000000, 0.537934500000,
+    0.595774000000, 0.656818700000, 0.721045900000, 0.787863500000,
+    0.856339100000, 0.925301700000, 0.993344400000, 1.059178000000,
+    1.122832000000, 1.184947000000, 1.246476000000, 1.308674000000,
+    1.372628000000, 1.437661000000, 1.502449000000, 1.565456000000,
+    1.624940000000, 1.679488000000, 1.729668000000, 1.776755000000,
+    1.822228000000, 1.867751000000, 1.914504000000, 1.961055000000,
+    2.005136000000, 2.044296000000, 2.075946000000, 2.098231000000,
+    2.112591000000, 2.121427000000, 2.127239000000, 2.132574000000,
+    2.139093000000, 2.144815000000, 2.146832000000, 2.142250000000,
+    2.128264000000, 2.103205000000, 2.069388000000, 2.030030000000,
+    1.988178000000, 1.946651000000, 1.907521000000, 1.870689000000,
+    1.835578000000, 1.801657000000, 1.768440000000, 1.735338000000,
+    1.701254000000, 1.665053000000, 1.625712000000, 1.582342000000,
+    1.534439000000, 1.482544000000, 1.427438000000, 1.369876000000,
+    1.310576000000, 1.250226000000, 1.189511000000, 1.129050000000,
+    1.069379000000, 1.010952000000, 0.954180900000, 0.899525300000,
+    0.847372000000, 0.798009300000, 0.751638900000, 0.708264500000,
+    0.667386700000, 0.628479800000, 0.591117400000, 0.554961900000,
+    0.519884300000, 0.486277200000, 0.454549700000, 0.424995500000,
+    0.397811400000, 0.373021800000, 0.350261800000, 0.329140700000,
+    0.309335600000, 0.290581600000, 0.272677300000, 0.255514300000,
+    0.239018800000, 0.223133500000, 0.207815800000, 0.193040700000,
+    0.178808900000, 0.165128700000, 0.152010300000, 0.139464300000,
+    0.127535300000, 0.116377100000, 0.106116100000, 0.096822660000,
+    0.088523890000, 0.081182630000, 0.074631320000, 0.068706440000,
+    0.063278340000, 0.058244840000, 0.053538120000, 0.049148630000,
+    0.045075110000, 0.041311750000, 0.037849160000, 0.034672340000,
+    0.031754710000, 0.029070290000, 0.026596510000, 0.024313750000,
+    0.022206770000, 0.020268520000, 0.018492460000, 0.016870840000,
+    0.015395050000, 0.014054500000, 0.012833540000, 0.011717540000,
+    0.010694150000, 0.009753000000, 0.008886096000, 0.008089323000,
+    0.007359131000, 0.006691736000, 0.006083223000, 0.005529423000,
+    0.005025504000, 0.004566879000, 0.004149405000, 0.003769336000,
+    0.003423302000, 0.003108313000, 0.002821650000, 0.002560830000,
+    0.002323578000, 0.002107847000, 0.001911867000, 0.001734006000,
+    0.001572736000, 0.001426627000, 0.001294325000, 0.001174475000,
+    0.001065842000, 0.000967321500, 0.000877926400, 0.000796784700,
+    0.000723150200, 0.000656350100, 0.000595767800, 0.000540838500,
+    0.000491044100, 0.000445904600, 0.000404982600, 0.000367881800,
+    0.000334242900, 0.000303740700, 0.000276080900, 0.000250997000,
+    0.000228247400, 0.000207612900, 0.000188894800, 0.000171912700,
+    0.000156503000, 0.000142517700, 0.000129823000, 0.000118297400,
+    0.000107831000, 0.000098324550, 0.000089687870, 0.000081839540,
+    0.000074705820, 0.000068219910, 0.000062321320, 0.000056955340,
+    0.000052072450, 0.000047627810, 0.000043580820, 0.000039894680,
+    0.000036536120, 0.000033474990, 0.000030684000, 0.000028138390,
+    0.000025815740, 0.000023695740, 0.000021759980, 0.000019991790,
+    0.000018376030, 0.000016898960, 0.000015548150, 0.000014312310,
+    0.000013181190, 0.000012145480, 0.000011196730, 0.000010327270,
+    0.000009530130, 0.000008798979, 0.000008128065, 0.000007512160,
+    0.000006946506, 0.000006426776, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
+    0.000000000000};
+} // namespace
+
 const CMF CMF::CIE_1931_2degree(CMF::CIE_1931_2_x, CMF::CIE_1931_2_y,
                                 CMF::CIE_1931_2_z);
 const CMF CMF::CIE_1964_10degree(CMF::CIE_1964_10_x, CMF::CIE_1964_10_y,
@@ -11,1921 +1413,104 @@ const CMF CMF::CIE_2012_2degree(CMF::CIE_2012_2_x, CMF::CIE_2012_2_y,
 const CMF CMF::CIE_2012_10degree(CMF::CIE_2012_10_x, CMF::CIE_2012_10_y,
                                  CMF::CIE_2012_10_z);
 
-const std::unordered_map<int, const CMF&> CMF::_cmf_map{
-    {int(CMF::ID::CIE_1931_2degree), CMF::CIE_1931_2degree},
-    {int(CMF::ID::CIE_1964_10degree), CMF::CIE_1964_10degree},
-    {int(CMF::ID::CIE_2012_2degree), CMF::CIE_2012_2degree},
-    {int(CMF::ID::CIE_2012_10degree), CMF::CIE_2012_10degree}
+namespace {
+const char* const k_names[CMF::num_builtin] = {
+    "CIE_1931_2degree", "CIE_1964_10degree", "CIE_2012_2degree",
+    "CIE_2012_10degree"};
+
+// a CMF that owns its curves
+struct AddedCMF {
+    AddedCMF(SPD x, SPD y, SPD z)
+        : x_bar(std::move(x)), y_bar(std::move(y)), z_bar(std::move(z)),
+          cmf(x_bar, y_bar, z_bar) {}
+
+    const SPD x_bar;
+    const SPD y_bar;
+    const SPD z_bar;
+    const CMF cmf;
 };
 
-const SPD CMF::CIE_1931_2_x(
-    {360.000000, 361.000000, 362.000000, 363.000000, 364.000000, 365.000000,
-     366.000000, 367.000000, 368.000000, 369.000000, 370.000000, 371.000000,
-     372.000000, 373.000000, 374.000000, 375.000000, 376.000000, 377.000000,
-     378.000000, 379.000000, 380.000000, 381.000000, 382.000000, 383.000000,
-     384.000000, 385.000000, 386.000000, 387.000000, 388.000000, 389.000000,
-     390.000000, 391.000000, 392.000000, 393.000000, 394.000000, 395.000000,
-     396.000000, 397.000000, 398.000000, 399.000000, 400.000000, 401.000000,
-     402.000000, 403.000000, 404.000000, 405.000000, 406.000000, 407.000000,
-     408.000000, 409.000000, 410.000000, 411.000000, 412.000000, 413.000000,
-     414.000000, 415.000000, 416.000000, 417.000000, 418.000000, 419.000000,
-     420.000000, 421.000000, 422.000000, 423.000000, 424.000000, 425.000000,
-     426.000000, 427.000000, 428.000000, 429.000000, 430.000000, 431.000000,
-     432.000000, 433.000000, 434.000000, 435.000000, 436.000000, 437.000000,
-     438.000000, 439.000000, 440.000000, 441.000000, 442.000000, 443.000000,
-     444.000000, 445.000000, 446.000000, 447.000000, 448.000000, 449.000000,
-     450.000000, 451.000000, 452.000000, 453.000000, 454.000000, 455.000000,
-     456.000000, 457.000000, 458.000000, 459.000000, 460.000000, 461.000000,
-     462.000000, 463.000000, 464.000000, 465.000000, 466.000000, 467.000000,
-     468.000000, 469.000000, 470.000000, 471.000000, 472.000000, 473.000000,
-     474.000000, 475.000000, 476.000000, 477.000000, 478.000000, 479.000000,
-     480.000000, 481.000000, 482.000000, 483.000000, 484.000000, 485.000000,
-     486.000000, 487.000000, 488.000000, 489.000000, 490.000000, 491.000000,
-     492.000000, 493.000000, 494.000000, 495.000000, 496.000000, 497.000000,
-     498.000000, 499.000000, 500.000000, 501.000000, 502.000000, 503.000000,
-     504.000000, 505.000000, 506.000000, 507.000000, 508.000000, 509.000000,
-     510.000000, 511.000000, 512.000000, 513.000000, 514.000000, 515.000000,
-     516.000000, 517.000000, 518.000000, 519.000000, 520.000000, 521.000000,
-     522.000000, 523.000000, 524.000000, 525.000000, 526.000000, 527.000000,
-     528.000000, 529.000000, 530.000000, 531.000000, 532.000000, 533.000000,
-     534.000000, 535.000000, 536.000000, 537.000000, 538.000000, 539.000000,
-     540.000000, 541.000000, 542.000000, 543.000000, 544.000000, 545.000000,
-     546.000000, 547.000000, 548.000000, 549.000000, 550.000000, 551.000000,
-     552.000000, 553.000000, 554.000000, 555.000000, 556.000000, 557.000000,
-     558.000000, 559.000000, 560.000000, 561.000000, 562.000000, 563.000000,
-     564.000000, 565.000000, 566.000000, 567.000000, 568.000000, 569.000000,
-     570.000000, 571.000000, 572.000000, 573.000000, 574.000000, 575.000000,
-     576.000000, 577.000000, 578.000000, 579.000000, 580.000000, 581.000000,
-     582.000000, 583.000000, 584.000000, 585.000000, 586.000000, 587.000000,
-     588.000000, 589.000000, 590.000000, 591.000000, 592.000000, 593.000000,
-     594.000000, 595.000000, 596.000000, 597.000000, 598.000000, 599.000000,
-     600.000000, 601.000000, 602.000000, 603.000000, 604.000000, 605.000000,
-     606.000000, 607.000000, 608.000000, 609.000000, 610.000000, 611.000000,
-     612.000000, 613.000000, 614.000000, 615.000000, 616.000000, 617.000000,
-     618.000000, 619.000000, 620.000000, 621.000000, 622.000000, 623.000000,
-     624.000000, 625.000000, 626.000000, 627.000000, 628.000000, 629.000000,
-     630.000000, 631.000000, 632.000000, 633.000000, 634.000000, 635.000000,
-     636.000000, 637.000000, 638.000000, 639.000000, 640.000000, 641.000000,
-     642.000000, 643.000000, 644.000000, 645.000000, 646.000000, 647.000000,
-     648.000000, 649.000000, 650.000000, 651.000000, 652.000000, 653.000000,
-     654.000000, 655.000000, 656.000000, 657.000000, 658.000000, 659.000000,
-     660.000000, 661.000000, 662.000000, 663.000000, 664.000000, 665.000000,
-     666.000000, 667.000000, 668.000000, 669.000000, 670.000000, 671.000000,
-     672.000000, 673.000000, 674.000000, 675.000000, 676.000000, 677.000000,
-     678.000000, 679.000000, 680.000000, 681.000000, 682.000000, 683.000000,
-     684.000000, 685.000000, 686.000000, 687.000000, 688.000000, 689.000000,
-     690.000000, 691.000000, 692.000000, 693.000000, 694.000000, 695.000000,
-     696.000000, 697.000000, 698.000000, 699.000000, 700.000000, 701.000000,
-     702.000000, 703.000000, 704.000000, 705.000000, 706.000000, 707.000000,
-     708.000000, 709.000000, 710.000000, 711.000000, 712.000000, 713.000000,
-     714.000000, 715.000000, 716.000000, 717.000000, 718.000000, 719.000000,
-     720.000000, 721.000000, 722.000000, 723.000000, 724.000000, 725.000000,
-     726.000000, 727.000000, 728.000000, 729.000000, 730.000000, 731.000000,
-     732.000000, 733.000000, 734.000000, 735.000000, 736.000000, 737.000000,
-     738.000000, 739.000000, 740.000000, 741.000000, 742.000000, 743.000000,
-     744.000000, 745.000000, 746.000000, 747.000000, 748.000000, 749.000000,
-     750.000000, 751.000000, 752.000000, 753.000000, 754.000000, 755.000000,
-     756.000000, 757.000000, 758.000000, 759.000000, 760.000000, 761.000000,
-     762.000000, 763.000000, 764.000000, 765.000000, 766.000000, 767.000000,
-     768.000000, 769.000000, 770.000000, 771.000000, 772.000000, 773.000000,
-     774.000000, 775.000000, 776.000000, 777.000000, 778.000000, 779.000000,
-     780.000000, 781.000000, 782.000000, 783.000000, 784.000000, 785.000000,
-     786.000000, 787.000000, 788.000000, 789.000000, 790.000000, 791.000000,
-     792.000000, 793.000000, 794.000000, 795.000000, 796.000000, 797.000000,
-     798.000000, 799.000000, 800.000000, 801.000000, 802.000000, 803.000000,
-     804.000000, 805.000000, 806.000000, 807.000000, 808.000000, 809.000000,
-     810.000000, 811.000000, 812.000000, 813.000000, 814.000000, 815.000000,
-     816.000000, 817.000000, 818.000000, 819.000000, 820.000000, 821.000000,
-     822.000000, 823.000000, 824.000000, 825.000000, 826.000000, 827.000000,
-     828.000000, 829.000000, 830.000000},
-    {0.000129900000, 0.000145847000, 0.000163802100, 0.000184003700,
-     0.000206690200, 0.000232100000, 0.000260728000, 0.000293075000,
-     0.000329388000, 0.000369914000, 0.000414900000, 0.000464158700,
-     0.000518986000, 0.000581854000, 0.000655234700, 0.000741600000,
-     0.000845029600, 0.000964526800, 0.001094949000, 0.001231154000,
-     0.001368000000, 0.001502050000, 0.001642328000, 0.001802382000,
-     0.001995757000, 0.002236000000, 0.002535385000, 0.002892603000,
-     0.003300829000, 0.003753236000, 0.004243000000, 0.004762389000,
-     0.005330048000, 0.005978712000, 0.006741117000, 0.007650000000,
-     0.008751373000, 0.010028880000, 0.011421700000, 0.012869010000,
-     0.014310000000, 0.015704430000, 0.017147440000, 0.018781220000,
-     0.020748010000, 0.023190000000, 0.026207360000, 0.029782480000,
-     0.033880920000, 0.038468240000, 0.043510000000, 0.048995600000,
-     0.055022600000, 0.061718800000, 0.069212000000, 0.077630000000,
-     0.086958110000, 0.097176720000, 0.108406300000, 0.120767200000,
-     0.134380000000, 0.149358200000, 0.165395700000, 0.181983100000,
-     0.198611000000, 0.214770000000, 0.230186800000, 0.244879700000,
-     0.258777300000, 0.271807900000, 0.283900000000, 0.294943800000,
-     0.304896500000, 0.313787300000, 0.321645400000, 0.328500000000,
-     0.334351300000, 0.339210100000, 0.343121300000, 0.346129600000,
-     0.348280000000, 0.349599900000, 0.350147400000, 0.350013000000,
-     0.349287000000, 0.348060000000, 0.346373300000, 0.344262400000,
-     0.341808800000, 0.339094100000, 0.336200000000, 0.333197700000,
-     0.330041100000, 0.326635700000, 0.322886800000, 0.318700000000,
-     0.314025100000, 0.308884000000, 0.303290400000, 0.297257900000,
-     0.290800000000, 0.283970100000, 0.276721400000, 0.268917800000,
-     0.260422700000, 0.251100000000, 0.240847500000, 0.229851200000,
-     0.218407200000, 0.206811500000, 0.195360000000, 0.184213600000,
-     0.173327300000, 0.162688100000, 0.152283300000, 0.142100000000,
-     0.132178600000, 0.122569600000, 0.113275200000, 0.104297900000,
-     0.095640000000, 0.087299550000, 0.079308040000, 0.071717760000,
-     0.064580990000, 0.057950010000, 0.051862110000, 0.046281520000,
-     0.041150880000, 0.036412830000, 0.032010000000, 0.027917200000,
-     0.024144400000, 0.020687000000, 0.017540400000, 0.014700000000,
-     0.012161790000, 0.009919960000, 0.007967240000, 0.006296346000,
-     0.004900000000, 0.003777173000, 0.002945320000, 0.002424880000,
-     0.002236293000, 0.002400000000, 0.002925520000, 0.003836560000,
-     0.005174840000, 0.006982080000, 0.009300000000, 0.012149490000,
-     0.015535880000, 0.019477520000, 0.023992770000, 0.029100000000,
-     0.034814850000, 0.041120160000, 0.047985040000, 0.055378610000,
-     0.063270000000, 0.071635010000, 0.080462240000, 0.089739960000,
-     0.099456450000, 0.109600000000, 0.120167400000, 0.131114500000,
-     0.142367900000, 0.153854200000, 0.165500000000, 0.177257100000,
-     0.189140000000, 0.201169400000, 0.213365800000, 0.225749900000,
-     0.238320900000, 0.251066800000, 0.263992200000, 0.277101700000,
-     0.290400000000, 0.303891200000, 0.317572600000, 0.331438400000,
-     0.345482800000, 0.359700000000, 0.374083900000, 0.388639600000,
-     0.403378400000, 0.418311500000, 0.433449900000, 0.448795300000,
-     0.464336000000, 0.480064000000, 0.495971300000, 0.512050100000,
-     0.528295900000, 0.544691600000, 0.561209400000, 0.577821500000,
-     0.594500000000, 0.611220900000, 0.627975800000, 0.644760200000,
-     0.661569700000, 0.678400000000, 0.695239200000, 0.712058600000,
-     0.728828400000, 0.745518800000, 0.762100000000, 0.778543200000,
-     0.794825600000, 0.810926400000, 0.826824800000, 0.842500000000,
-     0.857932500000, 0.873081600000, 0.887894400000, 0.902318100000,
-     0.916300000000, 0.929799500000, 0.942798400000, 0.955277600000,
-     0.967217900000, 0.978600000000, 0.989385600000, 0.999548800000,
-     1.009089200000, 1.018006400000, 1.026300000000, 1.033982700000,
-     1.040986000000, 1.047188000000, 1.052466700000, 1.056700000000,
-     1.059794400000, 1.061799200000, 1.062806800000, 1.062909600000,
-     1.062200000000, 1.060735200000, 1.058443600000, 1.055224400000,
-     1.050976800000, 1.045600000000, 1.039036900000, 1.031360800000,
-     1.022666200000, 1.013047700000, 1.002600000000, 0.991367500000,
-     0.979331400000, 0.966491600000, 0.952847900000, 0.938400000000,
-     0.923194000000, 0.907244000000, 0.890502000000, 0.872920000000,
-     0.854449900000, 0.835084000000, 0.814946000000, 0.794186000000,
-     0.772954000000, 0.751400000000, 0.729583600000, 0.707588800000,
-     0.685602200000, 0.663810400000, 0.642400000000, 0.621514900000,
-     0.601113800000, 0.581105200000, 0.561397700000, 0.541900000000,
-     0.522599500000, 0.503546400000, 0.484743600000, 0.466193900000,
-     0.447900000000, 0.429861300000, 0.412098000000, 0.394644000000,
-     0.377533300000, 0.360800000000, 0.344456300000, 0.328516800000,
-     0.313019200000, 0.298001100000, 0.283500000000, 0.269544800000,
-     0.256118400000, 0.243189600000, 0.230727200000, 0.218700000000,
-     0.207097100000, 0.195923200000, 0.185170800000, 0.174832300000,
-     0.164900000000, 0.155366700000, 0.146230000000, 0.137490000000,
-     0.129146700000, 0.121200000000, 0.113639700000, 0.106465000000,
-     0.099690440000, 0.093330610000, 0.087400000000, 0.081900960000,
-     0.076804280000, 0.072077120000, 0.067686640000, 0.063600000000,
-     0.059806850000, 0.056282160000, 0.052971040000, 0.049818610000,
-     0.046770000000, 0.043784050000, 0.040875360000, 0.038072640000,
-     0.035404610000, 0.032900000000, 0.030564190000, 0.028380560000,
-     0.026344840000, 0.024452750000, 0.022700000000, 0.021084290000,
-     0.019599880000, 0.018237320000, 0.016987170000, 0.015840000000,
-     0.014790640000, 0.013831320000, 0.012948680000, 0.012129200000,
-     0.011359160000, 0.010629350000, 0.009938846000, 0.009288422000,
-     0.008678854000, 0.008110916000, 0.007582388000, 0.007088746000,
-     0.006627313000, 0.006195408000, 0.005790346000, 0.005409826000,
-     0.005052583000, 0.004717512000, 0.004403507000, 0.004109457000,
-     0.003833913000, 0.003575748000, 0.003334342000, 0.003109075000,
-     0.002899327000, 0.002704348000, 0.002523020000, 0.002354168000,
-     0.002196616000, 0.002049190000, 0.001910960000, 0.001781438000,
-     0.001660110000, 0.001546459000, 0.001439971000, 0.001340042000,
-     0.001246275000, 0.001158471000, 0.001076430000, 0.000999949300,
-     0.000928735800, 0.000862433200, 0.000800750300, 0.000743396000,
-     0.000690078600, 0.000640515600, 0.000594502100, 0.000551864600,
-     0.000512429000, 0.000476021300, 0.000442453600, 0.000411511700,
-     0.000382981400, 0.000356649100, 0.000332301100, 0.000309758600,
-     0.000288887100, 0.000269539400, 0.000251568200, 0.000234826100,
-     0.000219171000, 0.000204525800, 0.000190840500, 0.000178065400,
-     0.000166150500, 0.000155023600, 0.000144621900, 0.000134909800,
-     0.000125852000, 0.000117413000, 0.000109551500, 0.000102224500,
-     0.000095394450, 0.000089023900, 0.000083075270, 0.000077512690,
-     0.000072313040, 0.000067457780, 0.000062928440, 0.000058706520,
-     0.000054770280, 0.000051099180, 0.000047676540, 0.000044485670,
-     0.000041509940, 0.000038733240, 0.000036142030, 0.000033723520,
-     0.000031464870, 0.000029353260, 0.000027375730, 0.000025524330,
-     0.000023793760, 0.000022178700, 0.000020673830, 0.000019272260,
-     0.000017966400, 0.000016749910, 0.000015616480, 0.000014559770,
-     0.000013573870, 0.000012654360, 0.000011797230, 0.000010998440,
-     0.000010253980, 0.000009559646, 0.000008912044, 0.000008308358,
-     0.000007745769, 0.000007221456, 0.000006732475, 0.000006276423,
-     0.000005851304, 0.000005455118, 0.000005085868, 0.000004741466,
-     0.000004420236, 0.000004120783, 0.000003841716, 0.000003581652,
-     0.000003339127, 0.000003112949, 0.000002902121, 0.000002705645,
-     0.000002522525, 0.000002351726, 0.000002192415, 0.000002043902,
-     0.000001905497, 0.000001776509, 0.000001656215, 0.000001544022,
-     0.000001439440, 0.000001341977, 0.000001251141});
+auto registry() -> detail::Registry<AddedCMF>& {
+    static detail::Registry<AddedCMF> r;
+    return r;
+}
+} // namespace
+
+constexpr int CMF::num_builtin;
+
+namespace detail {
+auto added_cmf(CMF::ID id) -> const CMF& {
+    if (int(id) < CMF::num_builtin) {
+        throw std::out_of_range(fmt::format("unknown CMF id {}", int(id)));
+    }
+    return registry().at(size_t(id) - CMF::num_builtin).value.cmf;
+}
+} // namespace detail
+
+auto CMF::name(ID id) -> const char* {
+    if (unsigned(id) < unsigned(num_builtin)) {
+        return k_names[int(id)];
+    }
+    if (int(id) < 0) {
+        throw std::out_of_range(fmt::format("unknown CMF id {}", int(id)));
+    }
+    return registry().at(size_t(id) - num_builtin).name.c_str();
+}
+
+auto CMF::add(std::string name, SPD x_bar, SPD y_bar, SPD z_bar) -> ID {
+    const size_t i = registry().add(std::move(name), std::move(x_bar),
+                                    std::move(y_bar), std::move(z_bar));
+    return ID(num_builtin + int(i));
+}
+
+auto CMF::find(const std::string& name, ID& id) -> bool {
+    for (int i = 0; i < num_builtin; ++i) {
+        if (name == k_names[i]) {
+            id = ID(i);
+            return true;
+        }
+    }
+    size_t i;
+    if (!registry().find(name, i)) {
+        return false;
+    }
+    id = ID(num_builtin + int(i));
+    return true;
+}
+
+const SPD CMF::CIE_1931_2_x(detail::static_samples,
+                            k_cie_1931_2_x, 360.0f, 1.0f);
 
-const SPD CMF::CIE_1931_2_y(
-    {360.000000, 361.000000, 362.000000, 363.000000, 364.000000, 365.000000,
-     366.000000, 367.000000, 368.000000, 369.000000, 370.000000, 371.000000,
-     372.000000, 373.000000, 374.000000, 375.000000, 376.000000, 377.000000,
-     378.000000, 379.000000, 380.000000, 381.000000, 382.000000, 383.000000,
-     384.000000, 385.000000, 386.000000, 387.000000, 388.000000, 389.000000,
-     390.000000, 391.000000, 392.000000, 393.000000, 394.000000, 395.000000,
-     396.000000, 397.000000, 398.000000, 399.000000, 400.000000, 401.000000,
-     402.000000, 403.000000, 404.000000, 405.000000, 406.000000, 407.000000,
-     408.000000, 409.000000, 410.000000, 411.000000, 412.000000, 413.000000,
-     414.000000, 415.000000, 416.000000, 417.000000, 418.000000, 419.000000,
-     420.000000, 421.000000, 422.000000, 423.000000, 424.000000, 425.000000,
-     426.000000, 427.000000, 428.000000, 429.000000, 430.000000, 431.000000,
-     432.000000, 433.000000, 434.000000, 435.000000, 436.000000, 437.000000,
-     438.000000, 439.000000, 440.000000, 441.000000, 442.000000, 443.000000,
-     444.000000, 445.000000, 446.000000, 447.000000, 448.000000, 449.000000,
-     450.000000, 451.000000, 452.000000, 453.000000, 454.000000, 455.000000,
-     456.000000, 457.000000, 458.000000, 459.000000, 460.000000, 461.000000,
-     462.000000, 463.000000, 464.000000, 465.000000, 466.000000, 467.000000,
-     468.000000, 469.000000, 470.000000, 471.000000, 472.000000, 473.000000,
-     474.000000, 475.000000, 476.000000, 477.000000, 478.000000, 479.000000,
-     480.000000, 481.000000, 482.000000, 483.000000, 484.000000, 485.000000,
-     486.000000, 487.000000, 488.000000, 489.000000, 490.000000, 491.000000,
-     492.000000, 493.000000, 494.000000, 495.000000, 496.000000, 497.000000,
-     498.000000, 499.000000, 500.000000, 501.000000, 502.000000, 503.000000,
-     504.000000, 505.000000, 506.000000, 507.000000, 508.000000, 509.000000,
-     510.000000, 511.000000, 512.000000, 513.000000, 514.000000, 515.000000,
-     516.000000, 517.000000, 518.000000, 519.000000, 520.000000, 521.000000,
-     522.000000, 523.000000, 524.000000, 525.000000, 526.000000, 527.000000,
-     528.000000, 529.000000, 530.000000, 531.000000, 532.000000, 533.000000,
-     534.000000, 535.000000, 536.000000, 537.000000, 538.000000, 539.000000,
-     540.000000, 541.000000, 542.000000, 543.000000, 544.000000, 545.000000,
-     546.000000, 547.000000, 548.000000, 549.000000, 550.000000, 551.000000,
-     552.000000, 553.000000, 554.000000, 555.000000, 556.000000, 557.000000,
-     558.000000, 559.000000, 560.000000, 561.000000, 562.000000, 563.000000,
-     564.000000, 565.000000, 566.000000, 567.000000, 568.000000, 569.000000,
-     570.000000, 571.000000, 572.000000, 573.000000, 574.000000, 575.000000,
-     576.000000, 577.000000, 578.000000, 579.000000, 580.000000, 581.000000,
-     582.000000, 583.000000, 584.000000, 585.000000, 586.000000, 587.000000,
-     588.000000, 589.000000, 590.000000, 591.000000, 592.000000, 593.000000,
-     594.000000, 595.000000, 596.000000, 597.000000, 598.000000, 599.000000,
-     600.000000, 601.000000, 602.000000, 603.000000, 604.000000, 605.000000,
-     606.000000, 607.000000, 608.000000, 609.000000, 610.000000, 611.000000,
-     612.000000, 613.000000, 614.000000, 615.000000, 616.000000, 617.000000,
-     618.000000, 619.000000, 620.000000, 621.000000, 622.000000, 623.000000,
-     624.000000, 625.000000, 626.000000, 627.000000, 628.000000, 629.000000,
-     630.000000, 631.000000, 632.000000, 633.000000, 634.000000, 635.000000,
-     636.000000, 637.000000, 638.000000, 639.000000, 640.000000, 641.000000,
-     642.000000, 643.000000, 644.000000, 645.000000, 646.000000, 647.000000,
-     648.000000, 649.000000, 650.000000, 651.000000, 652.000000, 653.000000,
-     654.000000, 655.000000, 656.000000, 657.000000, 658.000000, 659.000000,
-     660.000000, 661.000000, 662.000000, 663.000000, 664.000000, 665.000000,
-     666.000000, 667.000000, 668.000000, 669.000000, 670.000000, 671.000000,
-     672.000000, 673.000000, 674.000000, 675.000000, 676.000000, 677.000000,
-     678.000000, 679.000000, 680.000000, 681.000000, 682.000000, 683.000000,
-     684.000000, 685.000000, 686.000000, 687.000000, 688.000000, 689.000000,
-     690.000000, 691.000000, 692.000000, 693.000000, 694.000000, 695.000000,
-     696.000000, 697.000000, 698.000000, 699.000000, 700.000000, 701.000000,
-     702.000000, 703.000000, 704.000000, 705.000000, 706.000000, 707.000000,
-     708.000000, 709.000000, 710.000000, 711.000000, 712.000000, 713.000000,
-     714.000000, 715.000000, 716.000000, 717.000000, 718.000000, 719.000000,
-     720.000000, 721.000000, 722.000000, 723.000000, 724.000000, 725.000000,
-     726.000000, 727.000000, 728.000000, 729.000000, 730.000000, 731.000000,
-     732.000000, 733.000000, 734.000000, 735.000000, 736.000000, 737.000000,
-     738.000000, 739.000000, 740.000000, 741.000000, 742.000000, 743.000000,
-     744.000000, 745.000000, 746.000000, 747.000000, 748.000000, 749.000000,
-     750.000000, 751.000000, 752.000000, 753.000000, 754.000000, 755.000000,
-     756.000000, 757.000000, 758.000000, 759.000000, 760.000000, 761.000000,
-     762.000000, 763.000000, 764.000000, 765.000000, 766.000000, 767.000000,
-     768.000000, 769.000000, 770.000000, 771.000000, 772.000000, 773.000000,
-     774.000000, 775.000000, 776.000000, 777.000000, 778.000000, 779.000000,
-     780.000000, 781.000000, 782.000000, 783.000000, 784.000000, 785.000000,
-     786.000000, 787.000000, 788.000000, 789.000000, 790.000000, 791.000000,
-     792.000000, 793.000000, 794.000000, 795.000000, 796.000000, 797.000000,
-     798.000000, 799.000000, 800.000000, 801.000000, 802.000000, 803.000000,
-     804.000000, 805.000000, 806.000000, 807.000000, 808.000000, 809.000000,
-     810.000000, 811.000000, 812.000000, 813.000000, 814.000000, 815.000000,
-     816.000000, 817.000000, 818.000000, 819.000000, 820.000000, 821.000000,
-     822.000000, 823.000000, 824.000000, 825.000000, 826.000000, 827.000000,
-     828.000000, 829.000000, 830.000000},
-    {0.000003917000, 0.000004393581, 0.000004929604, 0.000005532136,
-     0.000006208245, 0.000006965000, 0.000007813219, 0.000008767336,
-     0.000009839844, 0.000011043230, 0.000012390000, 0.000013886410,
-     0.000015557280, 0.000017442960, 0.000019583750, 0.000022020000,
-     0.000024839650, 0.000028041260, 0.000031531040, 0.000035215210,
-     0.000039000000, 0.000042826400, 0.000046914600, 0.000051589600,
-     0.000057176400, 0.000064000000, 0.000072344210, 0.000082212240,
-     0.000093508160, 0.000106136100, 0.000120000000, 0.000134984000,
-     0.000151492000, 0.000170208000, 0.000191816000, 0.000217000000,
-     0.000246906700, 0.000281240000, 0.000318520000, 0.000357266700,
-     0.000396000000, 0.000433714700, 0.000473024000, 0.000517876000,
-     0.000572218700, 0.000640000000, 0.000724560000, 0.000825500000,
-     0.000941160000, 0.001069880000, 0.001210000000, 0.001362091000,
-     0.001530752000, 0.001720368000, 0.001935323000, 0.002180000000,
-     0.002454800000, 0.002764000000, 0.003117800000, 0.003526400000,
-     0.004000000000, 0.004546240000, 0.005159320000, 0.005829280000,
-     0.006546160000, 0.007300000000, 0.008086507000, 0.008908720000,
-     0.009767680000, 0.010664430000, 0.011600000000, 0.012573170000,
-     0.013582720000, 0.014629680000, 0.015715090000, 0.016840000000,
-     0.018007360000, 0.019214480000, 0.020453920000, 0.021718240000,
-     0.023000000000, 0.024294610000, 0.025610240000, 0.026958570000,
-     0.028351250000, 0.029800000000, 0.031310830000, 0.032883680000,
-     0.034521120000, 0.036225710000, 0.038000000000, 0.039846670000,
-     0.041768000000, 0.043766000000, 0.045842670000, 0.048000000000,
-     0.050243680000, 0.052573040000, 0.054980560000, 0.057458720000,
-     0.060000000000, 0.062601970000, 0.065277520000, 0.068042080000,
-     0.070911090000, 0.073900000000, 0.077016000000, 0.080266400000,
-     0.083666800000, 0.087232800000, 0.090980000000, 0.094917550000,
-     0.099045840000, 0.103367400000, 0.107884600000, 0.112600000000,
-     0.117532000000, 0.122674400000, 0.127992800000, 0.133452800000,
-     0.139020000000, 0.144676400000, 0.150469300000, 0.156461900000,
-     0.162717700000, 0.169300000000, 0.176243100000, 0.183558100000,
-     0.191273500000, 0.199418000000, 0.208020000000, 0.217119900000,
-     0.226734500000, 0.236857100000, 0.247481200000, 0.258600000000,
-     0.270184900000, 0.282293900000, 0.295050500000, 0.308578000000,
-     0.323000000000, 0.338402100000, 0.354685800000, 0.371698600000,
-     0.389287500000, 0.407300000000, 0.425629900000, 0.444309600000,
-     0.463394400000, 0.482939500000, 0.503000000000, 0.523569300000,
-     0.544512000000, 0.565690000000, 0.586965300000, 0.608200000000,
-     0.629345600000, 0.650306800000, 0.670875200000, 0.690842400000,
-     0.710000000000, 0.728185200000, 0.745463600000, 0.761969400000,
-     0.777836800000, 0.793200000000, 0.808110400000, 0.822496200000,
-     0.836306800000, 0.849491600000, 0.862000000000, 0.873810800000,
-     0.884962400000, 0.895493600000, 0.905443200000, 0.914850100000,
-     0.923734800000, 0.932092400000, 0.939922600000, 0.947225200000,
-     0.954000000000, 0.960256100000, 0.966007400000, 0.971260600000,
-     0.976022500000, 0.980300000000, 0.984092400000, 0.987418200000,
-     0.990312800000, 0.992811600000, 0.994950100000, 0.996710800000,
-     0.998098300000, 0.999112000000, 0.999748200000, 1.000000000000,
-     0.999856700000, 0.999304600000, 0.998325500000, 0.996898700000,
-     0.995000000000, 0.992600500000, 0.989742600000, 0.986444400000,
-     0.982724100000, 0.978600000000, 0.974083700000, 0.969171200000,
-     0.963856800000, 0.958134900000, 0.952000000000, 0.945450400000,
-     0.938499200000, 0.931162800000, 0.923457600000, 0.915400000000,
-     0.907006400000, 0.898277200000, 0.889204800000, 0.879781600000,
-     0.870000000000, 0.859861300000, 0.849392000000, 0.838622000000,
-     0.827581300000, 0.816300000000, 0.804794700000, 0.793082000000,
-     0.781192000000, 0.769154700000, 0.757000000000, 0.744754100000,
-     0.732422400000, 0.720003600000, 0.707496500000, 0.694900000000,
-     0.682219200000, 0.669471600000, 0.656674400000, 0.643844800000,
-     0.631000000000, 0.618155500000, 0.605314400000, 0.592475600000,
-     0.579637900000, 0.566800000000, 0.553961100000, 0.541137200000,
-     0.528352800000, 0.515632300000, 0.503000000000, 0.490468800000,
-     0.478030400000, 0.465677600000, 0.453403200000, 0.441200000000,
-     0.429080000000, 0.417036000000, 0.405032000000, 0.393032000000,
-     0.381000000000, 0.368918400000, 0.356827200000, 0.344776800000,
-     0.332817600000, 0.321000000000, 0.309338100000, 0.297850400000,
-     0.286593600000, 0.275624500000, 0.265000000000, 0.254763200000,
-     0.244889600000, 0.235334400000, 0.226052800000, 0.217000000000,
-     0.208161600000, 0.199548800000, 0.191155200000, 0.182974400000,
-     0.175000000000, 0.167223500000, 0.159646400000, 0.152277600000,
-     0.145125900000, 0.138200000000, 0.131500300000, 0.125024800000,
-     0.118779200000, 0.112769100000, 0.107000000000, 0.101476200000,
-     0.096188640000, 0.091122960000, 0.086264850000, 0.081600000000,
-     0.077120640000, 0.072825520000, 0.068710080000, 0.064769760000,
-     0.061000000000, 0.057396210000, 0.053955040000, 0.050673760000,
-     0.047549650000, 0.044580000000, 0.041758720000, 0.039084960000,
-     0.036563840000, 0.034200480000, 0.032000000000, 0.029962610000,
-     0.028076640000, 0.026329360000, 0.024708050000, 0.023200000000,
-     0.021800770000, 0.020501120000, 0.019281080000, 0.018120690000,
-     0.017000000000, 0.015903790000, 0.014837180000, 0.013810680000,
-     0.012834780000, 0.011920000000, 0.011068310000, 0.010273390000,
-     0.009533311000, 0.008846157000, 0.008210000000, 0.007623781000,
-     0.007085424000, 0.006591476000, 0.006138485000, 0.005723000000,
-     0.005343059000, 0.004995796000, 0.004676404000, 0.004380075000,
-     0.004102000000, 0.003838453000, 0.003589099000, 0.003354219000,
-     0.003134093000, 0.002929000000, 0.002738139000, 0.002559876000,
-     0.002393244000, 0.002237275000, 0.002091000000, 0.001953587000,
-     0.001824580000, 0.001703580000, 0.001590187000, 0.001484000000,
-     0.001384496000, 0.001291268000, 0.001204092000, 0.001122744000,
-     0.001047000000, 0.000976589600, 0.000911108800, 0.000850133200,
-     0.000793238400, 0.000740000000, 0.000690082700, 0.000643310000,
-     0.000599496000, 0.000558454700, 0.000520000000, 0.000483913600,
-     0.000450052800, 0.000418345200, 0.000388718400, 0.000361100000,
-     0.000335383500, 0.000311440400, 0.000289165600, 0.000268453900,
-     0.000249200000, 0.000231301900, 0.000214685600, 0.000199288400,
-     0.000185047500, 0.000171900000, 0.000159778100, 0.000148604400,
-     0.000138301600, 0.000128792500, 0.000120000000, 0.000111859500,
-     0.000104322400, 0.000097335600, 0.000090845870, 0.000084800000,
-     0.000079146670, 0.000073858000, 0.000068916000, 0.000064302670,
-     0.000060000000, 0.000055981870, 0.000052225600, 0.000048718400,
-     0.000045447470, 0.000042400000, 0.000039561040, 0.000036915120,
-     0.000034448680, 0.000032148160, 0.000030000000, 0.000027991250,
-     0.000026113560, 0.000024360240, 0.000022724610, 0.000021200000,
-     0.000019778550, 0.000018452850, 0.000017216870, 0.000016064590,
-     0.000014990000, 0.000013987280, 0.000013051550, 0.000012178180,
-     0.000011362540, 0.000010600000, 0.000009885877, 0.000009217304,
-     0.000008592362, 0.000008009133, 0.000007465700, 0.000006959567,
-     0.000006487995, 0.000006048699, 0.000005639396, 0.000005257800,
-     0.000004901771, 0.000004569720, 0.000004260194, 0.000003971739,
-     0.000003702900, 0.000003452163, 0.000003218302, 0.000003000300,
-     0.000002797139, 0.000002607800, 0.000002431220, 0.000002266531,
-     0.000002113013, 0.000001969943, 0.000001836600, 0.000001712230,
-     0.000001596228, 0.000001488090, 0.000001387314, 0.000001293400,
-     0.000001205820, 0.000001124143, 0.000001048009, 0.000000977058,
-     0.000000910930, 0.000000849251, 0.000000791721, 0.000000738090,
-     0.000000688110, 0.000000641530, 0.000000598090, 0.000000557575,
-     0.000000519808, 0.000000484612, 0.000000451810});
+const SPD CMF::CIE_1931_2_y(detail::static_samples,
+                            k_cie_1931_2_y, 360.0f, 1.0f);
 
-const SPD CMF::CIE_1931_2_z(
-    {360.000000, 361.000000, 362.000000, 363.000000, 364.000000, 365.000000,
-     366.000000, 367.000000, 368.000000, 369.000000, 370.000000, 371.000000,
-     372.000000, 373.000000, 374.000000, 375.000000, 376.000000, 377.000000,
-     378.000000, 379.000000, 380.000000, 381.000000, 382.000000, 383.000000,
-     384.000000, 385.000000, 386.000000, 387.000000, 388.000000, 389.000000,
-     390.000000, 391.000000, 392.000000, 393.000000, 394.000000, 395.000000,
-     396.000000, 397.000000, 398.000000, 399.000000, 400.000000, 401.000000,
-     402.000000, 403.000000, 404.000000, 405.000000, 406.000000, 407.000000,
-     408.000000, 409.000000, 410.000000, 411.000000, 412.000000, 413.000000,
-     414.000000, 415.000000, 416.000000, 417.000000, 418.000000, 419.000000,
-     420.000000, 421.000000, 422.000000, 423.000000, 424.000000, 425.000000,
-     426.000000, 427.000000, 428.000000, 429.000000, 430.000000, 431.000000,
-     432.000000, 433.000000, 434.000000, 435.000000, 436.000000, 437.000000,
-     438.000000, 439.000000, 440.000000, 441.000000, 442.000000, 443.000000,
-     444.000000, 445.000000, 446.000000, 447.000000, 448.000000, 449.000000,
-     450.000000, 451.000000, 452.000000, 453.000000, 454.000000, 455.000000,
-     456.000000, 457.000000, 458.000000, 459.000000, 460.000000, 461.000000,
-     462.000000, 463.000000, 464.000000, 465.000000, 466.000000, 467.000000,
-     468.000000, 469.000000, 470.000000, 471.000000, 472.000000, 473.000000,
-     474.000000, 475.000000, 476.000000, 477.000000, 478.000000, 479.000000,
-     480.000000, 481.000000, 482.000000, 483.000000, 484.000000, 485.000000,
-     486.000000, 487.000000, 488.000000, 489.000000, 490.000000, 491.000000,
-     492.000000, 493.000000, 494.000000, 495.000000, 496.000000, 497.000000,
-     498.000000, 499.000000, 500.000000, 501.000000, 502.000000, 503.000000,
-     504.000000, 505.000000, 506.000000, 507.000000, 508.000000, 509.000000,
-     510.000000, 511.000000, 512.000000, 513.000000, 514.000000, 515.000000,
-     516.000000, 517.000000, 518.000000, 519.000000, 520.000000, 521.000000,
-     522.000000, 523.000000, 524.000000, 525.000000, 526.000000, 527.000000,
-     528.000000, 529.000000, 530.000000, 531.000000, 532.000000, 533.000000,
-     534.000000, 535.000000, 536.000000, 537.000000, 538.000000, 539.000000,
-     540.000000, 541.000000, 542.000000, 543.000000, 544.000000, 545.000000,
-     546.000000, 547.000000, 548.000000, 549.000000, 550.000000, 551.000000,
-     552.000000, 553.000000, 554.000000, 555.000000, 556.000000, 557.000000,
-     558.000000, 559.000000, 560.000000, 561.000000, 562.000000, 563.000000,
-     564.000000, 565.000000, 566.000000, 567.000000, 568.000000, 569.000000,
-     570.000000, 571.000000, 572.000000, 573.000000, 574.000000, 575.000000,
-     576.000000, 577.000000, 578.000000, 579.000000, 580.000000, 581.000000,
-     582.000000, 583.000000, 584.000000, 585.000000, 586.000000, 587.000000,
-     588.000000, 589.000000, 590.000000, 591.000000, 592.000000, 593.000000,
-     594.000000, 595.000000, 596.000000, 597.000000, 598.000000, 599.000000,
-     600.000000, 601.000000, 602.000000, 603.000000, 604.000000, 605.000000,
-     606.000000, 607.000000, 608.000000, 609.000000, 610.000000, 611.000000,
-     612.000000, 613.000000, 614.000000, 615.000000, 616.000000, 617.000000,
-     618.000000, 619.000000, 620.000000, 621.000000, 622.000000, 623.000000,
-     624.000000, 625.000000, 626.000000, 627.000000, 628.000000, 629.000000,
-     630.000000, 631.000000, 632.000000, 633.000000, 634.000000, 635.000000,
-     636.000000, 637.000000, 638.000000, 639.000000, 640.000000, 641.000000,
-     642.000000, 643.000000, 644.000000, 645.000000, 646.000000, 647.000000,
-     648.000000, 649.000000, 650.000000, 651.000000, 652.000000, 653.000000,
-     654.000000, 655.000000, 656.000000, 657.000000, 658.000000, 659.000000,
-     660.000000, 661.000000, 662.000000, 663.000000, 664.000000, 665.000000,
-     666.000000, 667.000000, 668.000000, 669.000000, 670.000000, 671.000000,
-     672.000000, 673.000000, 674.000000, 675.000000, 676.000000, 677.000000,
-     678.000000, 679.000000, 680.000000, 681.000000, 682.000000, 683.000000,
-     684.000000, 685.000000, 686.000000, 687.000000, 688.000000, 689.000000,
-     690.000000, 691.000000, 692.000000, 693.000000, 694.000000, 695.000000,
-     696.000000, 697.000000, 698.000000, 699.000000, 700.000000, 701.000000,
-     702.000000, 703.000000, 704.000000, 705.000000, 706.000000, 707.000000,
-     708.000000, 709.000000, 710.000000, 711.000000, 712.000000, 713.000000,
-     714.000000, 715.000000, 716.000000, 717.000000, 718.000000, 719.000000,
-     720.000000, 721.000000, 722.000000, 723.000000, 724.000000, 725.000000,
-     726.000000, 727.000000, 728.000000, 729.000000, 730.000000, 731.000000,
-     732.000000, 733.000000, 734.000000, 735.000000, 736.000000, 737.000000,
-     738.000000, 739.000000, 740.000000, 741.000000, 742.000000, 743.000000,
-     744.000000, 745.000000, 746.000000, 747.000000, 748.000000, 749.000000,
-     750.000000, 751.000000, 752.000000, 753.000000, 754.000000, 755.000000,
-     756.000000, 757.000000, 758.000000, 759.000000, 760.000000, 761.000000,
-     762.000000, 763.000000, 764.000000, 765.000000, 766.000000, 767.000000,
-     768.000000, 769.000000, 770.000000, 771.000000, 772.000000, 773.000000,
-     774.000000, 775.000000, 776.000000, 777.000000, 778.000000, 779.000000,
-     780.000000, 781.000000, 782.000000, 783.000000, 784.000000, 785.000000,
-     786.000000, 787.000000, 788.000000, 789.000000, 790.000000, 791.000000,
-     792.000000, 793.000000, 794.000000, 795.000000, 796.000000, 797.000000,
-     798.000000, 799.000000, 800.000000, 801.000000, 802.000000, 803.000000,
-     804.000000, 805.000000, 806.000000, 807.000000, 808.000000, 809.000000,
-     810.000000, 811.000000, 812.000000, 813.000000, 814.000000, 815.000000,
-     816.000000, 817.000000, 818.000000, 819.000000, 820.000000, 821.000000,
-     822.000000, 823.000000, 824.000000, 825.000000, 826.000000, 827.000000,
-     828.000000, 829.000000, 830.000000},
-    {0.000606100000, 0.000680879200, 0.000765145600, 0.000860012400,
-     0.000966592800, 0.001086000000, 0.001220586000, 0.001372729000,
-     0.001543579000, 0.001734286000, 0.001946000000, 0.002177777000,
-     0.002435809000, 0.002731953000, 0.003078064000, 0.003486000000,
-     0.003975227000, 0.004540880000, 0.005158320000, 0.005802907000,
-     0.006450001000, 0.007083216000, 0.007745488000, 0.008501152000,
-     0.009414544000, 0.010549990000, 0.011965800000, 0.013655870000,
-     0.015588050000, 0.017730150000, 0.020050010000, 0.022511360000,
-     0.025202880000, 0.028279720000, 0.031897040000, 0.036210000000,
-     0.041437710000, 0.047503720000, 0.054119880000, 0.060998030000,
-     0.067850010000, 0.074486320000, 0.081361560000, 0.089153640000,
-     0.098540480000, 0.110200000000, 0.124613300000, 0.141701700000,
-     0.161303500000, 0.183256800000, 0.207400000000, 0.233692100000,
-     0.262611400000, 0.294774600000, 0.330798500000, 0.371300000000,
-     0.416209100000, 0.465464200000, 0.519694800000, 0.579530300000,
-     0.645600000000, 0.718483800000, 0.796713300000, 0.877845900000,
-     0.959439000000, 1.039050100000, 1.115367300000, 1.188497100000,
-     1.258123300000, 1.323929600000, 1.385600000000, 1.442635200000,
-     1.494803500000, 1.542190300000, 1.584880700000, 1.622960000000,
-     1.656404800000, 1.685295900000, 1.709874500000, 1.730382100000,
-     1.747060000000, 1.760044600000, 1.769623300000, 1.776263700000,
-     1.780433400000, 1.782600000000, 1.782968200000, 1.781699800000,
-     1.779198200000, 1.775867100000, 1.772110000000, 1.768258900000,
-     1.764039000000, 1.758943800000, 1.752466300000, 1.744100000000,
-     1.733559500000, 1.720858100000, 1.705936900000, 1.688737200000,
-     1.669200000000, 1.647528700000, 1.623412700000, 1.596022300000,
-     1.564528000000, 1.528100000000, 1.486111400000, 1.439521500000,
-     1.389879900000, 1.338736200000, 1.287640000000, 1.237422300000,
-     1.187824300000, 1.138761100000, 1.090148000000, 1.041900000000,
-     0.994197600000, 0.947347300000, 0.901453100000, 0.856619300000,
-     0.812950100000, 0.770517300000, 0.729444800000, 0.689913600000,
-     0.652104900000, 0.616200000000, 0.582328600000, 0.550416200000,
-     0.520337600000, 0.491967300000, 0.465180000000, 0.439924600000,
-     0.416183600000, 0.393882200000, 0.372945900000, 0.353300000000,
-     0.334857800000, 0.317552100000, 0.301337500000, 0.286168600000,
-     0.272000000000, 0.258817100000, 0.246483800000, 0.234771800000,
-     0.223453300000, 0.212300000000, 0.201169200000, 0.190119600000,
-     0.179225400000, 0.168560800000, 0.158200000000, 0.148138300000,
-     0.138375800000, 0.128994200000, 0.120075100000, 0.111700000000,
-     0.103904800000, 0.096667480000, 0.089982720000, 0.083845310000,
-     0.078249990000, 0.073208990000, 0.068678160000, 0.064567840000,
-     0.060788350000, 0.057250010000, 0.053904350000, 0.050746640000,
-     0.047752760000, 0.044898590000, 0.042160000000, 0.039507280000,
-     0.036935640000, 0.034458360000, 0.032088720000, 0.029840000000,
-     0.027711810000, 0.025694440000, 0.023787160000, 0.021989250000,
-     0.020300000000, 0.018718050000, 0.017240360000, 0.015863640000,
-     0.014584610000, 0.013400000000, 0.012307230000, 0.011301880000,
-     0.010377920000, 0.009529306000, 0.008749999000, 0.008035200000,
-     0.007381600000, 0.006785400000, 0.006242800000, 0.005749999000,
-     0.005303600000, 0.004899800000, 0.004534200000, 0.004202400000,
-     0.003900000000, 0.003623200000, 0.003370600000, 0.003141400000,
-     0.002934800000, 0.002749999000, 0.002585200000, 0.002438600000,
-     0.002309400000, 0.002196800000, 0.002100000000, 0.002017733000,
-     0.001948200000, 0.001889800000, 0.001840933000, 0.001800000000,
-     0.001766267000, 0.001737800000, 0.001711200000, 0.001683067000,
-     0.001650001000, 0.001610133000, 0.001564400000, 0.001513600000,
-     0.001458533000, 0.001400000000, 0.001336667000, 0.001270000000,
-     0.001205000000, 0.001146667000, 0.001100000000, 0.001068800000,
-     0.001049400000, 0.001035600000, 0.001021200000, 0.001000000000,
-     0.000968640000, 0.000929920000, 0.000886880000, 0.000842560000,
-     0.000800000000, 0.000760960000, 0.000723680000, 0.000685920000,
-     0.000645440000, 0.000600000000, 0.000547866700, 0.000491600000,
-     0.000435400000, 0.000383466700, 0.000340000000, 0.000307253300,
-     0.000283160000, 0.000265440000, 0.000251813300, 0.000240000000,
-     0.000229546700, 0.000220640000, 0.000211960000, 0.000202186700,
-     0.000190000000, 0.000174213300, 0.000155640000, 0.000135960000,
-     0.000116853300, 0.000100000000, 0.000086133330, 0.000074600000,
-     0.000065000000, 0.000056933330, 0.000049999990, 0.000044160000,
-     0.000039480000, 0.000035720000, 0.000032640000, 0.000030000000,
-     0.000027653330, 0.000025560000, 0.000023640000, 0.000021813330,
-     0.000020000000, 0.000018133330, 0.000016200000, 0.000014200000,
-     0.000012133330, 0.000010000000, 0.000007733333, 0.000005400000,
-     0.000003200000, 0.000001333333, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000});
+const SPD CMF::CIE_1931_2_z(detail::static_samples,
+                            k_cie_1931_2_z, 360.0f, 1.0f);
 
-const SPD CMF::CIE_1964_10_x(
-    {360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
-     375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
-     390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.000000122200, 0.000000185138, 0.000000278830, 0.000000417470,
-     0.000000621330, 0.000000919270, 0.000001351980, 0.000001976540,
-     0.000002872500, 0.000004149500, 0.000005958600, 0.000008505600,
-     0.000012068600, 0.000017022600, 0.000023868000, 0.000033266000,
-     0.000046087000, 0.000063472000, 0.000086892000, 0.000118246000,
-     0.000159952000, 0.000215080000, 0.000287490000, 0.000381990000,
-     0.000504550000, 0.000662440000, 0.000864500000, 0.001121500000,
-     0.001446160000, 0.001853590000, 0.002361600000, 0.002990600000,
-     0.003764500000, 0.004710200000, 0.005858100000, 0.007242300000,
-     0.008899600000, 0.010870900000, 0.013198900000, 0.015929200000,
-     0.019109700000, 0.022788000000, 0.027011000000, 0.031829000000,
-     0.037278000000, 0.043400000000, 0.050223000000, 0.057764000000,
-     0.066038000000, 0.075033000000, 0.084736000000, 0.095041000000,
-     0.105836000000, 0.117066000000, 0.128682000000, 0.140638000000,
-     0.152893000000, 0.165416000000, 0.178191000000, 0.191214000000,
-     0.204492000000, 0.217650000000, 0.230267000000, 0.242311000000,
-     0.253793000000, 0.264737000000, 0.275195000000, 0.285301000000,
-     0.295143000000, 0.304869000000, 0.314679000000, 0.324355000000,
-     0.333570000000, 0.342243000000, 0.350312000000, 0.357719000000,
-     0.364482000000, 0.370493000000, 0.375727000000, 0.380158000000,
-     0.383734000000, 0.386327000000, 0.387858000000, 0.388396000000,
-     0.387978000000, 0.386726000000, 0.384696000000, 0.382006000000,
-     0.378709000000, 0.374915000000, 0.370702000000, 0.366089000000,
-     0.361045000000, 0.355518000000, 0.349486000000, 0.342957000000,
-     0.335893000000, 0.328284000000, 0.320150000000, 0.311475000000,
-     0.302273000000, 0.292858000000, 0.283502000000, 0.274044000000,
-     0.264263000000, 0.254085000000, 0.243392000000, 0.232187000000,
-     0.220488000000, 0.208198000000, 0.195618000000, 0.183034000000,
-     0.170222000000, 0.157348000000, 0.144650000000, 0.132349000000,
-     0.120584000000, 0.109456000000, 0.099042000000, 0.089388000000,
-     0.080507000000, 0.072034000000, 0.063710000000, 0.055694000000,
-     0.048117000000, 0.041072000000, 0.034642000000, 0.028896000000,
-     0.023876000000, 0.019628000000, 0.016172000000, 0.013300000000,
-     0.010759000000, 0.008542000000, 0.006661000000, 0.005132000000,
-     0.003982000000, 0.003239000000, 0.002934000000, 0.003114000000,
-     0.003816000000, 0.005095000000, 0.006936000000, 0.009299000000,
-     0.012147000000, 0.015444000000, 0.019156000000, 0.023250000000,
-     0.027690000000, 0.032444000000, 0.037465000000, 0.042956000000,
-     0.049114000000, 0.055920000000, 0.063349000000, 0.071358000000,
-     0.079901000000, 0.088909000000, 0.098293000000, 0.107949000000,
-     0.117749000000, 0.127839000000, 0.138450000000, 0.149516000000,
-     0.161041000000, 0.172953000000, 0.185209000000, 0.197755000000,
-     0.210538000000, 0.223460000000, 0.236491000000, 0.249633000000,
-     0.262972000000, 0.276515000000, 0.290269000000, 0.304213000000,
-     0.318361000000, 0.332705000000, 0.347232000000, 0.361926000000,
-     0.376772000000, 0.391683000000, 0.406594000000, 0.421539000000,
-     0.436517000000, 0.451584000000, 0.466782000000, 0.482147000000,
-     0.497738000000, 0.513606000000, 0.529826000000, 0.546440000000,
-     0.563426000000, 0.580726000000, 0.598290000000, 0.616053000000,
-     0.633948000000, 0.651901000000, 0.669824000000, 0.687632000000,
-     0.705224000000, 0.722773000000, 0.740483000000, 0.758273000000,
-     0.776083000000, 0.793832000000, 0.811436000000, 0.828822000000,
-     0.845879000000, 0.862525000000, 0.878655000000, 0.894208000000,
-     0.909206000000, 0.923672000000, 0.937638000000, 0.951162000000,
-     0.964283000000, 0.977068000000, 0.989590000000, 1.001910000000,
-     1.014160000000, 1.026500000000, 1.038800000000, 1.051000000000,
-     1.062900000000, 1.074300000000, 1.085200000000, 1.095200000000,
-     1.104200000000, 1.112000000000, 1.118520000000, 1.123800000000,
-     1.128000000000, 1.131100000000, 1.133200000000, 1.134300000000,
-     1.134300000000, 1.133300000000, 1.131200000000, 1.128100000000,
-     1.123990000000, 1.118900000000, 1.112900000000, 1.105900000000,
-     1.098000000000, 1.089100000000, 1.079200000000, 1.068400000000,
-     1.056700000000, 1.044000000000, 1.030480000000, 1.016000000000,
-     1.000800000000, 0.984790000000, 0.968080000000, 0.950740000000,
-     0.932800000000, 0.914340000000, 0.895390000000, 0.876030000000,
-     0.856297000000, 0.836350000000, 0.816290000000, 0.796050000000,
-     0.775610000000, 0.754930000000, 0.733990000000, 0.712780000000,
-     0.691290000000, 0.669520000000, 0.647467000000, 0.625110000000,
-     0.602520000000, 0.579890000000, 0.557370000000, 0.535110000000,
-     0.513240000000, 0.491860000000, 0.471080000000, 0.450960000000,
-     0.431567000000, 0.412870000000, 0.394750000000, 0.377210000000,
-     0.360190000000, 0.343690000000, 0.327690000000, 0.312170000000,
-     0.297110000000, 0.282500000000, 0.268329000000, 0.254590000000,
-     0.241300000000, 0.228480000000, 0.216140000000, 0.204300000000,
-     0.192950000000, 0.182110000000, 0.171770000000, 0.161920000000,
-     0.152568000000, 0.143670000000, 0.135200000000, 0.127130000000,
-     0.119480000000, 0.112210000000, 0.105310000000, 0.098786000000,
-     0.092610000000, 0.086773000000, 0.081260600000, 0.076048000000,
-     0.071114000000, 0.066454000000, 0.062062000000, 0.057930000000,
-     0.054050000000, 0.050412000000, 0.047006000000, 0.043823000000,
-     0.040850800000, 0.038072000000, 0.035468000000, 0.033031000000,
-     0.030753000000, 0.028623000000, 0.026635000000, 0.024781000000,
-     0.023052000000, 0.021441000000, 0.019941300000, 0.018544000000,
-     0.017241000000, 0.016027000000, 0.014896000000, 0.013842000000,
-     0.012862000000, 0.011949000000, 0.011100000000, 0.010311000000,
-     0.009576880000, 0.008894000000, 0.008258100000, 0.007666400000,
-     0.007116300000, 0.006605200000, 0.006130600000, 0.005690300000,
-     0.005281900000, 0.004903300000, 0.004552630000, 0.004227500000,
-     0.003925800000, 0.003645700000, 0.003385900000, 0.003144700000,
-     0.002920800000, 0.002713000000, 0.002520200000, 0.002341100000,
-     0.002174960000, 0.002020600000, 0.001877300000, 0.001744100000,
-     0.001620500000, 0.001505700000, 0.001399200000, 0.001300400000,
-     0.001208700000, 0.001123600000, 0.001044760000, 0.000971560000,
-     0.000903600000, 0.000840480000, 0.000781870000, 0.000727450000,
-     0.000676900000, 0.000629960000, 0.000586370000, 0.000545870000,
-     0.000508258000, 0.000473300000, 0.000440800000, 0.000410580000,
-     0.000382490000, 0.000356380000, 0.000332110000, 0.000309550000,
-     0.000288580000, 0.000269090000, 0.000250969000, 0.000234130000,
-     0.000218470000, 0.000203910000, 0.000190350000, 0.000177730000,
-     0.000165970000, 0.000155020000, 0.000144800000, 0.000135280000,
-     0.000126390000, 0.000118100000, 0.000110370000, 0.000103150000,
-     0.000096427000, 0.000090151000, 0.000084294000, 0.000078830000,
-     0.000073729000, 0.000068969000, 0.000064525800, 0.000060376000,
-     0.000056500000, 0.000052880000, 0.000049498000, 0.000046339000,
-     0.000043389000, 0.000040634000, 0.000038060000, 0.000035657000,
-     0.000033411700, 0.000031315000, 0.000029355000, 0.000027524000,
-     0.000025811000, 0.000024209000, 0.000022711000, 0.000021308000,
-     0.000019994000, 0.000018764000, 0.000017611500, 0.000016532000,
-     0.000015521000, 0.000014574000, 0.000013686000, 0.000012855000,
-     0.000012075000, 0.000011345000, 0.000010659000, 0.000010017000,
-     0.000009413630, 0.000008847900, 0.000008317100, 0.000007819000,
-     0.000007351600, 0.000006913000, 0.000006501500, 0.000006115300,
-     0.000005752900, 0.000005412700, 0.000005093470, 0.000004793800,
-     0.000004512500, 0.000004248300, 0.000004000200, 0.000003767100,
-     0.000003548000, 0.000003342100, 0.000003148500, 0.000002966500,
-     0.000002795310, 0.000002634500, 0.000002483400, 0.000002341400,
-     0.000002207800, 0.000002082000, 0.000001963600, 0.000001851900,
-     0.000001746500, 0.000001647100, 0.000001553140});
+const SPD CMF::CIE_1964_10_x(detail::static_samples,
+                             k_cie_1964_10_x, 360.0f, 1.0f);
 
-const SPD CMF::CIE_1964_10_y(
-    {360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
-     375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
-     390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.000000013398, 0.000000020294, 0.000000030560, 0.000000045740,
-     0.000000068050, 0.000000100650, 0.000000147980, 0.000000216270,
-     0.000000314200, 0.000000453700, 0.000000651100, 0.000000928800,
-     0.000001317500, 0.000001857200, 0.000002602000, 0.000003625000,
-     0.000005019000, 0.000006907000, 0.000009449000, 0.000012848000,
-     0.000017364000, 0.000023327000, 0.000031150000, 0.000041350000,
-     0.000054560000, 0.000071560000, 0.000093300000, 0.000120870000,
-     0.000155640000, 0.000199200000, 0.000253400000, 0.000320200000,
-     0.000402400000, 0.000502300000, 0.000623200000, 0.000768500000,
-     0.000941700000, 0.001147800000, 0.001390300000, 0.001674000000,
-     0.002004400000, 0.002386000000, 0.002822000000, 0.003319000000,
-     0.003880000000, 0.004509000000, 0.005209000000, 0.005985000000,
-     0.006833000000, 0.007757000000, 0.008756000000, 0.009816000000,
-     0.010918000000, 0.012058000000, 0.013237000000, 0.014456000000,
-     0.015717000000, 0.017025000000, 0.018399000000, 0.019848000000,
-     0.021391000000, 0.022992000000, 0.024598000000, 0.026213000000,
-     0.027841000000, 0.029497000000, 0.031195000000, 0.032927000000,
-     0.034738000000, 0.036654000000, 0.038676000000, 0.040792000000,
-     0.042946000000, 0.045114000000, 0.047333000000, 0.049602000000,
-     0.051934000000, 0.054337000000, 0.056822000000, 0.059399000000,
-     0.062077000000, 0.064737000000, 0.067285000000, 0.069764000000,
-     0.072218000000, 0.074704000000, 0.077272000000, 0.079979000000,
-     0.082874000000, 0.086000000000, 0.089456000000, 0.092947000000,
-     0.096275000000, 0.099535000000, 0.102829000000, 0.106256000000,
-     0.109901000000, 0.113835000000, 0.118167000000, 0.122932000000,
-     0.128201000000, 0.133457000000, 0.138323000000, 0.143042000000,
-     0.147787000000, 0.152761000000, 0.158102000000, 0.163941000000,
-     0.170362000000, 0.177425000000, 0.185190000000, 0.193025000000,
-     0.200313000000, 0.207156000000, 0.213644000000, 0.219940000000,
-     0.226170000000, 0.232467000000, 0.239025000000, 0.245997000000,
-     0.253589000000, 0.261876000000, 0.270643000000, 0.279645000000,
-     0.288694000000, 0.297665000000, 0.306469000000, 0.315035000000,
-     0.323335000000, 0.331366000000, 0.339133000000, 0.347860000000,
-     0.358326000000, 0.370001000000, 0.382464000000, 0.395379000000,
-     0.408482000000, 0.421588000000, 0.434619000000, 0.447601000000,
-     0.460777000000, 0.474340000000, 0.488200000000, 0.502340000000,
-     0.516740000000, 0.531360000000, 0.546190000000, 0.561180000000,
-     0.576290000000, 0.591500000000, 0.606741000000, 0.622150000000,
-     0.637830000000, 0.653710000000, 0.669680000000, 0.685660000000,
-     0.701550000000, 0.717230000000, 0.732570000000, 0.747460000000,
-     0.761757000000, 0.775340000000, 0.788220000000, 0.800460000000,
-     0.812140000000, 0.823330000000, 0.834120000000, 0.844600000000,
-     0.854870000000, 0.865040000000, 0.875211000000, 0.885370000000,
-     0.895370000000, 0.905150000000, 0.914650000000, 0.923810000000,
-     0.932550000000, 0.940810000000, 0.948520000000, 0.955600000000,
-     0.961988000000, 0.967540000000, 0.972230000000, 0.976170000000,
-     0.979460000000, 0.982200000000, 0.984520000000, 0.986520000000,
-     0.988320000000, 0.990020000000, 0.991761000000, 0.993530000000,
-     0.995230000000, 0.996770000000, 0.998090000000, 0.999110000000,
-     0.999770000000, 1.000000000000, 0.999710000000, 0.998850000000,
-     0.997340000000, 0.995260000000, 0.992740000000, 0.989750000000,
-     0.986300000000, 0.982380000000, 0.977980000000, 0.973110000000,
-     0.967740000000, 0.961890000000, 0.955552000000, 0.948601000000,
-     0.940981000000, 0.932798000000, 0.924158000000, 0.915175000000,
-     0.905954000000, 0.896608000000, 0.887249000000, 0.877986000000,
-     0.868934000000, 0.860164000000, 0.851519000000, 0.842963000000,
-     0.834393000000, 0.825623000000, 0.816764000000, 0.807544000000,
-     0.797947000000, 0.787893000000, 0.777405000000, 0.766490000000,
-     0.755309000000, 0.743845000000, 0.732190000000, 0.720353000000,
-     0.708281000000, 0.696055000000, 0.683621000000, 0.671048000000,
-     0.658341000000, 0.645545000000, 0.632718000000, 0.619815000000,
-     0.606887000000, 0.593878000000, 0.580781000000, 0.567653000000,
-     0.554490000000, 0.541228000000, 0.527963000000, 0.514634000000,
-     0.501363000000, 0.488124000000, 0.474935000000, 0.461834000000,
-     0.448823000000, 0.435917000000, 0.423153000000, 0.410526000000,
-     0.398057000000, 0.385835000000, 0.373951000000, 0.362311000000,
-     0.350863000000, 0.339554000000, 0.328309000000, 0.317118000000,
-     0.305936000000, 0.294737000000, 0.283493000000, 0.272222000000,
-     0.260990000000, 0.249877000000, 0.238946000000, 0.228254000000,
-     0.217853000000, 0.207780000000, 0.198072000000, 0.188748000000,
-     0.179828000000, 0.171285000000, 0.163059000000, 0.155151000000,
-     0.147535000000, 0.140211000000, 0.133170000000, 0.126400000000,
-     0.119892000000, 0.113640000000, 0.107633000000, 0.101870000000,
-     0.096347000000, 0.091063000000, 0.086010000000, 0.081187000000,
-     0.076583000000, 0.072198000000, 0.068024000000, 0.064052000000,
-     0.060281000000, 0.056697000000, 0.053292000000, 0.050059000000,
-     0.046998000000, 0.044096000000, 0.041345000000, 0.038750700000,
-     0.036297800000, 0.033983200000, 0.031800400000, 0.029739500000,
-     0.027791800000, 0.025955100000, 0.024226300000, 0.022601700000,
-     0.021077900000, 0.019650500000, 0.018315300000, 0.017068600000,
-     0.015905100000, 0.014818300000, 0.013800800000, 0.012849500000,
-     0.011960700000, 0.011130300000, 0.010355500000, 0.009633200000,
-     0.008959900000, 0.008332400000, 0.007748800000, 0.007204600000,
-     0.006697500000, 0.006225100000, 0.005785000000, 0.005375100000,
-     0.004994100000, 0.004639200000, 0.004309300000, 0.004002800000,
-     0.003717740000, 0.003452620000, 0.003205830000, 0.002976230000,
-     0.002762810000, 0.002564560000, 0.002380480000, 0.002209710000,
-     0.002051320000, 0.001904490000, 0.001768470000, 0.001642360000,
-     0.001525350000, 0.001416720000, 0.001315950000, 0.001222390000,
-     0.001135550000, 0.001054940000, 0.000980140000, 0.000910660000,
-     0.000846190000, 0.000786290000, 0.000730680000, 0.000678990000,
-     0.000631010000, 0.000586440000, 0.000545110000, 0.000506720000,
-     0.000471110000, 0.000438050000, 0.000407410000, 0.000378962000,
-     0.000352543000, 0.000328001000, 0.000305208000, 0.000284041000,
-     0.000264375000, 0.000246109000, 0.000229143000, 0.000213376000,
-     0.000198730000, 0.000185115000, 0.000172454000, 0.000160678000,
-     0.000149730000, 0.000139550000, 0.000130086000, 0.000121290000,
-     0.000113106000, 0.000105501000, 0.000098428000, 0.000091853000,
-     0.000085738000, 0.000080048000, 0.000074751000, 0.000069819000,
-     0.000065222000, 0.000060939000, 0.000056942000, 0.000053217000,
-     0.000049737000, 0.000046491000, 0.000043464000, 0.000040635000,
-     0.000038000000, 0.000035540500, 0.000033244800, 0.000031100600,
-     0.000029099000, 0.000027230700, 0.000025486000, 0.000023856100,
-     0.000022333200, 0.000020910400, 0.000019580800, 0.000018338400,
-     0.000017177700, 0.000016093400, 0.000015080000, 0.000014133600,
-     0.000013249000, 0.000012422600, 0.000011649900, 0.000010927700,
-     0.000010251900, 0.000009619600, 0.000009028100, 0.000008474000,
-     0.000007954800, 0.000007468600, 0.000007012800, 0.000006585800,
-     0.000006185700, 0.000005810700, 0.000005459000, 0.000005129800,
-     0.000004820600, 0.000004531200, 0.000004259100, 0.000004004200,
-     0.000003764730, 0.000003539950, 0.000003329140, 0.000003131150,
-     0.000002945290, 0.000002770810, 0.000002607050, 0.000002453290,
-     0.000002308940, 0.000002173380, 0.000002046130, 0.000001926620,
-     0.000001814400, 0.000001708950, 0.000001609880, 0.000001516770,
-     0.000001429210, 0.000001346860, 0.000001269450, 0.000001196620,
-     0.000001128090, 0.000001063680, 0.000001003130, 0.000000946220,
-     0.000000892630, 0.000000842160, 0.000000794640, 0.000000749780,
-     0.000000707440, 0.000000667480, 0.000000629700});
+const SPD CMF::CIE_1964_10_y(detail::static_samples,
+                             k_cie_1964_10_y, 360.0f, 1.0f);
 
-const SPD CMF::CIE_1964_10_z(
-    {360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
-     375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
-     390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.000000535027, 0.000000810720, 0.000001221200, 0.000001828700,
-     0.000002722200, 0.000004028300, 0.000005925700, 0.000008665100,
-     0.000012596000, 0.000018201000, 0.000026143700, 0.000037330000,
-     0.000052987000, 0.000074764000, 0.000104870000, 0.000146220000,
-     0.000202660000, 0.000279230000, 0.000382450000, 0.000520720000,
-     0.000704776000, 0.000948230000, 0.001268200000, 0.001686100000,
-     0.002228500000, 0.002927800000, 0.003823700000, 0.004964200000,
-     0.006406700000, 0.008219300000, 0.010482200000, 0.013289000000,
-     0.016747000000, 0.020980000000, 0.026127000000, 0.032344000000,
-     0.039802000000, 0.048691000000, 0.059210000000, 0.071576000000,
-     0.086010900000, 0.102740000000, 0.122000000000, 0.144020000000,
-     0.168990000000, 0.197120000000, 0.228570000000, 0.263470000000,
-     0.301900000000, 0.343870000000, 0.389366000000, 0.437970000000,
-     0.489220000000, 0.542900000000, 0.598810000000, 0.656760000000,
-     0.716580000000, 0.778120000000, 0.841310000000, 0.906110000000,
-     0.972542000000, 1.038900000000, 1.103100000000, 1.165100000000,
-     1.224900000000, 1.282500000000, 1.338200000000, 1.392600000000,
-     1.446100000000, 1.499400000000, 1.553480000000, 1.607200000000,
-     1.658900000000, 1.708200000000, 1.754800000000, 1.798500000000,
-     1.839200000000, 1.876600000000, 1.910500000000, 1.940800000000,
-     1.967280000000, 1.989100000000, 2.005700000000, 2.017400000000,
-     2.024400000000, 2.027300000000, 2.026400000000, 2.022300000000,
-     2.015300000000, 2.006000000000, 1.994800000000, 1.981400000000,
-     1.965300000000, 1.946400000000, 1.924800000000, 1.900700000000,
-     1.874100000000, 1.845100000000, 1.813900000000, 1.780600000000,
-     1.745370000000, 1.709100000000, 1.672300000000, 1.634700000000,
-     1.595600000000, 1.554900000000, 1.512200000000, 1.467300000000,
-     1.419900000000, 1.370000000000, 1.317560000000, 1.262400000000,
-     1.205000000000, 1.146600000000, 1.088000000000, 1.030200000000,
-     0.973830000000, 0.919430000000, 0.867460000000, 0.818280000000,
-     0.772125000000, 0.728290000000, 0.686040000000, 0.645530000000,
-     0.606850000000, 0.570060000000, 0.535220000000, 0.502340000000,
-     0.471400000000, 0.442390000000, 0.415254000000, 0.390024000000,
-     0.366399000000, 0.344015000000, 0.322689000000, 0.302356000000,
-     0.283036000000, 0.264816000000, 0.247848000000, 0.232318000000,
-     0.218502000000, 0.205851000000, 0.193596000000, 0.181736000000,
-     0.170281000000, 0.159249000000, 0.148673000000, 0.138609000000,
-     0.129096000000, 0.120215000000, 0.112044000000, 0.104710000000,
-     0.098196000000, 0.092361000000, 0.087088000000, 0.082248000000,
-     0.077744000000, 0.073456000000, 0.069268000000, 0.065060000000,
-     0.060709000000, 0.056457000000, 0.052609000000, 0.049122000000,
-     0.045954000000, 0.043050000000, 0.040368000000, 0.037839000000,
-     0.035384000000, 0.032949000000, 0.030451000000, 0.028029000000,
-     0.025862000000, 0.023920000000, 0.022174000000, 0.020584000000,
-     0.019127000000, 0.017740000000, 0.016403000000, 0.015064000000,
-     0.013676000000, 0.012308000000, 0.011056000000, 0.009915000000,
-     0.008872000000, 0.007918000000, 0.007030000000, 0.006223000000,
-     0.005453000000, 0.004714000000, 0.003988000000, 0.003289000000,
-     0.002646000000, 0.002063000000, 0.001533000000, 0.001091000000,
-     0.000711000000, 0.000407000000, 0.000184000000, 0.000047000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000});
+const SPD CMF::CIE_1964_10_z(detail::static_samples,
+                             k_cie_1964_10_z, 360.0f, 1.0f);
 
-const SPD CMF::CIE_2012_2_x(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.003769647000, 0.004532416000, 0.005446553000, 0.006538868000,
-     0.007839699000, 0.009382967000, 0.011206080000, 0.013349650000,
-     0.015856900000, 0.018772860000, 0.022143020000, 0.026012850000,
-     0.030430360000, 0.035443250000, 0.041096400000, 0.047429860000,
-     0.054473940000, 0.062236120000, 0.070700480000, 0.079825130000,
-     0.089538030000, 0.099748480000, 0.110401900000, 0.121456600000,
-     0.132874100000, 0.144621400000, 0.156646800000, 0.168790100000,
-     0.180832800000, 0.192521600000, 0.203572900000, 0.213753100000,
-     0.223134800000, 0.231924500000, 0.240389200000, 0.248852300000,
-     0.257589600000, 0.266499100000, 0.275353200000, 0.283892100000,
-     0.291824600000, 0.298920000000, 0.305299300000, 0.311203100000,
-     0.316904700000, 0.322708700000, 0.328819400000, 0.334924200000,
-     0.340545200000, 0.345168800000, 0.348255400000, 0.349415300000,
-     0.348907500000, 0.347174600000, 0.344670500000, 0.341848300000,
-     0.339024000000, 0.335992600000, 0.332427600000, 0.328015700000,
-     0.322463700000, 0.315622500000, 0.307820100000, 0.299477100000,
-     0.290977600000, 0.282664600000, 0.274796200000, 0.267431200000,
-     0.260584700000, 0.254274900000, 0.248525400000, 0.243303900000,
-     0.238341400000, 0.233325300000, 0.227961900000, 0.221978100000,
-     0.215173500000, 0.207561900000, 0.199218300000, 0.190229000000,
-     0.180690500000, 0.170715400000, 0.160447100000, 0.150024400000,
-     0.139570500000, 0.129192000000, 0.118985900000, 0.109061500000,
-     0.099514240000, 0.090418500000, 0.081828950000, 0.073768170000,
-     0.066194770000, 0.059063800000, 0.052342420000, 0.046008650000,
-     0.040061540000, 0.034543730000, 0.029490910000, 0.024921400000,
-     0.020839810000, 0.017235910000, 0.014079240000, 0.011345160000,
-     0.009019658000, 0.007097731000, 0.005571145000, 0.004394566000,
-     0.003516303000, 0.002887638000, 0.002461588000, 0.002206348000,
-     0.002149559000, 0.002337091000, 0.002818931000, 0.003649178000,
-     0.004891359000, 0.006629364000, 0.008942902000, 0.011902240000,
-     0.015569890000, 0.019976680000, 0.025046980000, 0.030675300000,
-     0.036749990000, 0.043151710000, 0.049785840000, 0.056685540000,
-     0.063916510000, 0.071543520000, 0.079629170000, 0.088214730000,
-     0.097269780000, 0.106750400000, 0.116619200000, 0.126846800000,
-     0.137406000000, 0.148247100000, 0.159307600000, 0.170518100000,
-     0.181802600000, 0.193109000000, 0.204508500000, 0.216116600000,
-     0.228065000000, 0.240501500000, 0.253544100000, 0.267130000000,
-     0.281135100000, 0.295416400000, 0.309811700000, 0.324167800000,
-     0.338431900000, 0.352578600000, 0.366583900000, 0.380424400000,
-     0.394098800000, 0.407697200000, 0.421348400000, 0.435200300000,
-     0.449420600000, 0.464161600000, 0.479439500000, 0.495218000000,
-     0.511439500000, 0.528023300000, 0.544869600000, 0.561889800000,
-     0.579013700000, 0.596188200000, 0.613378400000, 0.630589700000,
-     0.647922300000, 0.665486600000, 0.683378200000, 0.701677400000,
-     0.720411000000, 0.739449500000, 0.758628500000, 0.777788500000,
-     0.796775000000, 0.815453000000, 0.833738900000, 0.851549300000,
-     0.868786200000, 0.885337600000, 0.901158800000, 0.916527800000,
-     0.931824500000, 0.947452400000, 0.963838800000, 0.981259600000,
-     0.999295300000, 1.017343000000, 1.034790000000, 1.051011000000,
-     1.065522000000, 1.078421000000, 1.089944000000, 1.100320000000,
-     1.109767000000, 1.118438000000, 1.126266000000, 1.133138000000,
-     1.138952000000, 1.143620000000, 1.147095000000, 1.149464000000,
-     1.150838000000, 1.151326000000, 1.151033000000, 1.150002000000,
-     1.148061000000, 1.144998000000, 1.140622000000, 1.134757000000,
-     1.127298000000, 1.118342000000, 1.108033000000, 1.096515000000,
-     1.083928000000, 1.070387000000, 1.055934000000, 1.040592000000,
-     1.024385000000, 1.007344000000, 0.989526800000, 0.971121300000,
-     0.952325700000, 0.933324800000, 0.914287700000, 0.895279800000,
-     0.876015700000, 0.856160700000, 0.835423500000, 0.813556500000,
-     0.790456500000, 0.766436400000, 0.741877700000, 0.717121900000,
-     0.692471700000, 0.668160000000, 0.644269700000, 0.620845000000,
-     0.597924300000, 0.575541000000, 0.553729600000, 0.532541200000,
-     0.512021800000, 0.492207000000, 0.473122400000, 0.454741700000,
-     0.436871900000, 0.419312100000, 0.401898000000, 0.384498600000,
-     0.367059200000, 0.349716700000, 0.332630500000, 0.315934100000,
-     0.299737400000, 0.284118900000, 0.269105300000, 0.254707700000,
-     0.240931900000, 0.227779200000, 0.215243100000, 0.203301000000,
-     0.191927600000, 0.181098700000, 0.170791400000, 0.160984200000,
-     0.151657700000, 0.142793600000, 0.134373700000, 0.126380800000,
-     0.118797900000, 0.111608800000, 0.104797500000, 0.098348350000,
-     0.092245970000, 0.086475060000, 0.081019860000, 0.075865140000,
-     0.070996330000, 0.066399600000, 0.062062250000, 0.057974090000,
-     0.054125330000, 0.050506000000, 0.047106060000, 0.043914110000,
-     0.040914110000, 0.038090670000, 0.035430340000, 0.032921380000,
-     0.030556720000, 0.028341460000, 0.026280330000, 0.024374650000,
-     0.022623060000, 0.021019350000, 0.019546470000, 0.018187270000,
-     0.016927270000, 0.015754170000, 0.014658540000, 0.013635710000,
-     0.012682050000, 0.011793940000, 0.010967780000, 0.010199640000,
-     0.009484317000, 0.008816851000, 0.008192921000, 0.007608750000,
-     0.007061391000, 0.006549509000, 0.006071970000, 0.005627476000,
-     0.005214608000, 0.004831848000, 0.004477579000, 0.004150166000,
-     0.003847988000, 0.003569452000, 0.003312857000, 0.003076022000,
-     0.002856894000, 0.002653681000, 0.002464821000, 0.002289060000,
-     0.002125694000, 0.001974121000, 0.001833723000, 0.001703876000,
-     0.001583904000, 0.001472939000, 0.001370151000, 0.001274803000,
-     0.001186238000, 0.001103871000, 0.001027194000, 0.000955749300,
-     0.000889126200, 0.000826953500, 0.000768935100, 0.000714942500,
-     0.000664859000, 0.000618542100, 0.000575830300, 0.000536504600,
-     0.000500184200, 0.000466500500, 0.000435138600, 0.000405830300,
-     0.000378373300, 0.000352689200, 0.000328719900, 0.000306399800,
-     0.000285657700, 0.000266410800, 0.000248546200, 0.000231952900,
-     0.000216530000, 0.000202185300, 0.000188833800, 0.000176393500,
-     0.000164789500, 0.000153954200, 0.000143827000, 0.000134357200,
-     0.000125514100, 0.000117270600, 0.000109598300, 0.000102468500,
-     0.000095847150, 0.000089683160, 0.000083927340, 0.000078537080,
-     0.000073475510, 0.000068715760, 0.000064252570, 0.000060082920,
-     0.000056200980, 0.000052598700, 0.000049262790, 0.000046166230,
-     0.000043282120, 0.000040587150, 0.000038061140, 0.000035688180,
-     0.000033460230, 0.000031370900, 0.000029413710, 0.000027582220,
-     0.000025869510, 0.000024267010, 0.000022766390, 0.000021360090,
-     0.000020041220, 0.000018803800, 0.000017643580, 0.000016556710,
-     0.000015539390, 0.000014587920, 0.000013698530, 0.000012867050,
-     0.000012089470, 0.000011362070, 0.000010681410, 0.000010044110,
-     0.000009446399, 0.000008884754, 0.000008356050, 0.000007857521,
-     0.000007386996, 0.000006943576, 0.000006526548, 0.000006135087,
-     0.000005768284, 0.000005425069, 0.000005103974, 0.000004803525,
-     0.000004522350, 0.000004259166, 0.000004012715, 0.000003781597,
-     0.000003564496, 0.000003360236, 0.000003167765, 0.000002986206,
-     0.000002814999, 0.000002653663, 0.000002501725, 0.000002358723,
-     0.000002224206, 0.000002097737, 0.000001978894, 0.000001867268,
-     0.000001762465});
+const SPD CMF::CIE_2012_2_x(detail::static_samples,
+                            k_cie_2012_2_x, 390.0f, 1.0f);
 
-const SPD CMF::CIE_2012_2_y(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.000414616100, 0.000502833300, 0.000608499100, 0.000734443600,
-     0.000883738900, 0.001059646000, 0.001265532000, 0.001504753000,
-     0.001780493000, 0.002095572000, 0.002452194000, 0.002852216000,
-     0.003299115000, 0.003797466000, 0.004352768000, 0.004971717000,
-     0.005661014000, 0.006421615000, 0.007250312000, 0.008140173000,
-     0.009079860000, 0.010056080000, 0.011064560000, 0.012105220000,
-     0.013180140000, 0.014293770000, 0.015450040000, 0.016640930000,
-     0.017853020000, 0.019070180000, 0.020273690000, 0.021448050000,
-     0.022600410000, 0.023747890000, 0.024912470000, 0.026121060000,
-     0.027399230000, 0.028749930000, 0.030169090000, 0.031651450000,
-     0.033190380000, 0.034779120000, 0.036414950000, 0.038095690000,
-     0.039818430000, 0.041579400000, 0.043370980000, 0.045171800000,
-     0.046954200000, 0.048687180000, 0.050336570000, 0.051876110000,
-     0.053322180000, 0.054706030000, 0.056063350000, 0.057433930000,
-     0.058851070000, 0.060308090000, 0.061786440000, 0.063265700000,
-     0.064723520000, 0.066147490000, 0.067572560000, 0.069049280000,
-     0.070632800000, 0.072383390000, 0.074359600000, 0.076593830000,
-     0.079114360000, 0.081953450000, 0.085148160000, 0.088726570000,
-     0.092660080000, 0.096897230000, 0.101374600000, 0.106014500000,
-     0.110737700000, 0.115511100000, 0.120312200000, 0.125116100000,
-     0.129895700000, 0.134629900000, 0.139330900000, 0.144023500000,
-     0.148737200000, 0.153506600000, 0.158364400000, 0.163319900000,
-     0.168376100000, 0.173536500000, 0.178804800000, 0.184181900000,
-     0.189655900000, 0.195210100000, 0.200825900000, 0.206482800000,
-     0.212182600000, 0.218027900000, 0.224158600000, 0.230730200000,
-     0.237916000000, 0.245870600000, 0.254602300000, 0.264076000000,
-     0.274249000000, 0.285068000000, 0.296483700000, 0.308501000000,
-     0.321139300000, 0.334417500000, 0.348353600000, 0.362960100000,
-     0.378227500000, 0.394135900000, 0.410658200000, 0.427759500000,
-     0.445399300000, 0.463539600000, 0.482137600000, 0.501143000000,
-     0.520497200000, 0.540138700000, 0.560020800000, 0.580097200000,
-     0.600317200000, 0.620625600000, 0.640939800000, 0.661077200000,
-     0.680813400000, 0.699904400000, 0.718089000000, 0.735159300000,
-     0.751182100000, 0.766314300000, 0.780735200000, 0.794644800000,
-     0.808207400000, 0.821381700000, 0.834070100000, 0.846171100000,
-     0.857579900000, 0.868240800000, 0.878306100000, 0.887990700000,
-     0.897521100000, 0.907134700000, 0.916994700000, 0.926929500000,
-     0.936673100000, 0.945948200000, 0.954467500000, 0.961983400000,
-     0.968439000000, 0.973828900000, 0.978151900000, 0.981410600000,
-     0.983666900000, 0.985208100000, 0.986381300000, 0.987535700000,
-     0.989022800000, 0.991081100000, 0.993491300000, 0.995917200000,
-     0.998020500000, 0.999460800000, 0.999993000000, 0.999755700000,
-     0.998983900000, 0.997912300000, 0.996773700000, 0.995735600000,
-     0.994711500000, 0.993553400000, 0.992115600000, 0.990254900000,
-     0.987859600000, 0.984932400000, 0.981503600000, 0.977603500000,
-     0.973261100000, 0.968476400000, 0.963136900000, 0.957106200000,
-     0.950254000000, 0.942456900000, 0.933689700000, 0.924289300000,
-     0.914670700000, 0.905233300000, 0.896361300000, 0.888306900000,
-     0.880846200000, 0.873644500000, 0.866375500000, 0.858720300000,
-     0.850429500000, 0.841504700000, 0.832010900000, 0.822015400000,
-     0.811586800000, 0.800787400000, 0.789651500000, 0.778205300000,
-     0.766473300000, 0.754478500000, 0.742247300000, 0.729822900000,
-     0.717252500000, 0.704581800000, 0.691855300000, 0.679100900000,
-     0.666284600000, 0.653359500000, 0.640280700000, 0.627006600000,
-     0.613514800000, 0.599849400000, 0.586068200000, 0.572226100000,
-     0.558374600000, 0.544553500000, 0.530767300000, 0.517013000000,
-     0.503288900000, 0.489595000000, 0.475944200000, 0.462395800000,
-     0.449015400000, 0.435862200000, 0.422989700000, 0.410415200000,
-     0.398035600000, 0.385730000000, 0.373390700000, 0.360924500000,
-     0.348286000000, 0.335570200000, 0.322896300000, 0.310370400000,
-     0.298086500000, 0.286116000000, 0.274482200000, 0.263195300000,
-     0.252262800000, 0.241690200000, 0.231480900000, 0.221637800000,
-     0.212162200000, 0.203054200000, 0.194312400000, 0.185922700000,
-     0.177827400000, 0.169965400000, 0.162284100000, 0.154739700000,
-     0.147308100000, 0.140016900000, 0.132901300000, 0.125991300000,
-     0.119312000000, 0.112882000000, 0.106711300000, 0.100805200000,
-     0.095166530000, 0.089795940000, 0.084690440000, 0.079840090000,
-     0.075233720000, 0.070860610000, 0.066710450000, 0.062773600000,
-     0.059041790000, 0.055507030000, 0.052161390000, 0.048996990000,
-     0.046005780000, 0.043178850000, 0.040507550000, 0.037983760000,
-     0.035599820000, 0.033348560000, 0.031223320000, 0.029217800000,
-     0.027326010000, 0.025542230000, 0.023861210000, 0.022278590000,
-     0.020790200000, 0.019391850000, 0.018079390000, 0.016848170000,
-     0.015691880000, 0.014604460000, 0.013580620000, 0.012615730000,
-     0.011706960000, 0.010856080000, 0.010064760000, 0.009333376000,
-     0.008661284000, 0.008046048000, 0.007481130000, 0.006959987000,
-     0.006477070000, 0.006027677000, 0.005608169000, 0.005216691000,
-     0.004851785000, 0.004512008000, 0.004195941000, 0.003902057000,
-     0.003628371000, 0.003373005000, 0.003134315000, 0.002910864000,
-     0.002701528000, 0.002505796000, 0.002323231000, 0.002153333000,
-     0.001995557000, 0.001849316000, 0.001713976000, 0.001588899000,
-     0.001473453000, 0.001367022000, 0.001268954000, 0.001178421000,
-     0.001094644000, 0.001016943000, 0.000944726900, 0.000877517100,
-     0.000815043800, 0.000757075500, 0.000703375500, 0.000653705000,
-     0.000607804800, 0.000565343500, 0.000526004600, 0.000489506100,
-     0.000455597000, 0.000424054800, 0.000394686000, 0.000367317800,
-     0.000341794100, 0.000317973800, 0.000295744100, 0.000275055800,
-     0.000255864000, 0.000238114200, 0.000221744500, 0.000206671100,
-     0.000192747400, 0.000179831500, 0.000167802300, 0.000156556600,
-     0.000146016800, 0.000136153500, 0.000126945100, 0.000118367100,
-     0.000110392800, 0.000102990800, 0.000096118360, 0.000089733230,
-     0.000083796940, 0.000078274420, 0.000073133120, 0.000068341420,
-     0.000063870350, 0.000059693890, 0.000055788620, 0.000052135090,
-     0.000048721790, 0.000045538450, 0.000042574430, 0.000039818840,
-     0.000037258770, 0.000034874670, 0.000032647650, 0.000030561400,
-     0.000028601750, 0.000026758410, 0.000025029430, 0.000023413730,
-     0.000021909140, 0.000020512590, 0.000019219020, 0.000018017960,
-     0.000016898990, 0.000015853090, 0.000014872430, 0.000013950850,
-     0.000013085280, 0.000012273270, 0.000011512330, 0.000010800010,
-     0.000010133640, 0.000009509919, 0.000008925630, 0.000008377852,
-     0.000007863920, 0.000007381539, 0.000006929096, 0.000006505136,
-     0.000006108221, 0.000005736935, 0.000005389831, 0.000005065269,
-     0.000004761667, 0.000004477561, 0.000004211597, 0.000003962457,
-     0.000003728674, 0.000003508881, 0.000003301868, 0.000003106561,
-     0.000002922119, 0.000002748208, 0.000002584560, 0.000002430867,
-     0.000002286786, 0.000002151905, 0.000002025656, 0.000001907464,
-     0.000001796794, 0.000001693147, 0.000001596032, 0.000001504903,
-     0.000001419245, 0.000001338600, 0.000001262556, 0.000001190771,
-     0.000001123031, 0.000001059151, 0.000000998951, 0.000000942251,
-     0.000000888880, 0.000000838669, 0.000000791454, 0.000000747077,
-     0.000000705386});
+const SPD CMF::CIE_2012_2_y(detail::static_samples,
+                            k_cie_2012_2_y, 390.0f, 1.0f);
 
-const SPD CMF::CIE_2012_2_z(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.018472600000, 0.022211010000, 0.026698190000, 0.032069370000,
-     0.038478320000, 0.046097840000, 0.055119530000, 0.065752570000,
-     0.078221130000, 0.092760130000, 0.109609000000, 0.129007700000,
-     0.151204700000, 0.176444100000, 0.204951700000, 0.236924600000,
-     0.272512300000, 0.311782000000, 0.354706400000, 0.401147300000,
-     0.450836900000, 0.503416400000, 0.558636100000, 0.616273400000,
-     0.676098200000, 0.737882200000, 0.801301900000, 0.865557300000,
-     0.929579100000, 0.992129300000, 1.051821000000, 1.107509000000,
-     1.159527000000, 1.208869000000, 1.256834000000, 1.305008000000,
-     1.354758000000, 1.405594000000, 1.456414000000, 1.505960000000,
-     1.552826000000, 1.595902000000, 1.635768000000, 1.673573000000,
-     1.710604000000, 1.748280000000, 1.787504000000, 1.826609000000,
-     1.863108000000, 1.894332000000, 1.917479000000, 1.930529000000,
-     1.934819000000, 1.932650000000, 1.926395000000, 1.918437000000,
-     1.910430000000, 1.901224000000, 1.889000000000, 1.871996000000,
-     1.848545000000, 1.817792000000, 1.781627000000, 1.742514000000,
-     1.702749000000, 1.664439000000, 1.629207000000, 1.597360000000,
-     1.568896000000, 1.543823000000, 1.522157000000, 1.503611000000,
-     1.486673000000, 1.469595000000, 1.450709000000, 1.428440000000,
-     1.401587000000, 1.370094000000, 1.334220000000, 1.294275000000,
-     1.250610000000, 1.203696000000, 1.154316000000, 1.103284000000,
-     1.051347000000, 0.999178900000, 0.947395800000, 0.896622200000,
-     0.847398100000, 0.800157600000, 0.755237900000, 0.712787900000,
-     0.672519800000, 0.634097600000, 0.597243300000, 0.561731300000,
-     0.527492100000, 0.494880900000, 0.464258600000, 0.435884100000,
-     0.409931300000, 0.386426100000, 0.365056600000, 0.345481200000,
-     0.327409500000, 0.310593900000, 0.294810200000, 0.279819400000,
-     0.265410000000, 0.251408400000, 0.237675300000, 0.224121100000,
-     0.210748400000, 0.197583900000, 0.184657400000, 0.172001800000,
-     0.159691800000, 0.147941500000, 0.136942800000, 0.126827900000,
-     0.117679600000, 0.109497000000, 0.102094300000, 0.095279930000,
-     0.088900750000, 0.082835480000, 0.077009820000, 0.071440010000,
-     0.066154360000, 0.061171990000, 0.056504070000, 0.052151210000,
-     0.048095660000, 0.044317200000, 0.040797340000, 0.037519120000,
-     0.034468460000, 0.031637640000, 0.029019010000, 0.026603640000,
-     0.024381640000, 0.022340970000, 0.020464150000, 0.018734560000,
-     0.017137880000, 0.015661740000, 0.014296440000, 0.013037020000,
-     0.011878970000, 0.010817250000, 0.009846470000, 0.008960687000,
-     0.008152811000, 0.007416025000, 0.006744115000, 0.006131421000,
-     0.005572778000, 0.005063463000, 0.004599169000, 0.004175971000,
-     0.003790291000, 0.003438952000, 0.003119341000, 0.002829038000,
-     0.002565722000, 0.002327186000, 0.002111280000, 0.001915766000,
-     0.001738589000, 0.001577920000, 0.001432128000, 0.001299781000,
-     0.001179667000, 0.001070694000, 0.000971862300, 0.000882253100,
-     0.000801023100, 0.000727388400, 0.000660634700, 0.000600114600,
-     0.000545241600, 0.000495484700, 0.000450364200, 0.000409445500,
-     0.000372334500, 0.000338673900, 0.000308139600, 0.000280437000,
-     0.000255299600, 0.000232485900, 0.000211777200, 0.000192975800,
-     0.000175902400, 0.000160394700, 0.000146305900, 0.000133503100,
-     0.000121866000, 0.000111285700, 0.000101663400, 0.000092910030,
-     0.000084944680, 0.000077694250, 0.000071092470, 0.000065079360,
-     0.000059600610, 0.000054607060, 0.000050054170, 0.000045901570,
-     0.000042112680, 0.000038654370, 0.000035496610, 0.000032612200,
-     0.000029976430, 0.000027566930, 0.000025363390, 0.000023347380,
-     0.000021502210, 0.000019812680, 0.000018265000, 0.000016846670,
-     0.000015546310, 0.000014353600, 0.000013259150, 0.000012254430,
-     0.000011331690, 0.000010483870, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000});
+const SPD CMF::CIE_2012_2_z(detail::static_samples,
+                            k_cie_2012_2_z, 390.0f, 1.0f);
 
-const SPD CMF::CIE_2012_10_x(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.002952420000, 0.003577275000, 0.004332146000, 0.005241609000,
-     0.006333902000, 0.007641137000, 0.009199401000, 0.011048690000,
-     0.013232620000, 0.015797910000, 0.018793380000, 0.022269490000,
-     0.026279780000, 0.030878620000, 0.036118900000, 0.042049860000,
-     0.048712560000, 0.056128680000, 0.064298660000, 0.073198180000,
-     0.082773310000, 0.092953270000, 0.103713700000, 0.115052000000,
-     0.126977100000, 0.139512700000, 0.152666100000, 0.166305400000,
-     0.180219700000, 0.194144800000, 0.207764700000, 0.220791100000,
-     0.233235500000, 0.245246200000, 0.257039700000, 0.268898900000,
-     0.281067700000, 0.293396700000, 0.305593300000, 0.317316500000,
-     0.328179800000, 0.337867800000, 0.346509700000, 0.354395300000,
-     0.361865500000, 0.369308400000, 0.377010700000, 0.384685000000,
-     0.391859100000, 0.398019200000, 0.402618900000, 0.405263700000,
-     0.406248200000, 0.406066000000, 0.405228300000, 0.404252900000,
-     0.403480800000, 0.402536200000, 0.400867500000, 0.397932700000,
-     0.393213900000, 0.386410800000, 0.377951300000, 0.368417600000,
-     0.358347300000, 0.348221400000, 0.338383000000, 0.328830900000,
-     0.319497700000, 0.310334500000, 0.301311200000, 0.292375400000,
-     0.283327300000, 0.273946300000, 0.264035200000, 0.253422100000,
-     0.242013500000, 0.229934600000, 0.217361700000, 0.204467200000,
-     0.191417600000, 0.178367200000, 0.165440700000, 0.152739100000,
-     0.140343900000, 0.128316700000, 0.116712400000, 0.105612100000,
-     0.095085690000, 0.085182060000, 0.075931200000, 0.067331590000,
-     0.059320180000, 0.051841060000, 0.044861190000, 0.038367700000,
-     0.032372960000, 0.026920950000, 0.022040700000, 0.017739510000,
-     0.014007450000, 0.010822910000, 0.008168996000, 0.006044623000,
-     0.004462638000, 0.003446810000, 0.003009513000, 0.003090744000,
-     0.003611221000, 0.004491435000, 0.005652072000, 0.007035322000,
-     0.008669631000, 0.010607550000, 0.012904680000, 0.015619560000,
-     0.018816400000, 0.022569230000, 0.026944560000, 0.031999100000,
-     0.037781850000, 0.044306350000, 0.051465160000, 0.059122240000,
-     0.067142200000, 0.075389410000, 0.083766970000, 0.092335810000,
-     0.101194000000, 0.110436200000, 0.120151100000, 0.130396000000,
-     0.141131000000, 0.152294400000, 0.163828800000, 0.175683200000,
-     0.187811400000, 0.200162100000, 0.212682200000, 0.225319900000,
-     0.238025400000, 0.250778700000, 0.263677800000, 0.276860700000,
-     0.290479200000, 0.304699100000, 0.319648500000, 0.335244700000,
-     0.351329000000, 0.367714800000, 0.384185600000, 0.400531200000,
-     0.416666900000, 0.432542000000, 0.448106300000, 0.463310900000,
-     0.478144000000, 0.492748300000, 0.507331500000, 0.522131500000,
-     0.537417000000, 0.553421700000, 0.570124200000, 0.587409300000,
-     0.605126900000, 0.623089200000, 0.641099900000, 0.659065900000,
-     0.676943600000, 0.694714300000, 0.712384900000, 0.729997800000,
-     0.747647800000, 0.765425000000, 0.783400900000, 0.801627700000,
-     0.820104100000, 0.838684300000, 0.857193600000, 0.875465200000,
-     0.893340800000, 0.910677200000, 0.927355400000, 0.943250200000,
-     0.958224400000, 0.972130400000, 0.984923700000, 0.997006700000,
-     1.008907000000, 1.021163000000, 1.034327000000, 1.048753000000,
-     1.063937000000, 1.079166000000, 1.093723000000, 1.106886000000,
-     1.118106000000, 1.127493000000, 1.135317000000, 1.141838000000,
-     1.147304000000, 1.151897000000, 1.155582000000, 1.158284000000,
-     1.159934000000, 1.160477000000, 1.159890000000, 1.158259000000,
-     1.155692000000, 1.152293000000, 1.148163000000, 1.143345000000,
-     1.137685000000, 1.130993000000, 1.123097000000, 1.113846000000,
-     1.103152000000, 1.091121000000, 1.077902000000, 1.063644000000,
-     1.048485000000, 1.032546000000, 1.015870000000, 0.998485900000,
-     0.980422700000, 0.961711100000, 0.942411900000, 0.922704900000,
-     0.902780400000, 0.882812300000, 0.862958100000, 0.843273100000,
-     0.823474200000, 0.803234200000, 0.782271500000, 0.760349800000,
-     0.737373900000, 0.713647000000, 0.689533600000, 0.665356700000,
-     0.641398400000, 0.617872300000, 0.594848400000, 0.572360000000,
-     0.550435300000, 0.529097900000, 0.508372800000, 0.488300600000,
-     0.468917100000, 0.450248600000, 0.432312600000, 0.415079000000,
-     0.398365700000, 0.381984600000, 0.365782100000, 0.349635800000,
-     0.333493700000, 0.317477600000, 0.301729800000, 0.286368400000,
-     0.271490000000, 0.257163200000, 0.243410200000, 0.230238900000,
-     0.217652700000, 0.205650700000, 0.194225100000, 0.183353000000,
-     0.173009700000, 0.163171600000, 0.153816300000, 0.144923000000,
-     0.136472900000, 0.128448300000, 0.120832000000, 0.113607200000,
-     0.106757900000, 0.100268500000, 0.094123940000, 0.088309290000,
-     0.082810100000, 0.077612080000, 0.072700640000, 0.068061670000,
-     0.063681760000, 0.059548150000, 0.055649170000, 0.051975430000,
-     0.048517880000, 0.045267370000, 0.042214730000, 0.039349540000,
-     0.036657300000, 0.034124070000, 0.031737680000, 0.029487520000,
-     0.027367170000, 0.025381130000, 0.023533560000, 0.021825580000,
-     0.020255900000, 0.018818920000, 0.017499300000, 0.016281670000,
-     0.015153010000, 0.014102300000, 0.013121060000, 0.012205090000,
-     0.011351140000, 0.010555930000, 0.009816228000, 0.009128517000,
-     0.008488116000, 0.007890589000, 0.007332061000, 0.006809147000,
-     0.006319204000, 0.005861036000, 0.005433624000, 0.005035802000,
-     0.004666298000, 0.004323750000, 0.004006709000, 0.003713708000,
-     0.003443294000, 0.003194041000, 0.002964424000, 0.002752492000,
-     0.002556406000, 0.002374564000, 0.002205568000, 0.002048294000,
-     0.001902113000, 0.001766485000, 0.001640857000, 0.001524672000,
-     0.001417322000, 0.001318031000, 0.001226059000, 0.001140743000,
-     0.001061495000, 0.000987794900, 0.000919184700, 0.000855256800,
-     0.000795643300, 0.000740012000, 0.000688098000, 0.000639786400,
-     0.000594972600, 0.000553529100, 0.000515311300, 0.000480123400,
-     0.000447624500, 0.000417484600, 0.000389422100, 0.000363196900,
-     0.000338627900, 0.000315645200, 0.000294196600, 0.000274223500,
-     0.000255662400, 0.000238439000, 0.000222452500, 0.000207603600,
-     0.000193801800, 0.000180964900, 0.000169016700, 0.000157883900,
-     0.000147499300, 0.000137802600, 0.000128739400, 0.000120264400,
-     0.000112350200, 0.000104972500, 0.000098105960, 0.000091724770,
-     0.000085798610, 0.000080281740, 0.000075130130, 0.000070305650,
-     0.000065775320, 0.000061515080, 0.000057520250, 0.000053788130,
-     0.000050313500, 0.000047089160, 0.000044103220, 0.000041331500,
-     0.000038749920, 0.000036337620, 0.000034076530, 0.000031952420,
-     0.000029958080, 0.000028087810, 0.000026335810, 0.000024696300,
-     0.000023163110, 0.000021728550, 0.000020385190, 0.000019126250,
-     0.000017945550, 0.000016837760, 0.000015799070, 0.000014826040,
-     0.000013915270, 0.000013063450, 0.000012267200, 0.000011522790,
-     0.000010826630, 0.000010175400, 0.000009565993, 0.000008995405,
-     0.000008460253, 0.000007957382, 0.000007483997, 0.000007037621,
-     0.000006616311, 0.000006219265, 0.000005845844, 0.000005495311,
-     0.000005166853, 0.000004859511, 0.000004571973, 0.000004302920,
-     0.000004051121, 0.000003815429, 0.000003594719, 0.000003387736,
-     0.000003193301, 0.000003010363, 0.000002837980, 0.000002675365,
-     0.000002522020, 0.000002377511, 0.000002241417, 0.000002113325,
-     0.000001992830, 0.000001879542, 0.000001773083, 0.000001673086,
-     0.000001579199});
+const SPD CMF::CIE_2012_10_x(detail::static_samples,
+                             k_cie_2012_10_x, 390.0f, 1.0f);
 
-const SPD CMF::CIE_2012_10_y(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.000407677900, 0.000497776900, 0.000606475400, 0.000737004000,
-     0.000892938800, 0.001078166000, 0.001296816000, 0.001553159000,
-     0.001851463000, 0.002195795000, 0.002589775000, 0.003036799000,
-     0.003541926000, 0.004111422000, 0.004752618000, 0.005474207000,
-     0.006285034000, 0.007188068000, 0.008181786000, 0.009260417000,
-     0.010413030000, 0.011626420000, 0.012898840000, 0.014234420000,
-     0.015640800000, 0.017129680000, 0.018712650000, 0.020383940000,
-     0.022129350000, 0.023929850000, 0.025761330000, 0.027601560000,
-     0.029455130000, 0.031338840000, 0.033275750000, 0.035295540000,
-     0.037427050000, 0.039671370000, 0.042019980000, 0.044461660000,
-     0.046982260000, 0.049567420000, 0.052212190000, 0.054913870000,
-     0.057669190000, 0.060474290000, 0.063321950000, 0.066192710000,
-     0.069061850000, 0.071901900000, 0.074682880000, 0.077384520000,
-     0.080036010000, 0.082685240000, 0.085387450000, 0.088205370000,
-     0.091189250000, 0.094310410000, 0.097513460000, 0.100734900000,
-     0.103903000000, 0.106963900000, 0.109967600000, 0.112999200000,
-     0.116154100000, 0.119538900000, 0.123250300000, 0.127304700000,
-     0.131696400000, 0.136417800000, 0.141458600000, 0.146800300000,
-     0.152400200000, 0.158202100000, 0.164140000000, 0.170137300000,
-     0.176123300000, 0.182089600000, 0.188046300000, 0.194006500000,
-     0.199985900000, 0.206005400000, 0.212098100000, 0.218304100000,
-     0.224668600000, 0.231242600000, 0.238074100000, 0.245179800000,
-     0.252568200000, 0.260247900000, 0.268227100000, 0.276500500000,
-     0.285003500000, 0.293647500000, 0.302331900000, 0.310943800000,
-     0.319410500000, 0.327868300000, 0.336526300000, 0.345617600000,
-     0.355401800000, 0.366089300000, 0.377585700000, 0.389696000000,
-     0.402194700000, 0.414822700000, 0.427353900000, 0.439820600000,
-     0.452336000000, 0.465029800000, 0.478048200000, 0.491517300000,
-     0.505422400000, 0.519705700000, 0.534301200000, 0.549134400000,
-     0.564130200000, 0.579241600000, 0.594426400000, 0.609638800000,
-     0.624829600000, 0.639965600000, 0.655094300000, 0.670290300000,
-     0.685637500000, 0.701229200000, 0.717110300000, 0.733091700000,
-     0.748904100000, 0.764253000000, 0.778819900000, 0.792341000000,
-     0.804851000000, 0.816474700000, 0.827352000000, 0.837635800000,
-     0.847465300000, 0.856886800000, 0.865924200000, 0.874604100000,
-     0.882955200000, 0.891027400000, 0.898949500000, 0.906875300000,
-     0.914965200000, 0.923385800000, 0.932232500000, 0.941286200000,
-     0.950237800000, 0.958764700000, 0.966532500000, 0.973250400000,
-     0.978841500000, 0.983286700000, 0.986572000000, 0.988688700000,
-     0.989705600000, 0.989984900000, 0.989962400000, 0.990073100000,
-     0.990750000000, 0.992282600000, 0.994383700000, 0.996622100000,
-     0.998564900000, 0.999777500000, 0.999944000000, 0.999220000000,
-     0.997879300000, 0.996193400000, 0.994430400000, 0.992783100000,
-     0.991157800000, 0.989392500000, 0.987328800000, 0.984812700000,
-     0.981725300000, 0.978071400000, 0.973886000000, 0.969202800000,
-     0.964054500000, 0.958440900000, 0.952237900000, 0.945296800000,
-     0.937477300000, 0.928649500000, 0.918795300000, 0.908301400000,
-     0.897635200000, 0.887240100000, 0.877536000000, 0.868792000000,
-     0.860747400000, 0.853023300000, 0.845253500000, 0.837083800000,
-     0.828240900000, 0.818732000000, 0.808635200000, 0.798029600000,
-     0.786995000000, 0.775604000000, 0.763899600000, 0.751915700000,
-     0.739683200000, 0.727230900000, 0.714587800000, 0.701792600000,
-     0.688886600000, 0.675910300000, 0.662903500000, 0.649891100000,
-     0.636841000000, 0.623709200000, 0.610454100000, 0.597037500000,
-     0.583439500000, 0.569704400000, 0.555889200000, 0.542047500000,
-     0.528229600000, 0.514474600000, 0.500788100000, 0.487168700000,
-     0.473616000000, 0.460130800000, 0.446726000000, 0.433458900000,
-     0.420391900000, 0.407581000000, 0.395075500000, 0.382889400000,
-     0.370919000000, 0.359044700000, 0.347161500000, 0.335179400000,
-     0.323056200000, 0.310885900000, 0.298784000000, 0.286852700000,
-     0.275180700000, 0.263834300000, 0.252833000000, 0.242183500000,
-     0.231890400000, 0.221956400000, 0.212382600000, 0.203169800000,
-     0.194317900000, 0.185825000000, 0.177688200000, 0.169892600000,
-     0.162382200000, 0.155098600000, 0.147991800000, 0.141020300000,
-     0.134161400000, 0.127440100000, 0.120888700000, 0.114534500000,
-     0.108399600000, 0.102500700000, 0.096845880000, 0.091439440000,
-     0.086283180000, 0.081376870000, 0.076717080000, 0.072294040000,
-     0.068096960000, 0.064115490000, 0.060339760000, 0.056760540000,
-     0.053369920000, 0.050160270000, 0.047124050000, 0.044253830000,
-     0.041542050000, 0.038980420000, 0.036560910000, 0.034275970000,
-     0.032118520000, 0.030081920000, 0.028160010000, 0.026346980000,
-     0.024637310000, 0.023025740000, 0.021507430000, 0.020078380000,
-     0.018734740000, 0.017472690000, 0.016288410000, 0.015177670000,
-     0.014134730000, 0.013154080000, 0.012230920000, 0.011361060000,
-     0.010541900000, 0.009775050000, 0.009061962000, 0.008402962000,
-     0.007797457000, 0.007243230000, 0.006734381000, 0.006265001000,
-     0.005830085000, 0.005425391000, 0.005047634000, 0.004695140000,
-     0.004366592000, 0.004060685000, 0.003776140000, 0.003511578000,
-     0.003265211000, 0.003035344000, 0.002820496000, 0.002619372000,
-     0.002430960000, 0.002254796000, 0.002090489000, 0.001937586000,
-     0.001795595000, 0.001663989000, 0.001542195000, 0.001429639000,
-     0.001325752000, 0.001229980000, 0.001141734000, 0.001060269000,
-     0.000984885400, 0.000914970300, 0.000849990300, 0.000789515800,
-     0.000733303800, 0.000681145800, 0.000632828700, 0.000588137500,
-     0.000546838900, 0.000508634900, 0.000473240300, 0.000440401600,
-     0.000409892800, 0.000381513700, 0.000355090200, 0.000330466800,
-     0.000307503000, 0.000286071800, 0.000266071800, 0.000247458600,
-     0.000230191900, 0.000214222500, 0.000199494900, 0.000185933600,
-     0.000173406700, 0.000161786500, 0.000150964100, 0.000140846600,
-     0.000131364200, 0.000122490500, 0.000114206000, 0.000106488600,
-     0.000099314390, 0.000092655120, 0.000086472250, 0.000080727800,
-     0.000075387160, 0.000070418780, 0.000065793380, 0.000061482500,
-     0.000057460080, 0.000053702720, 0.000050189340, 0.000046902450,
-     0.000043831670, 0.000040967800, 0.000038301230, 0.000035822180,
-     0.000033519030, 0.000031374190, 0.000029370680, 0.000027493800,
-     0.000025730830, 0.000024072490, 0.000022517040, 0.000021063500,
-     0.000019709910, 0.000018453530, 0.000017289790, 0.000016209280,
-     0.000015202620, 0.000014261690, 0.000013379460, 0.000012550380,
-     0.000011771690, 0.000011041180, 0.000010356620, 0.000009715798,
-     0.000009116316, 0.000008555201, 0.000008029561, 0.000007536768,
-     0.000007074424, 0.000006640464, 0.000006233437, 0.000005852035,
-     0.000005494963, 0.000005160948, 0.000004848687, 0.000004556705,
-     0.000004283580, 0.000004027993, 0.000003788729, 0.000003564599,
-     0.000003354285, 0.000003156557, 0.000002970326, 0.000002794625,
-     0.000002628701, 0.000002472248, 0.000002325030, 0.000002186768,
-     0.000002057152, 0.000001935813, 0.000001822239, 0.000001715914,
-     0.000001616355, 0.000001523114, 0.000001435750, 0.000001353771,
-     0.000001276714, 0.000001204166, 0.000001135758, 0.000001071181,
-     0.000001010243, 0.000000952778, 0.000000898622, 0.000000847617,
-     0.000000799605, 0.000000754436, 0.000000711962, 0.000000672042,
-     0.000000634538});
+const SPD CMF::CIE_2012_10_y(detail::static_samples,
+                             k_cie_2012_10_y, 390.0f, 1.0f);
 
-const SPD CMF::CIE_2012_10_z(
-    {390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
-     405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
-     420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
-     435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
-     450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
-     465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
-     480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
-     495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-     510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
-     525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
-     540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-     555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
-     570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
-     585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
-     600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
-     615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
-     630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
-     645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
-     660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
-     675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
-     690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
-     705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
-     720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
-     735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
-     750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
-     765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
-     780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
-     795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
-     810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824,
-     825, 826, 827, 828, 829, 830},
-    {0.013187520000, 0.015978790000, 0.019357580000, 0.023437580000,
-     0.028350210000, 0.034245880000, 0.041294670000, 0.049686410000,
-     0.059629640000, 0.071349260000, 0.085082540000, 0.101075300000,
-     0.119583800000, 0.140864700000, 0.165164400000, 0.192706500000,
-     0.223678200000, 0.258210900000, 0.296363200000, 0.338101800000,
-     0.383282200000, 0.431688400000, 0.483244000000, 0.537934500000,
-     0.595774000000, 0.656818700000, 0.721045900000, 0.787863500000,
-     0.856339100000, 0.925301700000, 0.993344400000, 1.059178000000,
-     1.122832000000, 1.184947000000, 1.246476000000, 1.308674000000,
-     1.372628000000, 1.437661000000, 1.502449000000, 1.565456000000,
-     1.624940000000, 1.679488000000, 1.729668000000, 1.776755000000,
-     1.822228000000, 1.867751000000, 1.914504000000, 1.961055000000,
-     2.005136000000, 2.044296000000, 2.075946000000, 2.098231000000,
-     2.112591000000, 2.121427000000, 2.127239000000, 2.132574000000,
-     2.139093000000, 2.144815000000, 2.146832000000, 2.142250000000,
-     2.128264000000, 2.103205000000, 2.069388000000, 2.030030000000,
-     1.988178000000, 1.946651000000, 1.907521000000, 1.870689000000,
-     1.835578000000, 1.801657000000, 1.768440000000, 1.735338000000,
-     1.701254000000, 1.665053000000, 1.625712000000, 1.582342000000,
-     1.534439000000, 1.482544000000, 1.427438000000, 1.369876000000,
-     1.310576000000, 1.250226000000, 1.189511000000, 1.129050000000,
-     1.069379000000, 1.010952000000, 0.954180900000, 0.899525300000,
-     0.847372000000, 0.798009300000, 0.751638900000, 0.708264500000,
-     0.667386700000, 0.628479800000, 0.591117400000, 0.554961900000,
-     0.519884300000, 0.486277200000, 0.454549700000, 0.424995500000,
-     0.397811400000, 0.373021800000, 0.350261800000, 0.329140700000,
-     0.309335600000, 0.290581600000, 0.272677300000, 0.255514300000,
-     0.239018800000, 0.223133500000, 0.207815800000, 0.193040700000,
-     0.178808900000, 0.165128700000, 0.152010300000, 0.139464300000,
-     0.127535300000, 0.116377100000, 0.106116100000, 0.096822660000,
-     0.088523890000, 0.081182630000, 0.074631320000, 0.068706440000,
-     0.063278340000, 0.058244840000, 0.053538120000, 0.049148630000,
-     0.045075110000, 0.041311750000, 0.037849160000, 0.034672340000,
-     0.031754710000, 0.029070290000, 0.026596510000, 0.024313750000,
-     0.022206770000, 0.020268520000, 0.018492460000, 0.016870840000,
-     0.015395050000, 0.014054500000, 0.012833540000, 0.011717540000,
-     0.010694150000, 0.009753000000, 0.008886096000, 0.008089323000,
-     0.007359131000, 0.006691736000, 0.006083223000, 0.005529423000,
-     0.005025504000, 0.004566879000, 0.004149405000, 0.003769336000,
-     0.003423302000, 0.003108313000, 0.002821650000, 0.002560830000,
-     0.002323578000, 0.002107847000, 0.001911867000, 0.001734006000,
-     0.001572736000, 0.001426627000, 0.001294325000, 0.001174475000,
-     0.001065842000, 0.000967321500, 0.000877926400, 0.000796784700,
-     0.000723150200, 0.000656350100, 0.000595767800, 0.000540838500,
-     0.000491044100, 0.000445904600, 0.000404982600, 0.000367881800,
-     0.000334242900, 0.000303740700, 0.000276080900, 0.000250997000,
-     0.000228247400, 0.000207612900, 0.000188894800, 0.000171912700,
-     0.000156503000, 0.000142517700, 0.000129823000, 0.000118297400,
-     0.000107831000, 0.000098324550, 0.000089687870, 0.000081839540,
-     0.000074705820, 0.000068219910, 0.000062321320, 0.000056955340,
-     0.000052072450, 0.000047627810, 0.000043580820, 0.000039894680,
-     0.000036536120, 0.000033474990, 0.000030684000, 0.000028138390,
-     0.000025815740, 0.000023695740, 0.000021759980, 0.000019991790,
-     0.000018376030, 0.000016898960, 0.000015548150, 0.000014312310,
-     0.000013181190, 0.000012145480, 0.000011196730, 0.000010327270,
-     0.000009530130, 0.000008798979, 0.000008128065, 0.000007512160,
-     0.000006946506, 0.000006426776, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000, 0.000000000000, 0.000000000000, 0.000000000000,
-     0.000000000000});
+const SPD CMF::CIE_2012_10_z(detail::static_samples,
+                             k_cie_2012_10_z, 390.0f, 1.0f);
 }
@@ -2,7 +2,8 @@
 
 #include "color/spectral_power_distribution.hpp"
 
-#include <unordered_map>
+#include <stdexcept>
+#include <string>
 
 namespace color {
 
@@ -14,13 +15,31 @@ struct CMF {
         CIE_2012_10degree
     };
 
-    CMF(const SPD& x_bar, const SPD& y_bar, const SPD& z_bar)
+    /// Number of built-in CMFs. IDs from here on are of CMFs added by add()
+    static constexpr int num_builtin = 4;
+
+    constexpr CMF(const SPD& x_bar, const SPD& y_bar, const SPD& z_bar)
         : x_bar(x_bar), y_bar(y_bar), z_bar(z_bar) {}
 
+    /// The CMF with id. A constant expression for the built-in CMFs. Throws
+    /// std::out_of_range if there is no CMF with id
+    static constexpr auto get(ID id) -> const CMF&;
+
+    /// Name of the CMF with id: the enumerator's for the built-in CMFs.
+    /// Throws std::out_of_range if there is no CMF with id
+    static auto name(ID id) -> const char*;
 
-    static const CMF& get(ID cmf) {
-        return _cmf_map.at(int(cmf));
-    }
+    /**
+     * @brief Add a CMF made of copies of x_bar, y_bar and z_bar under name,
+     * returning its ID
+     * @details CMFs are never removed, so references to them stay valid.
+     * Safe to call while other threads are getting CMFs
+     */
+    static auto add(std::string name, SPD x_bar, SPD y_bar, SPD z_bar) -> ID;
+
+    /// Set id to that of the CMF called name, returning false if there is
+    /// none
+    static auto find(const std::string& name, ID& id) -> bool;
 
     const SPD& x_bar;
     const SPD& y_bar;
@@ -43,8 +62,21 @@ struct CMF {
     static const SPD CIE_2012_10_x;
     static const SPD CIE_2012_10_y;
     static const SPD CIE_2012_10_z;
-
-private:
-    static const std::unordered_map<int, const CMF&> _cmf_map;
 };
+
+namespace detail {
+// indexed by ID
+constexpr const CMF* k_cmfs[CMF::num_builtin] = {
+    &CMF::CIE_1931_2degree, &CMF::CIE_1964_10degree, &CMF::CIE_2012_2degree,
+    &CMF::CIE_2012_10degree};
+
+/// The CMF added as id, throwing std::out_of_range if there is none
+auto added_cmf(CMF::ID id) -> const CMF&;
+} // namespace detail
+
+constexpr auto CMF::get(ID id) -> const CMF& {
+    return unsigned(id) < unsigned(num_builtin) ? *detail::k_cmfs[int(id)]
+                                                : detail::added_cmf(id);
 }
+
+} // namespace color
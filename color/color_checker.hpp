@@ -3,11 +3,30 @@
 #include "color/spectral_power_distribution.hpp"
 #include "color/rgb.hpp"
 
-#include <unordered_map>
+#include <stdexcept>
+#include <string>
 
 namespace color {
 namespace ColorChecker {
 namespace BabelAverage {
+
+/// The patches of the chart, in reading order from the top left
+enum class Patch : int {
+    dark_skin, light_skin, blue_sky, foliage, blue_flower, bluish_green,
+    orange, purplish_blue, moderate_red, purple, yellow_green, orange_yellow,
+    blue, green, red, yellow, magenta, cyan, white_95, neutral_80, neutral_65,
+    neutral_50, neutral_35, black_20
+};
+
+constexpr int num_patches = 24;
+
+/// Name of patch, spelled as its enumerator. The lookups by patch throw
+/// std::out_of_range for a value outside the enumeration
+constexpr auto name(Patch patch) -> const char*;
+
+/// Set patch to the one called name, returning false if there is none
+auto find(const std::string& name, Patch& patch) -> bool;
+
 namespace Spectrum {
 extern const SPD dark_skin;
 extern const SPD light_skin;
@@ -33,8 +52,11 @@ extern const SPD neutral_65;
 extern const SPD neutral_50;
 extern const SPD neutral_35;
 extern const SPD black_20;
-extern const std::unordered_map<std::string, SPD> map;
-}
+
+/// Reflectance of patch. A constant expression
+constexpr auto get(Patch patch) -> const SPD&;
+} // namespace Spectrum
+
 namespace sRGB {
 extern const RGBu8 dark_skin;
 extern const RGBu8 light_skin;
@@ -60,8 +82,58 @@ extern const RGBu8 neutral_65;
 extern const RGBu8 neutral_50;
 extern const RGBu8 neutral_35;
 extern const RGBu8 black_20;
-extern const std::unordered_map<std::string, RGBu8> map;
-}
+
+/// Colour of patch. A constant expression
+constexpr auto get(Patch patch) -> const RGBu8&;
+} // namespace sRGB
+
+namespace detail {
+// indexed by Patch
+constexpr const char* k_names[num_patches] = {
+    "dark_skin", "light_skin", "blue_sky", "foliage", "blue_flower",
+    "bluish_green", "orange", "purplish_blue", "moderate_red", "purple",
+    "yellow_green", "orange_yellow", "blue", "green", "red", "yellow",
+    "magenta", "cyan", "white_95", "neutral_80", "neutral_65", "neutral_50",
+    "neutral_35", "black_20"};
+
+constexpr const SPD* k_spectra[num_patches] = {
+    &Spectrum::dark_skin, &Spectrum::light_skin, &Spectrum::blue_sky,
+    &Spectrum::foliage, &Spectrum::blue_flower, &Spectrum::bluish_green,
+    &Spectrum::orange, &Spectrum::purplish_blue, &Spectrum::moderate_red,
+    &Spectrum::purple, &Spectrum::yellow_green, &Spectrum::orange_yellow,
+    &Spectrum::blue, &Spectrum::green, &Spectrum::red, &Spectrum::yellow,
+    &Spectrum::magenta, &Spectrum::cyan, &Spectrum::white_95,
+    &Spectrum::neutral_80, &Spectrum::neutral_65, &Spectrum::neutral_50,
+    &Spectrum::neutral_35, &Spectrum::black_20};
+
+constexpr const RGBu8* k_srgb[num_patches] = {
+    &sRGB::dark_skin, &sRGB::light_skin, &sRGB::blue_sky, &sRGB::foliage,
+    &sRGB::blue_flower, &sRGB::bluish_green, &sRGB::orange,
+    &sRGB::purplish_blue, &sRGB::moderate_red, &sRGB::purple,
+    &sRGB::yellow_green, &sRGB::orange_yellow, &sRGB::blue, &sRGB::green,
+    &sRGB::red, &sRGB::yellow, &sRGB::magenta, &sRGB::cyan, &sRGB::white_95,
+    &sRGB::neutral_80, &sRGB::neutral_65, &sRGB::neutral_50, &sRGB::neutral_35,
+    &sRGB::black_20};
+} // namespace detail
+
+constexpr auto name(Patch patch) -> const char* {
+    return unsigned(patch) < unsigned(num_patches)
+               ? detail::k_names[int(patch)]
+               : throw std::out_of_range("unknown ColorChecker patch");
 }
+
+constexpr auto Spectrum::get(Patch patch) -> const SPD& {
+    return unsigned(patch) < unsigned(num_patches)
+               ? *detail::k_spectra[int(patch)]
+               : throw std::out_of_range("unknown ColorChecker patch");
 }
+
+constexpr auto sRGB::get(Patch patch) -> const RGBu8& {
+    return unsigned(patch) < unsigned(num_patches)
+               ? *detail::k_srgb[int(patch)]
+               : throw std::out_of_range("unknown ColorChecker patch");
 }
+
+} // namespace BabelAverage
+} // namespace ColorChecker
+} // namespace color
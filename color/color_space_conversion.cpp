@@ -0,0 +1,157 @@
+#include "color/color_space_conversion.hpp"
+#include "color/kernels.hpp"
+#include "color/parallel.hpp"
+#include "color/tile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace color {
+
+namespace {
+bool is_identity_matrix(const M33f& m) {
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            if (std::abs(m[i][j] - (i == j ? 1.0f : 0.0f)) > 1e-6f) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// conversions between spaces we haven't seen before get built once and
+// shared. the cache is dropped wholesale when it gets large, since in
+// practice a handful of conversions are in use at any one time
+constexpr size_t k_max_cached_conversions = 256;
+
+// true if a and b encode identically. custom curves can't be compared
+bool same_encoding(const TransferFunction& a, const TransferFunction& b) {
+    using Curve = TransferFunction::Curve;
+    if (a.is_linear() && b.is_linear()) {
+        return true;
+    }
+    return a.curve() == b.curve() && a.curve() != Curve::Custom &&
+           (a.curve() != Curve::Gamma || a.gamma() == b.gamma());
+}
+} // namespace
+
+ColorSpaceConversion::ColorSpaceConversion(const ColorSpaceRGB& src,
+                                           const ColorSpaceRGB& dst,
+                                           ChromaticAdaptation method)
+    : _matrix(dst.m_xyz_to_rgb *
+              chromatic_adaptation_matrix(src.white_point.xy,
+                                          dst.white_point.xy, method) *
+              src.m_rgb_to_xyz),
+      _matrix_identity(is_identity_matrix(_matrix)), _decode(src.eotf),
+      _encode(dst.oetf) {
+    if (_matrix_identity) {
+        _matrix = M33f();
+        // same primaries and white: if the encodings match too there's
+        // nothing to do at all
+        if (same_encoding(src.oetf, dst.oetf)) {
+            _decode = TransferFunction();
+            _encode = TransferFunction();
+        }
+    }
+}
+
+auto ColorSpaceConversion::get(const ColorSpaceRGB& src,
+                               const ColorSpaceRGB& dst,
+                               ChromaticAdaptation method)
+    -> std::shared_ptr<const ColorSpaceConversion> {
+    // custom curves can't be compared, so conversions using them can't be
+    // shared
+    using Curve = TransferFunction::Curve;
+    if (src.eotf.curve() == Curve::Custom ||
+        src.oetf.curve() == Curve::Custom ||
+        dst.oetf.curve() == Curve::Custom) {
+        return std::make_shared<const ColorSpaceConversion>(src, dst, method);
+    }
+
+    // everything the conversion is built from
+    using Key = std::array<f32, 29>;
+    Key key;
+    auto it = key.begin();
+    it = std::copy(src.m_rgb_to_xyz[0], src.m_rgb_to_xyz[0] + 9, it);
+    it = std::copy(dst.m_xyz_to_rgb[0], dst.m_xyz_to_rgb[0] + 9, it);
+    for (V2f xy : {src.white_point.xy, dst.white_point.xy}) {
+        *it++ = xy.x;
+        *it++ = xy.y;
+    }
+    for (const TransferFunction* tf : {&src.eotf, &src.oetf, &dst.oetf}) {
+        *it++ = f32(tf->curve());
+        *it++ = tf->gamma();
+    }
+    *it = f32(method);
+
+    static std::mutex mutex;
+    static std::map<Key, std::shared_ptr<const ColorSpaceConversion>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = cache.find(key);
+    if (found != cache.end()) {
+        return found->second;
+    }
+    if (cache.size() >= k_max_cached_conversions) {
+        cache.clear();
+    }
+    auto conversion =
+        std::make_shared<const ColorSpaceConversion>(src, dst, method);
+    cache.emplace(key, conversion);
+    return conversion;
+}
+
+auto xyz_to_rgb_matrix(const ColorSpaceRGB& cs, V2f src_white,
+                       ChromaticAdaptation method) -> M33f {
+    return cs.m_xyz_to_rgb *
+           chromatic_adaptation_matrix(src_white, cs.white_point.xy, method);
+}
+
+void ColorSpaceConversion::apply(RGBf32* c, size_t n) const {
+    if (is_identity()) {
+        return;
+    }
+
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        _decode.apply(c + begin, end - begin);
+        _transform_encode(c + begin, end - begin);
+    });
+}
+
+void ColorSpaceConversion::apply(const RGBf16* src, RGBf32* dst,
+                                 size_t n) const {
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        _decode.apply(src + begin, dst + begin, end - begin);
+        _transform_encode(dst + begin, end - begin);
+    });
+}
+
+void ColorSpaceConversion::apply(const RGBu16* src, RGBf32* dst,
+                                 size_t n) const {
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        _decode.apply(src + begin, dst + begin, end - begin);
+        _transform_encode(dst + begin, end - begin);
+    });
+}
+
+void ColorSpaceConversion::apply(const RGBu8* src, RGBf32* dst,
+                                 size_t n) const {
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        _decode.apply(src + begin, dst + begin, end - begin);
+        _transform_encode(dst + begin, end - begin);
+    });
+}
+
+void ColorSpaceConversion::_transform_encode(RGBf32* c, size_t n) const {
+    if (!_matrix_identity) {
+        detail::kernels().transform(_matrix[0], c, n);
+    }
+    _encode.apply(c, n);
+}
+
+} // namespace color
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "color/chromatic_adaptation.hpp"
+#include "color/color_space_rgb.hpp"
+
+#include <memory>
+
+namespace color {
+
+/**
+ * @brief Direct conversion from one RGB color space to another
+ * @details The two matrices through XYZ, and any adaptation between the
+ * white points, are fused into a single 3x3. The source is only linearised
+ * and the result only re-encoded when the transfer functions require it,
+ * and a conversion between spaces with the same primaries, white point and
+ * encoding passes colours through as-is.
+ */
+class ColorSpaceConversion {
+public:
+    ColorSpaceConversion(
+        const ColorSpaceRGB& src, const ColorSpaceRGB& dst,
+        ChromaticAdaptation method = ChromaticAdaptation::None);
+
+    /**
+     * @brief The shared conversion between src and dst
+     * @details Built on first use and kept in a thread-safe cache keyed on
+     * the matrices, white points and transfer curves of the two color
+     * spaces and the adaptation method, so the spaces needn't outlive it.
+     * Spaces with Custom curves can't be compared, so get a conversion of
+     * their own each time
+     */
+    static auto get(const ColorSpaceRGB& src, const ColorSpaceRGB& dst,
+                    ChromaticAdaptation method = ChromaticAdaptation::None)
+        -> std::shared_ptr<const ColorSpaceConversion>;
+
+    /// m_xyz_to_rgb of dst times the adaptation from src's white point to
+    /// dst's times m_rgb_to_xyz of src
+    const M33f& matrix() const { return _matrix; }
+    /// Decoding applied to source colours. Linear if none is needed
+    const TransferFunction& decode() const { return _decode; }
+    /// Encoding applied to the result. Linear if none is needed
+    const TransferFunction& encode() const { return _encode; }
+    /// True if the matrix is the identity
+    bool is_matrix_identity() const { return _matrix_identity; }
+    /// True if colours come out exactly as they go in
+    bool is_identity() const {
+        return _matrix_identity && _decode.is_linear() && _encode.is_linear();
+    }
+
+    RGBf32 operator()(RGBf32 c) const {
+        c = _decode(c);
+        if (!_matrix_identity) {
+            const M33f& m = _matrix;
+            c = RGBf32(m[0][0] * c.r + m[0][1] * c.g + m[0][2] * c.b,
+                       m[1][0] * c.r + m[1][1] * c.g + m[1][2] * c.b,
+                       m[2][0] * c.r + m[2][1] * c.g + m[2][2] * c.b);
+        }
+        return _encode(c);
+    }
+
+    /// Convert n colours in place, in parallel, see set_num_threads()
+    void apply(RGBf32* c, size_t n) const;
+
+    /// Convert n half-float colours into dst. Built-in source encodings are
+    /// decoded by table lookup, see TransferFunction::table_f16()
+    void apply(const RGBf16* src, RGBf32* dst, size_t n) const;
+
+    /// Convert n 16-bit colours into dst, taking code value v as v / 65535.
+    /// Built-in source encodings are decoded by table lookup
+    void apply(const RGBu16* src, RGBf32* dst, size_t n) const;
+
+    /// Convert n 8-bit colours into dst, taking code value v as v / 255.
+    /// Built-in source encodings are decoded by table lookup
+    void apply(const RGBu8* src, RGBf32* dst, size_t n) const;
+
+private:
+    // the matrix and encode steps on n decoded colours, in place
+    void _transform_encode(RGBf32* c, size_t n) const;
+
+    M33f _matrix;
+    bool _matrix_identity;
+    TransferFunction _decode;
+    TransferFunction _encode;
+};
+
+/// Convert rgb from src to dst. Prefer holding on to
+/// ColorSpaceConversion::get(src, dst) when converting many colours
+inline auto rgb_to_rgb(RGBf32 rgb, const ColorSpaceRGB& src,
+                       const ColorSpaceRGB& dst,
+                       ChromaticAdaptation method = ChromaticAdaptation::None)
+    -> RGBf32 {
+    return (*ColorSpaceConversion::get(src, dst, method))(rgb);
+}
+
+/**
+ * @brief Matrix taking XYZ relative to src_white to linear RGB in cs
+ * @details cs.m_xyz_to_rgb with the adaptation from src_white to cs's white
+ * point folded in. The adaptation matrix is cached, so this is a single 3x3
+ * product
+ */
+auto xyz_to_rgb_matrix(const ColorSpaceRGB& cs, V2f src_white,
+                       ChromaticAdaptation method) -> M33f;
+
+} // namespace color
@@ -2,30 +2,50 @@
 
 namespace color {
 
-const ColorSpaceRGB::Primaries
-    ColorSpaceRGB::Primaries::itur_bt709(Chromaticity(0.64, 0.33),
-                                         Chromaticity(0.30, 0.60),
-                                         Chromaticity(0.15, 0.06));
+namespace {
+// chromaticities of the built-in spaces as {x, y}, in double precision so
+// that their matrices are derived without round-off at compile time
+constexpr double k_bt709[3][2] = {{0.64, 0.33}, {0.30, 0.60}, {0.15, 0.06}};
+constexpr double k_d65[2] = {0.3128, 0.3290};
+constexpr double k_d50[2] = {0.3457, 0.3585};
+constexpr double k_d60[2] = {0.32168, 0.33767};
 
+constexpr detail::M33d k_bt709_xyz_to_rgb = detail::xyz_to_rgb_matrix(
+    k_bt709[0][0], k_bt709[0][1], k_bt709[1][0], k_bt709[1][1],
+    k_bt709[2][0], k_bt709[2][1], k_d65[0], k_d65[1]);
+constexpr detail::M33d k_bt709_rgb_to_xyz =
+    detail::inverse(k_bt709_xyz_to_rgb);
+
+auto chromaticity(const double (&xy)[2]) -> Chromaticity {
+    return Chromaticity(f32(xy[0]), f32(xy[1]));
+}
+} // namespace
+
+const ColorSpaceRGB::Primaries ColorSpaceRGB::Primaries::itur_bt709(
+    chromaticity(k_bt709[0]), chromaticity(k_bt709[1]),
+    chromaticity(k_bt709[2]));
+
+const ColorSpaceRGB::WhitePoint
+    ColorSpaceRGB::WhitePoint::D65(chromaticity(k_d65), Illuminant::ID::D65);
 const ColorSpaceRGB::WhitePoint
-    ColorSpaceRGB::WhitePoint::D65(Chromaticity(0.3128f, 0.3290f),
-                                   Illuminant::ID::D65);
+    ColorSpaceRGB::WhitePoint::D50(chromaticity(k_d50), Illuminant::ID::D50);
 const ColorSpaceRGB::WhitePoint
-    ColorSpaceRGB::WhitePoint::D60(Chromaticity(0.32168f, 0.33767f),
-                                   Illuminant::ID::D60);
+    ColorSpaceRGB::WhitePoint::D60(chromaticity(k_d60), Illuminant::ID::D60);
 
 const ColorSpaceRGB ColorSpaceRGB::ITUR_BT709(
     "ITU-R BT.709", ColorSpaceRGB::Primaries::itur_bt709,
-    ColorSpaceRGB::WhitePoint::D65, OETF::rec709, EOTF::rec709);
+    ColorSpaceRGB::WhitePoint::D65, k_bt709_xyz_to_rgb, k_bt709_rgb_to_xyz,
+    OETF::rec709, EOTF::rec709);
 
 const ColorSpaceRGB ColorSpaceRGB::ITUR_BT709_linear(
     "ITU-R BT.709 (linear)", ColorSpaceRGB::Primaries::itur_bt709,
-    ColorSpaceRGB::WhitePoint::D65, OETF::linear, EOTF::linear);
+    ColorSpaceRGB::WhitePoint::D65, k_bt709_xyz_to_rgb, k_bt709_rgb_to_xyz,
+    OETF::linear, EOTF::linear);
 
-const ColorSpaceRGB
-    ColorSpaceRGB::ITUR_sRGB("sRGB", ColorSpaceRGB::Primaries::itur_bt709,
-                             ColorSpaceRGB::WhitePoint::D65, OETF::sRGB,
-                             EOTF::sRGB);
+const ColorSpaceRGB ColorSpaceRGB::ITUR_sRGB(
+    "sRGB", ColorSpaceRGB::Primaries::itur_bt709,
+    ColorSpaceRGB::WhitePoint::D65, k_bt709_xyz_to_rgb, k_bt709_rgb_to_xyz,
+    OETF::sRGB, EOTF::sRGB);
 
 RGBf32 xyz_to_rgb(XYZ xyz, const ColorSpaceRGB& cs, bool ignore_transfer) {
     RGBf32 rgb;
@@ -3,61 +3,82 @@
 #include "color/cmf.hpp"
 #include "color/illuminant.hpp"
 #include "color/rgb.hpp"
+#include "color/transfer_function.hpp"
 
 namespace color {
 
 using Chromaticity = V2f;
 
-namespace OETF {
-COLOR_FN_CONST inline auto linear(RGBf32 c) -> RGBf32 { return c; }
-COLOR_FN_CONST inline auto sRGBf(float f) -> float {
-    if (f <= 0.0031308f) {
-        return 12.92f * f;
-    } else {
-        return (1.0f + 0.055f) * powf(f, 1.0f / 2.4f) - 0.055f;
-    }
-}
+namespace detail {
 
-COLOR_FN_CONST inline auto sRGB(RGBf32 c) -> RGBf32 {
-    return RGBf32(sRGBf(c.r), sRGBf(c.g), sRGBf(c.b));
-}
+/// A row-major 3x3 matrix in double precision, for deriving colour space
+/// matrices at compile time
+struct M33d {
+    double m[3][3];
+};
 
-COLOR_FN_CONST inline auto rec709f(float f) -> float {
-    if (f <= 0.018f) {
-        return f * 4.5f;
-    } else {
-        return 1.099f * powf(f, 0.45f) - 0.099f;
-    }
-}
-COLOR_FN_CONST inline auto rec709(RGBf32 c) -> RGBf32 {
-    return RGBf32(rec709f(c.r), rec709f(c.g), rec709f(c.b));
-}
+/// The inverse of a, which must not be singular
+constexpr auto inverse(const M33d& a) -> M33d {
+    // the transposed cofactors over the determinant
+    const double c00 = a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1];
+    const double c01 = a.m[0][2] * a.m[2][1] - a.m[0][1] * a.m[2][2];
+    const double c02 = a.m[0][1] * a.m[1][2] - a.m[0][2] * a.m[1][1];
+    const double c10 = a.m[1][2] * a.m[2][0] - a.m[1][0] * a.m[2][2];
+    const double c11 = a.m[0][0] * a.m[2][2] - a.m[0][2] * a.m[2][0];
+    const double c12 = a.m[0][2] * a.m[1][0] - a.m[0][0] * a.m[1][2];
+    const double c20 = a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0];
+    const double c21 = a.m[0][1] * a.m[2][0] - a.m[0][0] * a.m[2][1];
+    const double c22 = a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
+    const double d = a.m[0][0] * c00 + a.m[0][1] * c10 + a.m[0][2] * c20;
+    return M33d{{{c00 / d, c01 / d, c02 / d},
+                 {c10 / d, c11 / d, c12 / d},
+                 {c20 / d, c21 / d, c22 / d}}};
 }
 
-namespace EOTF {
-COLOR_FN_CONST inline auto linear(RGBf32 c) -> RGBf32 { return c; }
-COLOR_FN_CONST inline auto sRGBf(float f) -> float {
-    if (f <= 0.040449936f) {
-        return f / 12.92f;
-    } else {
-        return powf((f + 0.055f) / 1.055f, 2.4f);
-    }
-}
-COLOR_FN_CONST inline auto sRGB(RGBf32 c) -> RGBf32 {
-    return RGBf32(sRGBf(c.r), sRGBf(c.g), sRGBf(c.b));
-}
-COLOR_FN_CONST inline auto rec709f(float f) -> float {
-    if (f <= 0.018f * 4.5f) {
-        return f / 4.5f;
-    } else {
-        return powf((f + 0.099f) / 1.099f, 1.0f / 0.45f);
+/**
+ * @brief The XYZ to RGB matrix of the colour space with primaries (xr, yr),
+ * (xg, yg), (xb, yb) and white point (xw, yw)
+ * @details Each row is scaled so that the white point, at a luminance of 1,
+ * maps to RGB 1, 1, 1. Carried out in double precision and constexpr, so
+ * that the built-in spaces' matrices are computed by the compiler.
+ */
+constexpr auto xyz_to_rgb_matrix(double xr, double yr, double xg, double yg,
+                                 double xb, double yb, double xw, double yw)
+    -> M33d {
+    const double zr = 1 - (xr + yr);
+    const double zg = 1 - (xg + yg);
+    const double zb = 1 - (xb + yb);
+    const double zw = 1 - (xw + yw);
+
+    // xyz -> rgb matrix, before scaling to white
+    M33d m{{{(yg * zb) - (yb * zg), (xb * zg) - (xg * zb),
+             (xg * yb) - (xb * yg)},
+            {(yb * zr) - (yr * zb), (xr * zb) - (xb * zr),
+             (xb * yr) - (xr * yb)},
+            {(yr * zg) - (yg * zr), (xg * zr) - (xr * zg),
+             (xr * yg) - (xg * yr)}}};
+
+    // White scaling factors.
+    // Dividing by yw scales the white luminance to unity, as conventional
+    for (int i = 0; i < 3; ++i) {
+        const double w =
+            (m.m[i][0] * xw + m.m[i][1] * yw + m.m[i][2] * zw) / yw;
+        for (int j = 0; j < 3; ++j) {
+            m.m[i][j] /= w;
+        }
     }
+    return m;
 }
-COLOR_FN_CONST inline auto rec709(RGBf32 c) -> RGBf32 {
-    return RGBf32(rec709f(c.r), rec709f(c.g), rec709f(c.b));
-}
+
+/// m rounded to single precision
+inline auto to_m33f(const M33d& m) -> M33f {
+    return M33f(f32(m.m[0][0]), f32(m.m[0][1]), f32(m.m[0][2]),
+                f32(m.m[1][0]), f32(m.m[1][1]), f32(m.m[1][2]),
+                f32(m.m[2][0]), f32(m.m[2][1]), f32(m.m[2][2]));
 }
 
+} // namespace detail
+
 struct ColorSpaceRGB {
     struct Primaries {
         Chromaticity red;
@@ -76,6 +97,7 @@ struct ColorSpaceRGB {
         WhitePoint(Chromaticity xy, Illuminant::ID illuminant)
             : xy(std::move(xy)), illuminant(std::move(illuminant)) {}
 
+        static const WhitePoint D50;
         static const WhitePoint D60;
         static const WhitePoint D65;
     };
@@ -84,7 +106,7 @@ struct ColorSpaceRGB {
     Primaries primaries;
     WhitePoint white_point;
 
-    using TransferFunction = std::function<RGBf32(RGBf32)>;
+    using TransferFunction = color::TransferFunction;
 
     TransferFunction oetf;
     TransferFunction eotf;
@@ -104,60 +126,31 @@ struct ColorSpaceRGB {
         _initialize_matrix();
     }
 
+    /// A space whose matrices have already been derived from its primaries
+    /// and white point, with detail::xyz_to_rgb_matrix()
+    ColorSpaceRGB(std::string name, Primaries primaries, WhitePoint white_point,
+                  const detail::M33d& xyz_to_rgb,
+                  const detail::M33d& rgb_to_xyz, TransferFunction oetf,
+                  TransferFunction eotf,
+                  const CMF& cmf = CMF::CIE_1931_2degree)
+        : name(std::move(name)), primaries(std::move(primaries)),
+          white_point(std::move(white_point)), oetf(std::move(oetf)),
+          eotf(std::move(eotf)), cmf(cmf),
+          m_xyz_to_rgb(detail::to_m33f(xyz_to_rgb)),
+          m_rgb_to_xyz(detail::to_m33f(rgb_to_xyz)) {}
+
     static const ColorSpaceRGB ITUR_BT709;
     static const ColorSpaceRGB ITUR_BT709_linear;
     static const ColorSpaceRGB ITUR_sRGB;
 
 private:
     void _initialize_matrix() {
-        float xr, yr, zr, xg, yg, zg, xb, yb, zb;
-        float xw, yw, zw;
-        float rx, ry, rz, gx, gy, gz, bx, by, bz;
-        float rw, gw, bw;
-
-        xr = primaries.red.x;
-        yr = primaries.red.y;
-        zr = 1 - (xr + yr);
-        xg = primaries.green.x;
-        yg = primaries.green.y;
-        zg = 1 - (xg + yg);
-        xb = primaries.blue.x;
-        yb = primaries.blue.y;
-        zb = 1 - (xb + yb);
-
-        xw = white_point.xy.x;
-        yw = white_point.xy.y;
-        zw = 1 - (xw + yw);
-
-        // xyz -> rgb matrix, before scaling to white
-        rx = (yg * zb) - (yb * zg);
-        ry = (xb * zg) - (xg * zb);
-        rz = (xg * yb) - (xb * yg);
-        gx = (yb * zr) - (yr * zb);
-        gy = (xr * zb) - (xb * zr);
-        gz = (xb * yr) - (xr * yb);
-        bx = (yr * zg) - (yg * zr);
-        by = (xg * zr) - (xr * zg);
-        bz = (xr * yg) - (xg * yr);
-
-        // White scaling factors.
-        // Dividing by yw scales the white luminance to unity, as conventional
-        rw = ((rx * xw) + (ry * yw) + (rz * zw)) / yw;
-        gw = ((gx * xw) + (gy * yw) + (gz * zw)) / yw;
-        bw = ((bx * xw) + (by * yw) + (bz * zw)) / yw;
-
-        // xyz -> rgb matrix, correctly scaled to white
-        m_xyz_to_rgb[0][0] = rx / rw;
-        m_xyz_to_rgb[0][1] = ry / rw;
-        m_xyz_to_rgb[0][2] = rz / rw;
-        m_xyz_to_rgb[1][0] = gx / gw;
-        m_xyz_to_rgb[1][1] = gy / gw;
-        m_xyz_to_rgb[1][2] = gz / gw;
-        m_xyz_to_rgb[2][0] = bx / bw;
-        m_xyz_to_rgb[2][1] = by / bw;
-        m_xyz_to_rgb[2][2] = bz / bw;
-
-        m_rgb_to_xyz = m_xyz_to_rgb.inverse();
+        const detail::M33d m = detail::xyz_to_rgb_matrix(
+            primaries.red.x, primaries.red.y, primaries.green.x,
+            primaries.green.y, primaries.blue.x, primaries.blue.y,
+            white_point.xy.x, white_point.xy.y);
+        m_xyz_to_rgb = detail::to_m33f(m);
+        m_rgb_to_xyz = detail::to_m33f(detail::inverse(m));
     }
 };
 
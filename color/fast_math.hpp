@@ -0,0 +1,163 @@
+#pragma once
+
+#include "color/platform.hpp"
+#include "color/rgbx.hpp"
+#include "color/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace color {
+
+/**
+ * @brief Error tiers for the approximate transfer functions
+ * @details An approximation is within half an LSB of the exact result when
+ * that result is quantized at the given bit depth, i.e. its absolute error
+ * on [0, 1] is below 0.5 / 65535 or 0.5 / 255. Outside [0, 1] the same bound
+ * holds relative to the exact result.
+ */
+enum class Accuracy : int {
+    /// Evaluate with powf
+    Exact = 0,
+    /// Less than half an LSB at 16 bits
+    U16,
+    /// Less than half an LSB at 8 bits
+    U8
+};
+
+namespace fast {
+
+COLOR_FN_CONST inline auto as_int(f32 f) -> i32 {
+    i32 i;
+    memcpy(&i, &f, sizeof(i));
+    return i;
+}
+
+COLOR_FN_CONST inline auto as_float(i32 i) -> f32 {
+    f32 f;
+    memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+/**
+ * @brief log2(x) for positive, normal x
+ * @details x = 2^e * m with m in [sqrt(1/2), sqrt(2)), and log2(m) is the
+ * odd series in t = (m - 1) / (m + 1), |t| < 0.172, truncated after t^7
+ * (U16) or t^3 (U8). Branch-free so loops over it vectorize.
+ */
+template <Accuracy A> COLOR_FN_CONST inline auto log2(f32 x) -> f32 {
+    const i32 bits = as_int(x);
+    // reduce the mantissa to [sqrt(1/2), sqrt(2)) rather than [1, 2) so
+    // that |t| stays small
+    const i32 offset = (bits - 0x3f3504f3) & i32(0xff800000);
+    const f32 e = f32(offset >> 23);
+    const f32 m = as_float(bits - offset);
+    const f32 t = (m - 1.0f) / (m + 1.0f);
+    const f32 t2 = t * t;
+    // 2 / (k ln 2) for k = 1, 3, 5, 7
+    const f32 c1 = 2.885390082f, c3 = 0.961796694f, c5 = 0.577078016f,
+              c7 = 0.412198583f;
+    if (A == Accuracy::U8) {
+        return e + t * (c1 + t2 * c3);
+    }
+    return e + t * (c1 + t2 * (c3 + t2 * (c5 + t2 * c7)));
+}
+
+/**
+ * @brief 2^y, with y clamped to [-126, 127]
+ * @details y = k + f with integer k and f in [-1/2, 1/2]. 2^k is built in
+ * the exponent bits and 2^f from its Taylor series, to degree 5 (U16) or 3
+ * (U8).
+ */
+template <Accuracy A> COLOR_FN_CONST inline auto exp2(f32 y) -> f32 {
+    // written so that NaN clamps too, keeping the integer conversion below
+    // well defined
+    y = y > -126.0f ? y : -126.0f;
+    y = y < 127.0f ? y : 127.0f;
+    // round to nearest by truncating a positive value
+    const i32 k = i32(y + 128.5f) - 128;
+    const f32 f = y - f32(k);
+    // (ln 2)^i / i!
+    const f32 c1 = 0.693147181f, c2 = 0.240226507f, c3 = 0.0555041087f,
+              c4 = 0.00961812911f, c5 = 0.00133335581f;
+    f32 p;
+    if (A == Accuracy::U8) {
+        p = 1.0f + f * (c1 + f * (c2 + f * c3));
+    } else {
+        p = 1.0f + f * (c1 + f * (c2 + f * (c3 + f * (c4 + f * c5))));
+    }
+    return p * as_float((k + 127) << 23);
+}
+
+/// x^p for positive, normal x
+template <Accuracy A> COLOR_FN_CONST inline auto pow(f32 x, f32 p) -> f32 {
+    return fast::exp2<A>(p * fast::log2<A>(x));
+}
+
+/**
+ * @brief f <= t ? s * f : c * (a * f + b)^g + d
+ * @details The shape of the sRGB and Rec.709 curves. a * t + b must be
+ * positive. Infinity and NaN are passed through
+ */
+template <Accuracy A>
+COLOR_FN_CONST inline auto linear_pow(f32 f, f32 t, f32 s, f32 a, f32 b,
+                                      f32 g, f32 c, f32 d) -> f32 {
+    // every branch is evaluated and selected between, as the vector
+    // version below has to
+    f32 p = c * fast::pow<A>(a * f + b, g) + d;
+    return f <= t ? s * f : (f < HUGE_VALF ? p : f);
+}
+
+// The same approximations N lanes at a time, written as the scalar
+// versions are. Plain loops over the scalar versions don't vectorize
+// because the compiler won't if-convert the clamps and selects without
+// -fno-trapping-math
+
+template <Accuracy A, int N>
+COLOR_FN_INLINE auto log2(const f32x<N>& x) -> f32x<N> {
+    const i32x<N> bits = x.bits();
+    const i32x<N> offset = (bits - 0x3f3504f3) & i32(0xff800000);
+    const f32x<N> e = f32x<N>::from_ints(offset >> 23);
+    const f32x<N> m = f32x<N>::from_bits(bits - offset);
+    const f32x<N> t = (m - 1.0f) / (m + 1.0f);
+    const f32x<N> t2 = t * t;
+    const f32 c1 = 2.885390082f, c3 = 0.961796694f, c5 = 0.577078016f,
+              c7 = 0.412198583f;
+    if (A == Accuracy::U8) {
+        return e + t * (c1 + t2 * c3);
+    }
+    return e + t * (c1 + t2 * (c3 + t2 * (c5 + t2 * c7)));
+}
+
+template <Accuracy A, int N>
+COLOR_FN_INLINE auto exp2(const f32x<N>& x) -> f32x<N> {
+    const f32x<N> y = clamp(x, f32x<N>(-126.0f), f32x<N>(127.0f));
+    const auto k = truncate(y + 128.5f) - 128;
+    const f32x<N> f = y - f32x<N>::from_ints(k);
+    const f32 c1 = 0.693147181f, c2 = 0.240226507f, c3 = 0.0555041087f,
+              c4 = 0.00961812911f, c5 = 0.00133335581f;
+    f32x<N> p;
+    if (A == Accuracy::U8) {
+        p = 1.0f + f * (c1 + f * (c2 + f * c3));
+    } else {
+        p = 1.0f + f * (c1 + f * (c2 + f * (c3 + f * (c4 + f * c5))));
+    }
+    return p * f32x<N>::from_bits((k + 127) << 23);
+}
+
+template <Accuracy A, int N>
+COLOR_FN_INLINE auto pow(const f32x<N>& x, f32 p) -> f32x<N> {
+    return fast::exp2<A>(p * fast::log2<A>(x));
+}
+
+template <Accuracy A, int N>
+COLOR_FN_INLINE auto linear_pow(const f32x<N>& f, f32 t, f32 s, f32 a,
+                                f32 b, f32 g, f32 c, f32 d) -> f32x<N> {
+    const f32x<N> p = c * fast::pow<A>(a * f + b, g) + d;
+    return select(f <= t, s * f, select(f < HUGE_VALF, p, f));
+}
+
+} // namespace fast
+
+} // namespace color
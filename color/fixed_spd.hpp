@@ -0,0 +1,159 @@
+#pragma once
+
+#include "color/cmf.hpp"
+#include "color/spectral_power_distribution.hpp"
+
+#include <array>
+
+namespace color {
+
+/**
+ * @brief A spectrum sampled on a grid fixed at compile time
+ * @details Samples are taken every Step nm over [Start, End), matching the
+ * half-open ranges of SPD, so FixedSPD<380, 785, 5> covers 380-780nm at 5nm.
+ * Storage is a std::array and all loops have a constant trip count, so
+ * reductions such as spd_to_xyz can be fully unrolled and vectorized.
+ */
+template <int Start, int End, int Step> class FixedSPD {
+    static_assert(Step > 0, "step must be positive");
+    static_assert(End > Start + Step, "end of range is less than step");
+    static_assert((End - Start) % Step == 0,
+                  "range must be a whole number of steps");
+
+public:
+    static constexpr size_t N = size_t((End - Start) / Step);
+
+    explicit FixedSPD(float v = 0.0f) { _values.fill(v); }
+
+    explicit FixedSPD(const std::array<float, N>& values) : _values(values) {}
+
+    /// Resample spd onto this grid
+    explicit FixedSPD(const SPD& spd,
+                      Extrapolation extrapolation = Extrapolation::Clamp) {
+        resample(spd.grid(), spd.data(), grid(), _values.data(),
+                 extrapolation);
+    }
+
+    static constexpr size_t num_samples() { return N; }
+    static constexpr float start() { return float(Start); }
+    static constexpr float end() { return float(End); }
+    static constexpr float step() { return float(Step); }
+
+    /// Wavelength of the i-th sample
+    static constexpr float wavelength(size_t i) {
+        return float(Start + int(i) * Step);
+    }
+
+    static WavelengthGrid grid() { return WavelengthGrid(start(), step(), N); }
+
+    /// Convert to a heap-backed SPD with the same sampling
+    auto to_spd() const -> SPD {
+        return SPD(start(), end(), step(),
+                   std::vector<float>(_values.begin(), _values.end()));
+    }
+
+    float operator[](size_t i) const { return _values[i]; }
+    float& operator[](size_t i) { return _values[i]; }
+
+    const float* data() const { return _values.data(); }
+    float* data() { return _values.data(); }
+
+    FixedSPD& operator+=(const FixedSPD& o) {
+        for (size_t i = 0; i < N; ++i) {
+            _values[i] += o._values[i];
+        }
+        return *this;
+    }
+
+    FixedSPD& operator-=(const FixedSPD& o) {
+        for (size_t i = 0; i < N; ++i) {
+            _values[i] -= o._values[i];
+        }
+        return *this;
+    }
+
+    FixedSPD& operator*=(const FixedSPD& o) {
+        for (size_t i = 0; i < N; ++i) {
+            _values[i] *= o._values[i];
+        }
+        return *this;
+    }
+
+    FixedSPD& operator*=(float f) {
+        for (size_t i = 0; i < N; ++i) {
+            _values[i] *= f;
+        }
+        return *this;
+    }
+
+    FixedSPD operator+(const FixedSPD& o) const { return FixedSPD(*this) += o; }
+    FixedSPD operator-(const FixedSPD& o) const { return FixedSPD(*this) -= o; }
+    FixedSPD operator*(const FixedSPD& o) const { return FixedSPD(*this) *= o; }
+    FixedSPD operator*(float f) const { return FixedSPD(*this) *= f; }
+
+private:
+    std::array<float, N> _values;
+};
+
+template <int Start, int End, int Step>
+constexpr size_t FixedSPD<Start, End, Step>::N;
+
+/**
+ * @brief Sum over all wavelengths of a[i] * b[i]
+ * @details Products are summed in eight lanes, which are then added in lane
+ * order, as Kernels::respond does. That leaves the compiler free to
+ * vectorize the loop without -ffast-math, and gives the same sum as the
+ * run-time grid path
+ */
+template <int Start, int End, int Step>
+inline auto dot(const FixedSPD<Start, End, Step>& a,
+                const FixedSPD<Start, End, Step>& b) -> float {
+    constexpr size_t N = FixedSPD<Start, End, Step>::N;
+    float lanes[8] = {};
+    size_t i = 0;
+    for (; i + 8 <= N; i += 8) {
+        for (size_t l = 0; l < 8; ++l) {
+            lanes[l] += a[i + l] * b[i + l];
+        }
+    }
+    for (size_t l = 0; i + l < N; ++l) {
+        lanes[l] += a[i + l] * b[i + l];
+    }
+
+    float sum = 0.0f;
+    for (size_t l = 0; l < 8; ++l) {
+        sum += lanes[l];
+    }
+    return sum;
+}
+
+/// Colour matching functions resampled onto a fixed grid
+template <int Start, int End, int Step> struct FixedCMF {
+    using Spectrum = FixedSPD<Start, End, Step>;
+
+    explicit FixedCMF(const CMF& cmf)
+        : x_bar(cmf.x_bar, Extrapolation::Zero),
+          y_bar(cmf.y_bar, Extrapolation::Zero),
+          z_bar(cmf.z_bar, Extrapolation::Zero) {}
+
+    Spectrum x_bar;
+    Spectrum y_bar;
+    Spectrum z_bar;
+};
+
+template <int Start, int End, int Step>
+inline auto spd_to_xyz(const FixedSPD<Start, End, Step>& spd,
+                       const FixedCMF<Start, End, Step>& cmf,
+                       const FixedSPD<Start, End, Step>& illuminant) -> XYZ {
+    auto Me = spd * illuminant;
+    XYZ xyz(dot(Me, cmf.x_bar), dot(Me, cmf.y_bar), dot(Me, cmf.z_bar));
+    return xyz / dot(cmf.y_bar, illuminant);
+}
+
+template <int Start, int End, int Step>
+inline auto spd_to_xyz(const FixedSPD<Start, End, Step>& spd,
+                       const FixedCMF<Start, End, Step>& cmf) -> XYZ {
+    return XYZ(dot(spd, cmf.x_bar), dot(spd, cmf.y_bar), dot(spd, cmf.z_bar));
+}
+
+} // namespace color
@@ -1,36 +1,157 @@
 #include "color/illuminant.hpp"
-
+#include "color/registry.hpp"
 
 namespace color {
 
-const SPD Illuminant::D65(
-    {300, 305, 310, 315, 320, 325, 330, 335, 340, 345, 350, 355, 360, 365,
-     370, 375, 380, 385, 390, 395, 400, 405, 410, 415, 420, 425, 430, 435,
-     440, 445, 450, 455, 460, 465, 470, 475, 480, 485, 490, 495, 500, 505,
-     510, 515, 520, 525, 530, 535, 540, 545, 550, 555, 560, 565, 570, 575,
-     580, 585, 590, 595, 600, 605, 610, 615, 620, 625, 630, 635, 640, 645,
-     650, 655, 660, 665, 670, 675, 680, 685, 690, 695, 700, 705, 710, 715,
-     720, 725, 730, 735, 740, 745, 750, 755, 760, 765, 770, 775, 780},
-    {0.034100,   1.664300,   3.294500,   11.765200,  20.236000,  28.644700,
-     37.053500,  38.501100,  39.948800,  42.430200,  44.911700,  45.775000,
-     46.638300,  49.363700,  52.089100,  51.032300,  49.975500,  52.311800,
-     54.648200,  68.701500,  82.754900,  87.120400,  91.486000,  92.458900,
-     93.431800,  90.057000,  86.682300,  95.773600,  104.865000, 110.936000,
-     117.008000, 117.410000, 117.812000, 116.336000, 114.861000, 115.392000,
-     115.923000, 112.367000, 108.811000, 109.082000, 109.354000, 108.578000,
-     107.802000, 106.296000, 104.790000, 106.239000, 107.689000, 106.047000,
-     104.405000, 104.225000, 104.046000, 102.023000, 100.000000, 98.167100,
-     96.334200,  96.061100,  95.788000,  92.236800,  88.685600,  89.345900,
-     90.006200,  89.802600,  89.599100,  88.648900,  87.698700,  85.493600,
-     83.288600,  83.493900,  83.699200,  81.863000,  80.026800,  80.120700,
-     80.214600,  81.246200,  82.277800,  80.281000,  78.284200,  74.002700,
-     69.721300,  70.665200,  71.609100,  72.979000,  74.349000,  67.976500,
-     61.604000,  65.744800,  69.885600,  72.486300,  75.087000,  69.339800,
-     63.592700,  55.005400,  46.418200,  56.611800,  66.805400,  65.094100,
-     63.382800});
-
-const std::unordered_map<int, const SPD&> Illuminant::map{
-    {int(Illuminant::ID::D65), Illuminant::D65}
+namespace {
+// tabulated at 5nm, in read-only data referenced by the SPD below
+constexpr float k_d65[] = {
+    0.034100, 1.664300, 3.294500, 11.765200, 20.236000, 28.644700, 37.053500,
+    38.501100, 39.948800, 42.430200, 44.911700, 45.775000, 46.638300,
+    49.363700, 52.089100, 51.032300, 49.975500, 52.311800, 54.648200,
+    68.701500, 82.754900, 87.120400, 91.486000, 92.458900, 93.431800,
+    90.057000, 86.682300, 95.773600, 104.865000, 110.936000, 117.008000,
+    117.410000, 117.812000, 116.336000, 114.861000, 115.392000, 115.923000,
+    112.367000, 108.811000, 109.082000, 109.354000, 108.578000, 107.802000,
+    106.296000, 104.790000, 106.239000, 107.689000, 106.047000, 104.405000,
+    104.225000, 104.046000, 102.023000, 100.000000, 98.167100, 96.334200,
+    96.061100, 95.788000, 92.236800, 88.685600, 89.345900, 90.006200,
+    89.802600, 89.599100, 88.648900, 87.698700, 85.493600, 83.288600,
+    83.493900, 83.699200, 81.863000, 80.026800, 80.120700, 80.214600,
+    81.246200, 82.277800, 80.281000, 78.284200, 74.002700, 69.721300,
+    70.665200, 71.609100, 72.979000, 74.349000, 67.976500, 61.604000,
+    65.744800, 69.885600, 72.486300, 75.087000, 69.339800, 63.592700,
+    55.005400, 46.418200, 56.611800, 66.805400, 65.094100, 63.382800};
+
+// CIE daylight basis functions S0, S1 and S2, tabulated at 10nm from 300nm
+// (CIE 15:2004 table T.2)
+constexpr size_t k_daylight_samples = 54;
+constexpr double k_s0[k_daylight_samples] = {
+    0.04, 6.0, 29.6, 55.3, 57.3, 61.8, 61.5, 68.8, 63.4, 65.8, 94.8, 104.8,
+    105.9, 96.8, 113.9, 125.6, 125.5, 121.3, 121.3, 113.5, 113.1, 110.8, 106.5,
+    108.8, 105.3, 104.4, 100.0, 96.0, 95.1, 89.1, 90.5, 90.3, 88.4, 84.0, 85.1,
+    81.9, 82.6, 84.9, 81.3, 71.9, 74.3, 76.4, 63.3, 71.7, 77.0, 65.2, 47.7,
+    68.6, 65.0, 66.0, 61.0, 53.3, 58.9, 61.9};
+
+constexpr double k_s1[k_daylight_samples] = {
+    0.02, 4.5, 22.4, 42.0, 40.6, 41.6, 38.0, 42.4, 38.5, 35.0, 43.4, 46.3, 43.9,
+    37.1, 36.7, 35.9, 32.6, 27.9, 24.3, 20.1, 16.2, 13.2, 8.6, 6.1, 4.2, 1.9,
+    0.0, -1.6, -3.5, -3.5, -5.8, -7.2, -8.6, -9.5, -10.9, -10.7, -12.0, -14.0,
+    -13.6, -12.0, -13.3, -12.9, -10.6, -11.6, -12.2, -10.2, -7.8, -11.2, -10.4,
+    -10.6, -9.7, -8.3, -9.3, -9.8};
+
+constexpr double k_s2[k_daylight_samples] = {
+    0.0, 2.0, 4.0, 8.5, 7.8, 6.7, 5.3, 6.1, 3.0, 1.2, -1.1, -0.5, -0.7, -1.2,
+    -2.6, -2.9, -2.8, -2.6, -2.6, -1.8, -1.5, -1.3, -1.2, -1.0, -0.5, -0.3, 0.0,
+    0.2, 0.5, 2.1, 3.2, 4.1, 4.7, 5.1, 6.7, 7.3, 8.6, 9.8, 10.2, 8.3, 9.6, 8.5,
+    7.0, 7.6, 8.0, 6.7, 5.2, 7.4, 6.8, 7.0, 6.4, 5.5, 6.1, 6.5};
+
+struct Tabulated {
+    float values[k_daylight_samples];
 };
 
+// nearest integer to x, for rounding at compile time
+constexpr auto round_to_int(double x) -> double {
+    return double((long long)(x < 0.0 ? x - 0.5 : x + 0.5));
+}
+
+// CIE daylight at nominal correlated colour temperature cct, which is
+// corrected for the revised value of c2 as the D series are
+constexpr auto daylight(double cct) -> Tabulated {
+    const double t = cct * 1.4388 / 1.438;
+    const double x =
+        t <= 7000.0 ? -4.6070e9 / (t * t * t) + 2.9678e6 / (t * t) +
+                          0.09911e3 / t + 0.244063
+                    : -2.0064e9 / (t * t * t) + 1.9018e6 / (t * t) +
+                          0.24748e3 / t + 0.237040;
+    const double y = -3.0 * x * x + 2.870 * x - 0.275;
+    const double m = 0.0241 + 0.2562 * x - 0.7341 * y;
+    // M1 and M2 are rounded to 3 decimals, as they were for the published
+    // tables
+    const double m1 =
+        round_to_int((-1.3515 - 1.7703 * x + 5.9114 * y) / m * 1000.0) /
+        1000.0;
+    const double m2 =
+        round_to_int((0.0300 - 31.4424 * x + 30.0717 * y) / m * 1000.0) /
+        1000.0;
+
+    Tabulated d{};
+    for (size_t i = 0; i < k_daylight_samples; ++i) {
+        d.values[i] = float(k_s0[i] + m1 * k_s1[i] + m2 * k_s2[i]);
+    }
+    return d;
+}
+
+constexpr auto equal_energy() -> Tabulated {
+    Tabulated e{};
+    for (size_t i = 0; i < k_daylight_samples; ++i) {
+        e.values[i] = 100.0f;
+    }
+    return e;
+}
+
+constexpr Tabulated k_d50 = daylight(5000.0);
+constexpr Tabulated k_d55 = daylight(5500.0);
+constexpr Tabulated k_d60 = daylight(6000.0);
+constexpr Tabulated k_e = equal_energy();
+
+const char* const k_names[Illuminant::num_builtin] = {"D50", "D55", "D60",
+                                                      "D65", "E",   "P3"};
+
+auto registry() -> detail::Registry<SPD>& {
+    static detail::Registry<SPD> r;
+    return r;
 }
+} // namespace
+
+const SPD Illuminant::D65(detail::static_samples, k_d65, 300.0f, 5.0f);
+
+const SPD Illuminant::D50(detail::static_samples, k_d50.values, 300.0f, 10.0f);
+const SPD Illuminant::D55(detail::static_samples, k_d55.values, 300.0f, 10.0f);
+const SPD Illuminant::D60(detail::static_samples, k_d60.values, 300.0f, 10.0f);
+const SPD Illuminant::E(detail::static_samples, k_e.values, 300.0f, 10.0f);
+
+constexpr int Illuminant::num_builtin;
+
+namespace detail {
+auto added_illuminant(Illuminant::ID id) -> const SPD& {
+    if (int(id) < Illuminant::num_builtin) {
+        throw std::out_of_range(
+            fmt::format("no spectrum for illuminant id {}", int(id)));
+    }
+    return registry().at(size_t(id) - Illuminant::num_builtin).value;
+}
+} // namespace detail
+
+auto Illuminant::name(ID id) -> const char* {
+    if (unsigned(id) < unsigned(num_builtin)) {
+        return k_names[int(id)];
+    }
+    if (int(id) < 0) {
+        throw std::out_of_range(
+            fmt::format("unknown illuminant id {}", int(id)));
+    }
+    return registry().at(size_t(id) - num_builtin).name.c_str();
+}
+
+auto Illuminant::add(std::string name, SPD spd) -> ID {
+    const size_t i = registry().add(std::move(name), std::move(spd));
+    return ID(num_builtin + int(i));
+}
+
+auto Illuminant::find(const std::string& name, ID& id) -> bool {
+    for (int i = 0; i < num_builtin; ++i) {
+        if (name == k_names[i]) {
+            id = ID(i);
+            return true;
+        }
+    }
+    size_t i;
+    if (!registry().find(name, i)) {
+        return false;
+    }
+    id = ID(num_builtin + int(i));
+    return true;
+}
+
+} // namespace color
@@ -2,20 +2,70 @@
 
 #include "color/spectral_power_distribution.hpp"
 
-#include <unordered_map>
+#include <stdexcept>
+#include <string>
 
 namespace color {
 
 struct Illuminant {
     enum class ID : int { D50, D55, D60, D65, E, P3 };
 
+    /// Number of built-in illuminants. IDs from here on are of spectra added
+    /// by add()
+    static constexpr int num_builtin = 6;
+
+    /// CIE D65, tabulated at 5nm
     static const SPD D65;
+    /// CIE daylight at 5000K, 5500K and 6000K (nominal), derived from the
+    /// daylight basis functions at 10nm
+    static const SPD D50;
+    static const SPD D55;
+    static const SPD D60;
+    /// Equal energy
+    static const SPD E;
+
+    /**
+     * @brief The spectrum of id. A constant expression for the built-in
+     * illuminants
+     * @details Throws std::out_of_range if there is no illuminant with id.
+     * P3's white point is defined only by its chromaticity, so getting its
+     * spectrum throws too
+     */
+    static constexpr auto get(ID id) -> const SPD&;
+
+    /// Name of the illuminant with id: the enumerator's for the built-in
+    /// illuminants. Throws std::out_of_range if there is no illuminant with
+    /// id
+    static auto name(ID id) -> const char*;
 
-    static const std::unordered_map<int, const SPD&> map;
+    /**
+     * @brief Add a copy of spd under name, returning its ID
+     * @details Spectra are never removed, so references to them stay valid.
+     * Safe to call while other threads are getting illuminants
+     */
+    static auto add(std::string name, SPD spd) -> ID;
 
-    static auto get(ID id) -> const SPD& {
-        return map.at(int(id));
-    }
+    /// Set id to that of the illuminant called name, returning false if
+    /// there is none
+    static auto find(const std::string& name, ID& id) -> bool;
 };
 
+namespace detail {
+// indexed by ID
+constexpr const SPD* k_illuminants[Illuminant::num_builtin] = {
+    &Illuminant::D50, &Illuminant::D55, &Illuminant::D60,
+    &Illuminant::D65, &Illuminant::E,   nullptr};
+
+/// The spectrum added as id, throwing std::out_of_range if there is none
+auto added_illuminant(Illuminant::ID id) -> const SPD&;
+} // namespace detail
+
+constexpr auto Illuminant::get(ID id) -> const SPD& {
+    // P3's null entry falls through to added_illuminant, which throws
+    return unsigned(id) < unsigned(num_builtin) &&
+                   detail::k_illuminants[int(id)]
+               ? *detail::k_illuminants[int(id)]
+               : detail::added_illuminant(id);
 }
+
+} // namespace color
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "color/assert.hpp"
+#include "color/types.hpp"
+
+#include <cstddef>
+
+namespace color {
+
+/**
+ * @brief Non-owning view of the three colour channels of an image
+ * @details Channel c of pixel (x, y) is at
+ * channel[c] + y * row_stride + x * pixel_stride, with strides counted in
+ * elements of T. This covers interleaved RGB (pixel_stride 3), RGBA or
+ * wider pixels whose extra channels are left untouched, planar images
+ * (three channel pointers with pixel_stride 1) and arbitrarily strided
+ * layouts. Use ImageView<const T> for read-only images.
+ */
+template <typename T> struct ImageView {
+    T* channel[3];
+    size_t width;
+    size_t height;
+    ptrdiff_t pixel_stride;
+    ptrdiff_t row_stride;
+
+    ImageView(T* r, T* g, T* b, size_t width, size_t height,
+              ptrdiff_t pixel_stride, ptrdiff_t row_stride)
+        : channel{r, g, b}, width(width), height(height),
+          pixel_stride(pixel_stride), row_stride(row_stride) {}
+
+    /// A read-only view of a writable image
+    template <typename U>
+    ImageView(const ImageView<U>& o)
+        : channel{o.channel[0], o.channel[1], o.channel[2]}, width(o.width),
+          height(o.height), pixel_stride(o.pixel_stride),
+          row_stride(o.row_stride) {}
+
+    /**
+     * @brief Pixels of num_channels elements, the first three being RGB
+     * @details row_stride defaults to tightly packed rows
+     */
+    static auto interleaved(T* data, size_t width, size_t height,
+                            int num_channels = 3, ptrdiff_t row_stride = 0)
+        -> ImageView {
+        color_assert(num_channels >= 3, "need at least 3 channels, got {}",
+                     num_channels);
+        if (row_stride == 0) {
+            row_stride = ptrdiff_t(width) * num_channels;
+        }
+        return ImageView(data, data + 1, data + 2, width, height,
+                         num_channels, row_stride);
+    }
+
+    /// One plane per channel. row_stride defaults to width
+    static auto planar(T* r, T* g, T* b, size_t width, size_t height,
+                       ptrdiff_t row_stride = 0) -> ImageView {
+        if (row_stride == 0) {
+            row_stride = ptrdiff_t(width);
+        }
+        return ImageView(r, g, b, width, height, 1, row_stride);
+    }
+
+    size_t num_pixels() const { return width * height; }
+
+    /// Channel c of pixel (x, y)
+    T* at(int c, size_t x, size_t y) const {
+        return channel[c] + ptrdiff_t(y) * row_stride +
+               ptrdiff_t(x) * pixel_stride;
+    }
+};
+
+} // namespace color
@@ -0,0 +1,72 @@
+#include "color/image_conversion.hpp"
+#include "color/parallel.hpp"
+#include "color/tile.hpp"
+
+#include <algorithm>
+
+namespace color {
+
+namespace {
+template <typename S, typename D>
+void convert(const ImageView<const S>& src, const ImageView<D>& dst,
+             const M33f* m, const TransferFunction* decode,
+             const TransferFunction* encode) {
+    color_assert(src.width == dst.width && src.height == dst.height,
+                 "source ({}x{}) and destination ({}x{}) sizes differ",
+                 src.width, src.height, dst.width, dst.height);
+
+    // 8 and 16-bit sources are decoded as they are loaded, by table lookup
+    const f32* table =
+        decode ? detail::transfer_table(*decode, src.channel[0]) : nullptr;
+    if (table) {
+        decode = nullptr;
+    }
+
+    const size_t grain = detail::row_grain(src.width);
+    parallel_for(src.height, grain, [&](size_t y0, size_t y1) {
+        detail::Tile tile;
+        for (size_t y = y0; y < y1; ++y) {
+            for (size_t x = 0; x < src.width; x += detail::k_tile) {
+                size_t n = std::min(detail::k_tile, src.width - x);
+                if (table) {
+                    detail::load(src, x, y, n, table, tile);
+                } else {
+                    detail::load(src, x, y, n, tile);
+                }
+                if (decode) {
+                    detail::apply_transfer(*decode, tile, n);
+                }
+                if (m) {
+                    detail::transform(*m, tile, n);
+                }
+                if (encode) {
+                    detail::apply_transfer(*encode, tile, n);
+                }
+                detail::store(tile, n, dst, x, y);
+            }
+        }
+    });
+}
+
+} // namespace
+
+namespace detail {
+template <typename S, typename D>
+void convert_image(const ImageView<const S>& src, const ImageView<D>& dst,
+                   const M33f* m, const TransferFunction* decode,
+                   const TransferFunction* encode) {
+    convert(src, dst, m, decode, encode);
+}
+
+#define COLOR_CONVERT_IMAGE(S, D)                                              \
+    template void convert_image(const ImageView<const S>&,                     \
+                                const ImageView<D>&, const M33f*,              \
+                                const TransferFunction*,                       \
+                                const TransferFunction*);
+
+COLOR_IMAGE_CHANNEL_PAIRS(COLOR_CONVERT_IMAGE)
+
+#undef COLOR_CONVERT_IMAGE
+} // namespace detail
+
+} // namespace color
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "color/color_space_conversion.hpp"
+#include "color/color_space_rgb.hpp"
+#include "color/image.hpp"
+
+#include <type_traits>
+
+namespace color {
+
+namespace detail {
+/// Decode src if decode is non-null, multiply by m if non-null, then encode
+/// if encode is non-null, writing to dst. Instantiated for f32, f16, u16 and
+/// u8 channels
+template <typename S, typename D>
+void convert_image(const ImageView<const S>& src, const ImageView<D>& dst,
+                   const M33f* m, const TransferFunction* decode,
+                   const TransferFunction* encode);
+
+template <typename T>
+using ConstImageView = ImageView<const typename std::remove_const<T>::type>;
+
+inline auto non_linear(const TransferFunction& tf) -> const TransferFunction* {
+    return tf.is_linear() ? nullptr : &tf;
+}
+} // namespace detail
+
+/**
+ * @brief Convert a whole image from XYZ to RGB in cs
+ * @details src and dst must have the same dimensions and may be the same
+ * image. Supported channel types are f32, f16, u16 and u8. Integer code
+ * values are read as v / max and written rounded and clamped, see
+ * quantize(). Transfer functions on f16, u16 and u8 sources are decoded by
+ * table lookup as they are loaded. Rows are converted in parallel, see
+ * set_num_threads()
+ */
+template <typename S, typename D>
+void xyz_to_rgb(const ImageView<S>& src, const ImageView<D>& dst,
+                const ColorSpaceRGB& cs, bool ignore_transfer = false) {
+    detail::convert_image(detail::ConstImageView<S>(src), dst,
+                          &cs.m_xyz_to_rgb, nullptr,
+                          ignore_transfer ? nullptr
+                                          : detail::non_linear(cs.oetf));
+}
+
+/**
+ * @brief Convert a whole image from XYZ relative to src_white to RGB in cs
+ * @details The adaptation to cs's white point is folded into the matrix, so
+ * costs nothing per pixel. See xyz_to_rgb()
+ */
+template <typename S, typename D>
+void xyz_to_rgb(const ImageView<S>& src, const ImageView<D>& dst,
+                const ColorSpaceRGB& cs, V2f src_white,
+                ChromaticAdaptation method, bool ignore_transfer = false) {
+    const M33f m = xyz_to_rgb_matrix(cs, src_white, method);
+    detail::convert_image(detail::ConstImageView<S>(src), dst, &m, nullptr,
+                          ignore_transfer ? nullptr
+                                          : detail::non_linear(cs.oetf));
+}
+
+/// Convert a whole image from RGB in cs to XYZ. See xyz_to_rgb()
+template <typename S, typename D>
+void rgb_to_xyz(const ImageView<S>& src, const ImageView<D>& dst,
+                const ColorSpaceRGB& cs, bool ignore_transfer = false) {
+    detail::convert_image(detail::ConstImageView<S>(src), dst,
+                          &cs.m_rgb_to_xyz,
+                          ignore_transfer ? nullptr
+                                          : detail::non_linear(cs.eotf),
+                          nullptr);
+}
+
+/**
+ * @brief Convert a whole image from one RGB color space to another
+ * @details Uses the fused matrix and skips the transfer functions where
+ * conversion allows it. See xyz_to_rgb()
+ */
+template <typename S, typename D>
+void rgb_to_rgb(const ImageView<S>& src, const ImageView<D>& dst,
+                const ColorSpaceConversion& conversion) {
+    detail::convert_image(
+        detail::ConstImageView<S>(src), dst,
+        conversion.is_matrix_identity() ? nullptr : &conversion.matrix(),
+        detail::non_linear(conversion.decode()),
+        detail::non_linear(conversion.encode()));
+}
+
+template <typename S, typename D>
+void rgb_to_rgb(const ImageView<S>& src, const ImageView<D>& dst,
+                const ColorSpaceRGB& cs_src, const ColorSpaceRGB& cs_dst,
+                ChromaticAdaptation method = ChromaticAdaptation::None) {
+    rgb_to_rgb(src, dst, *ColorSpaceConversion::get(cs_src, cs_dst, method));
+}
+
+} // namespace color
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "color/transfer_function.hpp"
+#include "color/types.hpp"
+
+#include <cstddef>
+
+namespace color {
+namespace detail {
+
+/// Spectra integrated together by Kernels::respond_block
+constexpr size_t k_respond_block = 4;
+
+/**
+ * @brief The batch kernels built for one instruction set
+ * @details Each is compiled once per level in color/simd.hpp and reached
+ * through kernels(). All levels give bit-identical results: the kernels
+ * are lane-wise, sums are always accumulated in eight lanes whatever the
+ * register width and no level contracts multiplies and adds into FMAs.
+ * Matrices are 3x3 row-major.
+ */
+struct Kernels {
+    /// The sRGB or Rec.709 curve approximated to accuracy on n values
+    void (*transfer)(TransferFunction::Curve curve, Accuracy accuracy,
+                     f32* v, size_t n);
+    /// See quantize()
+    void (*quantize_u8)(const f32* src, u8* dst, size_t n, const f32* dither);
+    void (*quantize_u16)(const f32* src, u16* dst, size_t n,
+                         const f32* dither);
+    /// m applied to n colours held as three planes
+    void (*transform_planar)(const f32* m, f32* r, f32* g, f32* b, size_t n);
+    /// m applied to n interleaved colours
+    void (*transform)(const f32* m, RGBf32* c, size_t n);
+    /// Clamp n values to [lo, hi]
+    void (*clamp)(f32 lo, f32 hi, f32* v, size_t n);
+    /// The dot product of n values with each of three rows, stride apart,
+    /// zero padded to a multiple of eight, into out[0..2]
+    void (*respond)(const f32* rows, size_t stride, const f32* values,
+                    size_t n, f32* out);
+    /// respond() for k_respond_block spectra at once, into out[0..3 *
+    /// k_respond_block)
+    void (*respond_block)(const f32* rows, size_t stride,
+                          const f32* const* values, size_t n, f32* out);
+};
+
+/// The kernels for the current simd_level()
+auto kernels() -> const Kernels&;
+
+/// The kernels built for each level. Only those the library was built with
+/// are defined
+auto kernels_sse2() -> const Kernels&;
+auto kernels_avx2() -> const Kernels&;
+auto kernels_avx512() -> const Kernels&;
+
+} // namespace detail
+} // namespace color
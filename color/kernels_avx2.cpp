@@ -0,0 +1,12 @@
+// The batch kernels built for -mavx2, see CMakeLists.txt
+#include "color/kernels_impl.hpp"
+
+#if !defined(__AVX2__)
+#error "kernels_avx2.cpp must be built with -mavx2"
+#endif
+
+namespace color {
+namespace detail {
+auto kernels_avx2() -> const Kernels& { return k_kernels; }
+} // namespace detail
+} // namespace color
@@ -0,0 +1,12 @@
+// The batch kernels built for -mavx512f, see CMakeLists.txt
+#include "color/kernels_impl.hpp"
+
+#if !defined(__AVX512F__)
+#error "kernels_avx512.cpp must be built with -mavx512f"
+#endif
+
+namespace color {
+namespace detail {
+auto kernels_avx512() -> const Kernels& { return k_kernels; }
+} // namespace detail
+} // namespace color
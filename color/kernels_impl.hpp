@@ -0,0 +1,234 @@
+#pragma once
+
+/*
+ * The definitions of the batch kernels, included once by each of
+ * kernels_sse2.cpp, kernels_avx2.cpp and kernels_avx512.cpp, which are
+ * built with different instruction sets. Everything here is local to the
+ * including file, and must only call inline functions from color/rgbx.hpp
+ * and color/fast_math.hpp, which are namespaced by instruction set: an
+ * out-of-line copy of any other inline function built with AVX-512 could
+ * be the one the linker keeps for the whole library.
+ */
+
+#include "color/fast_math.hpp"
+#include "color/kernels.hpp"
+#include "color/rgbx.hpp"
+#include "color/transfer_function.hpp"
+
+#include <limits>
+
+namespace color {
+namespace detail {
+namespace {
+
+// two registers per value, to hide some latency
+constexpr int k_width = 2 * k_native_lanes;
+using Lanes = f32x<k_width>;
+using Colours = RGBx<k_width>;
+
+// v[i] = fn(v[i]), the last few zero padded
+template <typename F> COLOR_FN_INLINE void each(f32* v, size_t n, F fn) {
+    size_t i = 0;
+    for (; i + k_width <= n; i += k_width) {
+        fn(Lanes::load(v + i)).store(v + i);
+    }
+    if (i < n) {
+        fn(Lanes::load(v + i, n - i)).store(v + i, n - i);
+    }
+}
+
+template <Accuracy A>
+void transfer_approx(TransferFunction::Curve curve, f32* v, size_t n) {
+    using Curve = TransferFunction::Curve;
+    switch (curve) {
+    case Curve::sRGB_OETF:
+        return each(v, n, [](const Lanes& f) {
+            return OETF::sRGBf_approx<A>(f);
+        });
+    case Curve::sRGB_EOTF:
+        return each(v, n, [](const Lanes& f) {
+            return EOTF::sRGBf_approx<A>(f);
+        });
+    case Curve::Rec709_OETF:
+        return each(v, n, [](const Lanes& f) {
+            return OETF::rec709f_approx<A>(f);
+        });
+    case Curve::Rec709_EOTF:
+        return each(v, n, [](const Lanes& f) {
+            return EOTF::rec709f_approx<A>(f);
+        });
+    default:
+        return;
+    }
+}
+
+void transfer(TransferFunction::Curve curve, Accuracy accuracy, f32* v,
+              size_t n) {
+    if (accuracy == Accuracy::U8) {
+        transfer_approx<Accuracy::U8>(curve, v, n);
+    } else {
+        transfer_approx<Accuracy::U16>(curve, v, n);
+    }
+}
+
+// Lanes quantized at a time: 16 8-bit results fill a 128-bit register
+using Codes = f32x<k_width < 16 ? 16 : k_width>;
+
+// roundf(clamp(v, 0, 1) * scale + d) as integers, with d from dither if
+// Dithered. Written so that NaN becomes 0
+template <bool Dithered>
+COLOR_FN_INLINE auto codes(Codes v, f32 scale, const Codes& d)
+    -> i32x<Codes::size> {
+    v = clamp(v, Codes(0.0f), Codes(1.0f)) * scale;
+    if (Dithered) {
+        // d is in (-0.5, 0.5) so the result stays in range
+        v += d;
+    }
+    // truncate, then round up where the fraction is at least a half. This
+    // is roundf exactly, where adding a half before truncating is not.
+    // Values dithered below zero truncate to 0 with a negative fraction
+    auto k = truncate(v);
+    // the comparison is -1 in lanes that round up
+    k -= v - Codes::from_ints(k) >= 0.5f;
+    return k;
+}
+
+// the undithered kernels skip loading offsets altogether
+template <typename T, bool Dithered>
+void quantize_range(const f32* src, T* dst, size_t n, const f32* dither) {
+    const f32 scale = f32(std::numeric_limits<T>::max());
+    const Codes zero(0.0f);
+    size_t i = 0;
+    for (; i + Codes::size <= n; i += Codes::size) {
+        const Codes d = Dithered ? Codes::load(dither + i) : zero;
+        store_as(codes<Dithered>(Codes::load(src + i), scale, d), dst + i);
+    }
+    if (i < n) {
+        const size_t rest = n - i;
+        const Codes d = Dithered ? Codes::load(dither + i, rest) : zero;
+        T last[Codes::size];
+        store_as(codes<Dithered>(Codes::load(src + i, rest), scale, d),
+                 last);
+        for (size_t j = 0; j < rest; ++j) {
+            dst[i + j] = last[j];
+        }
+    }
+}
+
+template <typename T>
+void quantize_codes(const f32* src, T* dst, size_t n, const f32* dither) {
+    if (dither) {
+        quantize_range<T, true>(src, dst, n, dither);
+    } else {
+        quantize_range<T, false>(src, dst, n, nullptr);
+    }
+}
+
+COLOR_FN_INLINE auto transform_colours(const f32* m, const Colours& c)
+    -> Colours {
+    return Colours(m[0] * c.r + m[1] * c.g + m[2] * c.b,
+                   m[3] * c.r + m[4] * c.g + m[5] * c.b,
+                   m[6] * c.r + m[7] * c.g + m[8] * c.b);
+}
+
+void transform_planar(const f32* m, f32* r, f32* g, f32* b, size_t n) {
+    size_t i = 0;
+    for (; i + k_width <= n; i += k_width) {
+        transform_colours(m, Colours::load(r + i, g + i, b + i))
+            .store(r + i, g + i, b + i);
+    }
+    if (i < n) {
+        const size_t rest = n - i;
+        const Colours c(Lanes::load(r + i, rest), Lanes::load(g + i, rest),
+                        Lanes::load(b + i, rest));
+        const Colours t = transform_colours(m, c);
+        t.r.store(r + i, rest);
+        t.g.store(g + i, rest);
+        t.b.store(b + i, rest);
+    }
+}
+
+void transform_interleaved(const f32* m, RGBf32* c, size_t n) {
+    size_t i = 0;
+    for (; i + k_width <= n; i += k_width) {
+        transform_colours(m, Colours::load(c + i)).store(c + i);
+    }
+    if (i < n) {
+        transform_colours(m, Colours::load(c + i, n - i))
+            .store(c + i, n - i);
+    }
+}
+
+void clamp_range(f32 lo, f32 hi, f32* v, size_t n) {
+    const Lanes l(lo), h(hi);
+    each(v, n, [&](const Lanes& x) { return min(max(x, l), h); });
+}
+
+// SpectralResponse sums are kept in eight lanes at every level, so that the
+// order they are added in, and so the result, doesn't depend on the level
+using Sums = RGBx<8>;
+using Samples = f32x<8>;
+
+COLOR_FN_INLINE auto weights(const f32* rows, size_t stride, size_t i)
+    -> Sums {
+    return Sums::load(rows + i, rows + stride + i, rows + 2 * stride + i);
+}
+
+COLOR_FN_INLINE void sum_into(const Sums& sum, f32* out) {
+    out[0] = hsum(sum.r);
+    out[1] = hsum(sum.g);
+    out[2] = hsum(sum.b);
+}
+
+void respond(const f32* rows, size_t stride, const f32* values, size_t n,
+             f32* out) {
+    Sums sum(0.0f);
+    size_t i = 0;
+    for (; i + Samples::size <= n; i += Samples::size) {
+        sum += weights(rows, stride, i) * Samples::load(values + i);
+    }
+    if (i < n) {
+        // the rows are padded with zeros, so only the values need padding
+        sum += weights(rows, stride, i) * Samples::load(values + i, n - i);
+    }
+    sum_into(sum, out);
+}
+
+void respond_block(const f32* rows, size_t stride, const f32* const* values,
+                   size_t n, f32* out) {
+    Sums acc[k_respond_block];
+    for (size_t b = 0; b < k_respond_block; ++b) {
+        acc[b] = Sums(0.0f);
+    }
+    size_t i = 0;
+    for (; i + Samples::size <= n; i += Samples::size) {
+        const Sums w = weights(rows, stride, i);
+        for (size_t b = 0; b < k_respond_block; ++b) {
+            acc[b] += w * Samples::load(values[b] + i);
+        }
+    }
+    if (i < n) {
+        const Sums w = weights(rows, stride, i);
+        for (size_t b = 0; b < k_respond_block; ++b) {
+            acc[b] += w * Samples::load(values[b] + i, n - i);
+        }
+    }
+    for (size_t b = 0; b < k_respond_block; ++b) {
+        sum_into(acc[b], out + 3 * b);
+    }
+}
+
+const Kernels k_kernels = {
+    transfer,
+    quantize_codes<u8>,
+    quantize_codes<u16>,
+    transform_planar,
+    transform_interleaved,
+    clamp_range,
+    respond,
+    respond_block,
+};
+
+} // namespace
+} // namespace detail
+} // namespace color
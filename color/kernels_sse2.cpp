@@ -0,0 +1,8 @@
+// The batch kernels built for the baseline target, which is SSE2 on x86-64
+#include "color/kernels_impl.hpp"
+
+namespace color {
+namespace detail {
+auto kernels_sse2() -> const Kernels& { return k_kernels; }
+} // namespace detail
+} // namespace color
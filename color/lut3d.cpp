@@ -0,0 +1,286 @@
+#include "color/lut3d.hpp"
+#include "color/parallel.hpp"
+#include "color/tile.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace color {
+
+namespace {
+// entries in the shaper table when the shaper is not linear
+constexpr size_t k_shaper_size = 4096;
+
+auto make_shaper(const TransferFunction& shaper, f32 domain_max, size_t size)
+    -> Lut1D {
+    color_assert(size >= 2, "lut size ({}) must be at least 2", size);
+    color_assert(shaper.has_inverse(),
+                 "lut shaper must be a transfer function with an inverse");
+    const f32 last = f32(size - 1);
+    if (shaper.is_linear()) {
+        return Lut1D({0.0f, last}, 0.0f, domain_max);
+    }
+
+    std::vector<f32> table(k_shaper_size);
+    for (size_t i = 0; i < k_shaper_size; ++i) {
+        table[i] = f32(i) / f32(k_shaper_size - 1);
+    }
+    shaper.apply(table.data(), table.size());
+    for (auto& t : table) {
+        t = clamp(t, 0.0f, 1.0f) * last;
+    }
+    return Lut1D(std::move(table), 0.0f, domain_max);
+}
+
+// Corner offsets and weights of the 3D interpolation of one colour whose
+// lattice coordinates are (r, g, b)
+struct Cell {
+    size_t base;
+    f32 fr, fg, fb;
+};
+
+inline auto locate(f32 r, f32 g, f32 b, size_t size) -> Cell {
+    const size_t hi = size - 2;
+    size_t ir = std::min(size_t(r), hi);
+    size_t ig = std::min(size_t(g), hi);
+    size_t ib = std::min(size_t(b), hi);
+    return Cell{((ib * size + ig) * size + ir) * 3, r - f32(ir), g - f32(ig),
+                b - f32(ib)};
+}
+
+// lattice values v at the corners of the cell offset by (dr, dg, db)
+inline auto corner(const f32* v, size_t dr, size_t dg, size_t db,
+                   size_t size) -> const f32* {
+    return v + (db * size * size + dg * size + dr) * 3;
+}
+
+inline void trilinear(const f32* lattice, size_t size, const Cell& cell,
+                      f32* out) {
+    const f32* c000 = lattice + cell.base;
+    const f32* c100 = corner(c000, 1, 0, 0, size);
+    const f32* c010 = corner(c000, 0, 1, 0, size);
+    const f32* c110 = corner(c000, 1, 1, 0, size);
+    const f32* c001 = corner(c000, 0, 0, 1, size);
+    const f32* c101 = corner(c000, 1, 0, 1, size);
+    const f32* c011 = corner(c000, 0, 1, 1, size);
+    const f32* c111 = corner(c000, 1, 1, 1, size);
+    for (int c = 0; c < 3; ++c) {
+        f32 x00 = lerp(c000[c], c100[c], cell.fr);
+        f32 x10 = lerp(c010[c], c110[c], cell.fr);
+        f32 x01 = lerp(c001[c], c101[c], cell.fr);
+        f32 x11 = lerp(c011[c], c111[c], cell.fr);
+        out[c] = lerp(lerp(x00, x10, cell.fg), lerp(x01, x11, cell.fg),
+                      cell.fb);
+    }
+}
+
+inline void tetrahedral(const f32* lattice, size_t size, const Cell& cell,
+                        f32* out) {
+    const f32 fr = cell.fr, fg = cell.fg, fb = cell.fb;
+    const f32* c000 = lattice + cell.base;
+    const f32* c111 = corner(c000, 1, 1, 1, size);
+    // the tetrahedron runs from c000 to c111 through the two corners
+    // reached by stepping along the axes in order of decreasing fraction
+    const f32 *c1, *c2;
+    f32 w0, w1, w2, w3;
+    if (fr > fg) {
+        if (fg > fb) {
+            c1 = corner(c000, 1, 0, 0, size);
+            c2 = corner(c000, 1, 1, 0, size);
+            w0 = 1.0f - fr, w1 = fr - fg, w2 = fg - fb, w3 = fb;
+        } else if (fr > fb) {
+            c1 = corner(c000, 1, 0, 0, size);
+            c2 = corner(c000, 1, 0, 1, size);
+            w0 = 1.0f - fr, w1 = fr - fb, w2 = fb - fg, w3 = fg;
+        } else {
+            c1 = corner(c000, 0, 0, 1, size);
+            c2 = corner(c000, 1, 0, 1, size);
+            w0 = 1.0f - fb, w1 = fb - fr, w2 = fr - fg, w3 = fg;
+        }
+    } else {
+        if (fb > fg) {
+            c1 = corner(c000, 0, 0, 1, size);
+            c2 = corner(c000, 0, 1, 1, size);
+            w0 = 1.0f - fb, w1 = fb - fg, w2 = fg - fr, w3 = fr;
+        } else if (fb > fr) {
+            c1 = corner(c000, 0, 1, 0, size);
+            c2 = corner(c000, 0, 1, 1, size);
+            w0 = 1.0f - fg, w1 = fg - fb, w2 = fb - fr, w3 = fr;
+        } else {
+            c1 = corner(c000, 0, 1, 0, size);
+            c2 = corner(c000, 1, 1, 0, size);
+            w0 = 1.0f - fg, w1 = fg - fr, w2 = fr - fb, w3 = fb;
+        }
+    }
+    for (int c = 0; c < 3; ++c) {
+        out[c] = w0 * c000[c] + w1 * c1[c] + w2 * c2[c] + w3 * c111[c];
+    }
+}
+
+// apply lut to the first n colours of tile, in place
+void run(const Lut3D& lut, LutInterpolation interpolation, detail::Tile& tile,
+         size_t n) {
+    // lattice coordinates for the whole tile first, in simple loops over
+    // each channel that vectorize, then one interpolation per colour
+    const Lut1D& shaper = lut.shaper();
+    for (int c = 0; c < 3; ++c) {
+        f32* __restrict v = tile.c[c];
+        for (size_t i = 0; i < n; ++i) {
+            v[i] = shaper(v[i]);
+        }
+    }
+
+    const f32* lattice = lut.data();
+    const size_t size = lut.size();
+    f32* __restrict r = tile.c[0];
+    f32* __restrict g = tile.c[1];
+    f32* __restrict b = tile.c[2];
+    f32 out[3];
+    if (interpolation == LutInterpolation::Trilinear) {
+        for (size_t i = 0; i < n; ++i) {
+            trilinear(lattice, size, locate(r[i], g[i], b[i], size), out);
+            r[i] = out[0], g[i] = out[1], b[i] = out[2];
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            tetrahedral(lattice, size, locate(r[i], g[i], b[i], size), out);
+            r[i] = out[0], g[i] = out[1], b[i] = out[2];
+        }
+    }
+}
+
+template <typename S, typename D>
+void apply_image(const Lut3D& lut, LutInterpolation interpolation,
+                 const ImageView<const S>& src, const ImageView<D>& dst) {
+    color_assert(src.width == dst.width && src.height == dst.height,
+                 "source ({}x{}) and destination ({}x{}) sizes differ",
+                 src.width, src.height, dst.width, dst.height);
+
+    const size_t grain = detail::row_grain(src.width);
+    parallel_for(src.height, grain, [&](size_t y0, size_t y1) {
+        detail::Tile tile;
+        for (size_t y = y0; y < y1; ++y) {
+            for (size_t x = 0; x < src.width; x += detail::k_tile) {
+                size_t n = std::min(detail::k_tile, src.width - x);
+                detail::load(src, x, y, n, tile);
+                run(lut, interpolation, tile, n);
+                detail::store(tile, n, dst, x, y);
+            }
+        }
+    });
+}
+} // namespace
+
+Lut3D::Lut3D(const Pipeline& p, size_t size, TransferFunction shaper,
+             f32 domain_max)
+    : _size(size), _shaper(make_shaper(shaper, domain_max, size)) {
+    // input value at each lattice coordinate
+    std::vector<f32> axis(size);
+    for (size_t i = 0; i < size; ++i) {
+        axis[i] = f32(i) / f32(size - 1);
+    }
+    shaper.inverse().apply(axis.data(), axis.size());
+    for (auto& a : axis) {
+        a *= domain_max;
+    }
+
+    std::vector<RGBf32> lattice;
+    lattice.reserve(size * size * size);
+    for (size_t b = 0; b < size; ++b) {
+        for (size_t g = 0; g < size; ++g) {
+            for (size_t r = 0; r < size; ++r) {
+                lattice.push_back(RGBf32(axis[r], axis[g], axis[b]));
+            }
+        }
+    }
+    p.compile().apply(lattice.data(), lattice.size());
+    _lattice.assign(&lattice[0].r, &lattice[0].r + 3 * lattice.size());
+}
+
+RGBf32 Lut3D::operator()(RGBf32 c, LutInterpolation interpolation) const {
+    Cell cell = locate(_shaper(c.r), _shaper(c.g), _shaper(c.b), _size);
+    f32 out[3];
+    if (interpolation == LutInterpolation::Trilinear) {
+        trilinear(_lattice.data(), _size, cell, out);
+    } else {
+        tetrahedral(_lattice.data(), _size, cell, out);
+    }
+    return RGBf32(out[0], out[1], out[2]);
+}
+
+void Lut3D::apply(RGBf32* c, size_t n, LutInterpolation interpolation) const {
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        detail::Tile tile;
+        for (size_t i = begin; i < end; i += detail::k_tile) {
+            size_t m = std::min(detail::k_tile, end - i);
+            detail::load(c + i, m, tile);
+            run(*this, interpolation, tile, m);
+            detail::store(tile, m, c + i);
+        }
+    });
+}
+
+auto measure_accuracy(const Lut3D& lut, const Pipeline& p, f32 domain_max,
+                      LutInterpolation interpolation, size_t samples)
+    -> LutAccuracy {
+    color_assert(samples >= 2, "need at least 2 samples per axis, got {}",
+                 samples);
+    std::vector<RGBf32> exact;
+    exact.reserve(samples * samples * samples);
+    for (size_t b = 0; b < samples; ++b) {
+        for (size_t g = 0; g < samples; ++g) {
+            for (size_t r = 0; r < samples; ++r) {
+                exact.push_back(RGBf32(f32(r), f32(g), f32(b)) * domain_max /
+                                f32(samples - 1));
+            }
+        }
+    }
+    auto approx = exact;
+    p.apply(exact.data(), exact.size());
+    lut.apply(approx.data(), approx.size(), interpolation);
+
+    f64 sum = 0.0;
+    f32 max_error = 0.0f;
+    for (size_t i = 0; i < exact.size(); ++i) {
+        for (int c = 0; c < 3; ++c) {
+            f32 e = std::abs((&approx[i].r)[c] - (&exact[i].r)[c]);
+            max_error = std::max(max_error, e);
+            sum += e;
+        }
+    }
+    return LutAccuracy{lut.size(), lut.bytes(), interpolation, max_error,
+                       f32(sum / f64(3 * exact.size()))};
+}
+
+auto lut_accuracy_report(const Pipeline& p, const std::vector<size_t>& sizes,
+                         TransferFunction shaper, f32 domain_max)
+    -> std::vector<LutAccuracy> {
+    std::vector<LutAccuracy> report;
+    for (size_t size : sizes) {
+        Lut3D lut(p, size, shaper, domain_max);
+        for (auto interpolation :
+             {LutInterpolation::Trilinear, LutInterpolation::Tetrahedral}) {
+            report.push_back(
+                measure_accuracy(lut, p, domain_max, interpolation));
+        }
+    }
+    return report;
+}
+
+namespace detail {
+template <typename S, typename D>
+void apply_lut(const Lut3D& lut, LutInterpolation interpolation,
+               const ImageView<const S>& src, const ImageView<D>& dst) {
+    apply_image(lut, interpolation, src, dst);
+}
+
+#define COLOR_APPLY_LUT(S, D)                                                  \
+    template void apply_lut(const Lut3D&, LutInterpolation,                    \
+                            const ImageView<const S>&, const ImageView<D>&);
+
+COLOR_IMAGE_CHANNEL_PAIRS(COLOR_APPLY_LUT)
+
+#undef COLOR_APPLY_LUT
+} // namespace detail
+
+} // namespace color
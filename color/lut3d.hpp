@@ -0,0 +1,111 @@
+#pragma once
+
+#include "color/pipeline.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace color {
+
+/// Kernel used to reconstruct a 3D LUT between its lattice points
+enum class LutInterpolation : int {
+    /// Blend the 8 corners of the enclosing cell
+    Trilinear = 0,
+    /// Blend the 4 corners of the enclosing tetrahedron. Cheaper than
+    /// trilinear, and keeps the neutral axis exactly on the lattice diagonal
+    Tetrahedral
+};
+
+class Lut3D;
+
+namespace detail {
+/// Instantiated for f32, f16, u16 and u8 channels
+template <typename S, typename D>
+void apply_lut(const Lut3D& lut, LutInterpolation interpolation,
+               const ImageView<const S>& src, const ImageView<D>& dst);
+} // namespace detail
+
+/**
+ * @brief A pipeline sampled on a size x size x size lattice
+ * @details Inputs are clamped to [0, domain_max], divided by domain_max and
+ * passed through the shaper before indexing the lattice. A shaper such as
+ * the sRGB OETF spreads the lattice points perceptually, and with a
+ * domain_max above 1 lets scene-referred HDR inputs be baked without
+ * wasting most of the lattice on highlights. At apply time the shaper is
+ * itself evaluated from a dense 1D table, so no transfer functions are
+ * evaluated per pixel.
+ */
+class Lut3D {
+public:
+    /// Bake p. shaper must have a known inverse
+    Lut3D(const Pipeline& p, size_t size,
+          TransferFunction shaper = TransferFunction(),
+          f32 domain_max = 1.0f);
+
+    /// Number of lattice points along each axis
+    size_t size() const { return _size; }
+    /// Memory used by the lattice and shaper, in bytes
+    size_t bytes() const {
+        return sizeof(f32) * (_lattice.size() + _shaper.table.size());
+    }
+    /// Lattice values, as RGB triples with red varying fastest
+    const f32* data() const { return _lattice.data(); }
+
+    RGBf32 operator()(RGBf32 c, LutInterpolation interpolation =
+                                    LutInterpolation::Tetrahedral) const;
+
+    /// Apply to n colours in place, in parallel, see set_num_threads()
+    void apply(RGBf32* c, size_t n,
+               LutInterpolation interpolation =
+                   LutInterpolation::Tetrahedral) const;
+
+    /**
+     * @brief Apply to every pixel of src, writing to dst
+     * @details src and dst must have the same dimensions and may be the
+     * same image. Rows are processed in parallel, see set_num_threads()
+     */
+    template <typename S, typename D>
+    void apply(const ImageView<S>& src, const ImageView<D>& dst,
+               LutInterpolation interpolation =
+                   LutInterpolation::Tetrahedral) const {
+        detail::apply_lut(
+            *this, interpolation,
+            ImageView<const typename std::remove_const<S>::type>(src), dst);
+    }
+
+    /// Maps an input channel value to a lattice coordinate in [0, size - 1]
+    const Lut1D& shaper() const { return _shaper; }
+
+private:
+    size_t _size;
+    Lut1D _shaper;
+    std::vector<f32> _lattice;
+};
+
+/// Error of a baked LUT against the exact pipeline
+struct LutAccuracy {
+    size_t size;
+    size_t bytes;
+    LutInterpolation interpolation;
+    /// Largest absolute difference in any channel
+    f32 max_error;
+    /// Mean absolute difference over all channels
+    f32 mean_error;
+};
+
+/**
+ * @brief Compare lut against the exact pipeline p
+ * @details Both are evaluated on a samples^3 grid over [0, domain_max]^3.
+ * The grid is offset from the lattice so that most samples fall between
+ * lattice points, where the interpolation error is largest
+ */
+auto measure_accuracy(const Lut3D& lut, const Pipeline& p, f32 domain_max,
+                      LutInterpolation interpolation, size_t samples = 37)
+    -> LutAccuracy;
+
+/// Bake p at each of sizes and measure each with both interpolations
+auto lut_accuracy_report(const Pipeline& p, const std::vector<size_t>& sizes,
+                         TransferFunction shaper = TransferFunction(),
+                         f32 domain_max = 1.0f) -> std::vector<LutAccuracy>;
+
+} // namespace color
@@ -0,0 +1,260 @@
+#include "color/parallel.hpp"
+#include "color/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace color {
+
+namespace {
+std::atomic<int> g_num_threads{0};
+// read with std::atomic_load, as parallel_for may be running on any thread
+std::shared_ptr<const Executor> g_executor;
+
+// a range of chunks [lo, hi) packed into one word, so that a thread taking
+// from the front of its share and another stealing from the back never
+// both get the same chunk
+auto pack(u64 lo, u64 hi) -> u64 { return lo << 32 | hi; }
+auto lo(u64 range) -> u64 { return range >> 32; }
+auto hi(u64 range) -> u64 { return range & 0xffffffffu; }
+
+/// A parallel_for in flight
+class Job {
+public:
+    Job(size_t n, size_t grain, size_t num_chunks, size_t num_slots,
+        const std::function<void(size_t, size_t)>& fn)
+        : num_slots(num_slots), _n(n), _grain(grain), _fn(fn),
+          _shares(new Share[num_slots]) {
+        for (size_t s = 0; s < num_slots; ++s) {
+            _shares[s].range.store(pack(s * num_chunks / num_slots,
+                                        (s + 1) * num_chunks / num_slots),
+                                   std::memory_order_relaxed);
+        }
+    }
+
+    /// Run chunks from slot's share, then from others', until none are left
+    /// or one has thrown
+    void work(size_t slot) {
+        size_t chunk;
+        while (!_failed.load(std::memory_order_relaxed) &&
+               (take(slot, chunk) || steal(slot, chunk))) {
+            const size_t begin = chunk * _grain;
+            try {
+                _fn(begin, std::min(begin + _grain, _n));
+            } catch (...) {
+                // kept for the caller, who rethrows it once every thread
+                // has left the job
+                if (!_failed.exchange(true)) {
+                    _error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    /// Rethrow the first exception thrown by a chunk, if any was
+    void rethrow() const {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+    /// Threads that can work on the job, the first being the caller's
+    const size_t num_slots;
+    /// The next slot for a pool thread, guarded by the pool's mutex
+    size_t next_slot = 1;
+    /// Pool threads inside work(), guarded by the pool's mutex
+    size_t active = 0;
+
+private:
+    // the front chunk of slot's own share
+    auto take(size_t slot, size_t& chunk) -> bool {
+        std::atomic<u64>& share = _shares[slot].range;
+        u64 r = share.load(std::memory_order_acquire);
+        while (lo(r) < hi(r)) {
+            if (share.compare_exchange_weak(r, pack(lo(r) + 1, hi(r)),
+                                            std::memory_order_acq_rel)) {
+                chunk = lo(r);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the back half of the next share along that has any left, which
+    // becomes slot's share once its first chunk is taken
+    auto steal(size_t slot, size_t& chunk) -> bool {
+        for (size_t i = 1; i < num_slots; ++i) {
+            std::atomic<u64>& victim = _shares[(slot + i) % num_slots].range;
+            u64 r = victim.load(std::memory_order_acquire);
+            while (lo(r) < hi(r)) {
+                const u64 mid = hi(r) - (hi(r) - lo(r) + 1) / 2;
+                if (victim.compare_exchange_weak(r, pack(lo(r), mid),
+                                                 std::memory_order_acq_rel)) {
+                    // slot's share is empty, so nobody else changes it
+                    _shares[slot].range.store(pack(mid + 1, hi(r)),
+                                              std::memory_order_release);
+                    chunk = mid;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // a cache line each, so that threads working through their own shares
+    // don't contend
+    struct Share {
+        std::atomic<u64> range;
+        char pad[64 - sizeof(std::atomic<u64>)];
+    };
+
+    size_t _n;
+    size_t _grain;
+    const std::function<void(size_t, size_t)>& _fn;
+    std::unique_ptr<Share[]> _shares;
+    std::atomic<bool> _failed{false};
+    // written only by the thread that set _failed
+    std::exception_ptr _error;
+};
+
+/// Threads that sleep until a Job has a free slot
+class Pool {
+public:
+    ~Pool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto& t : _threads) {
+            t.join();
+        }
+    }
+
+    /// Run job on the calling thread and as many pool threads as it has
+    /// slots for, starting more if there are too few
+    void run(Job& job) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            while (_threads.size() + 1 < job.num_slots) {
+                _threads.emplace_back([this]() { worker(); });
+            }
+            _jobs.push_back(&job);
+        }
+        _wake.notify_all();
+
+        job.work(0);
+
+        // every chunk has been taken, or one has thrown, so once the pool
+        // threads still running them leave, the job is done
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobs.erase(std::find(_jobs.begin(), _jobs.end(), &job));
+            _idle.wait(lock, [&]() { return job.active == 0; });
+        }
+        job.rethrow();
+    }
+
+private:
+    void worker() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            Job* job = nullptr;
+            _wake.wait(lock, [&]() { return _stop || (job = open_job()); });
+            if (_stop) {
+                return;
+            }
+            const size_t slot = job->next_slot++;
+            ++job->active;
+            lock.unlock();
+            job->work(slot);
+            lock.lock();
+            if (--job->active == 0) {
+                _idle.notify_all();
+            }
+        }
+    }
+
+    // the newest job with a free slot, which is the innermost if calls are
+    // nested
+    auto open_job() -> Job* {
+        for (auto it = _jobs.rbegin(); it != _jobs.rend(); ++it) {
+            if ((*it)->next_slot < (*it)->num_slots) {
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _idle;
+    std::vector<Job*> _jobs;
+    std::vector<std::thread> _threads;
+    bool _stop = false;
+};
+
+auto pool() -> Pool& {
+    static Pool p;
+    return p;
+}
+} // namespace
+
+auto num_threads() -> int {
+    int n = g_num_threads.load(std::memory_order_relaxed);
+    if (n > 0) {
+        return n;
+    }
+    // which can mean reading /sys, so is asked once
+    static const int hardware =
+        std::max(1, int(std::thread::hardware_concurrency()));
+    return hardware;
+}
+
+void set_num_threads(int n) {
+    g_num_threads.store(std::max(0, n), std::memory_order_relaxed);
+}
+
+void set_executor(Executor executor) {
+    std::shared_ptr<const Executor> e;
+    if (executor) {
+        e = std::make_shared<const Executor>(std::move(executor));
+    }
+    std::atomic_store(&g_executor, e);
+}
+
+void parallel_for(size_t n, size_t grain,
+                  const std::function<void(size_t, size_t)>& fn) {
+    // chunks are numbered in 32 bits
+    const size_t max_chunks = std::numeric_limits<u32>::max();
+    grain = std::max({grain, size_t(1), (n + max_chunks - 1) / max_chunks});
+    const size_t num_chunks = (n + grain - 1) / grain;
+    const size_t num_workers =
+        std::min(num_chunks, size_t(std::max(1, num_threads())));
+    if (num_workers <= 1) {
+        for (size_t begin = 0; begin < n; begin += grain) {
+            fn(begin, std::min(begin + grain, n));
+        }
+        return;
+    }
+
+    if (auto executor = std::atomic_load(&g_executor)) {
+        (*executor)(num_chunks, [&](size_t chunk) {
+            const size_t begin = chunk * grain;
+            fn(begin, std::min(begin + grain, n));
+        });
+        return;
+    }
+
+    Job job(n, grain, num_chunks, num_workers, fn);
+    pool().run(job);
+}
+
+} // namespace color
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace color {
+
+/// Number of threads used by batch functions
+auto num_threads() -> int;
+
+/// Set the number of threads used by batch functions. Zero (the default)
+/// uses one per hardware thread
+void set_num_threads(int n);
+
+/**
+ * @brief Runs task(i) once for each i in [0, n), in any order and on any
+ * threads, returning when all have finished
+ */
+using Executor =
+    std::function<void(size_t n, const std::function<void(size_t)>& task)>;
+
+/**
+ * @brief Hand the work of batch functions to executor instead of the
+ * built-in thread pool
+ * @details For sharing threads with the rest of an application, for
+ * instance running the tasks with tbb::parallel_for inside a
+ * tbb::task_arena. Work is split into the same chunks whichever executor
+ * runs it. An empty executor restores the built-in pool. Not safe to call
+ * while batch functions are running
+ */
+void set_executor(Executor executor);
+
+/**
+ * @brief Call fn(begin, end) on subranges covering [0, n), in parallel
+ * @details [0, n) is split into chunks of grain items (the last may be
+ * shorter). The chunks don't depend on the number of threads, so neither
+ * do the results.
+ *
+ * The chunks are run by a pool of num_threads() - 1 threads started on
+ * first use, and the calling thread. Each thread starts on its own share
+ * of the chunks, taking them in order to keep its accesses sequential, and
+ * once it runs out steals half of what is left of another's share. Calls
+ * from inside fn, or from other threads, run alongside each other in the
+ * same pool.
+ *
+ * If fn throws, chunks not yet started are skipped, and the first exception
+ * is rethrown once the threads running the others have finished.
+ */
+void parallel_for(size_t n, size_t grain,
+                  const std::function<void(size_t, size_t)>& fn);
+
+namespace detail {
+
+/// Bytes read and written by each chunk of a batch function: big enough
+/// that handing chunks out costs nothing, small enough that a chunk's
+/// input and output stay in a core's L2
+constexpr size_t k_chunk_bytes = 256 * 1024;
+
+/// Grain for items that each read and write bytes
+constexpr auto chunk_grain(size_t bytes) -> size_t {
+    return bytes >= k_chunk_bytes ? 1 : k_chunk_bytes / (bytes ? bytes : 1);
+}
+
+} // namespace detail
+
+} // namespace color
@@ -0,0 +1,325 @@
+#include "color/pipeline.hpp"
+#include "color/kernels.hpp"
+#include "color/parallel.hpp"
+#include "color/tile.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace color {
+
+namespace {
+using Stage = Pipeline::Stage;
+using Kind = Pipeline::Stage::Kind;
+
+bool is_identity(const Stage& s) {
+    switch (s.kind) {
+    case Kind::Transfer:
+        return s.transfer.is_linear();
+    case Kind::Matrix:
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                if (std::abs(s.matrix[i][j] - (i == j ? 1.0f : 0.0f)) >
+                    1e-6f) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    case Kind::Scale:
+        return s.scale == V3f(1.0f);
+    case Kind::Clamp:
+        return s.lo == -std::numeric_limits<f32>::infinity() &&
+               s.hi == std::numeric_limits<f32>::infinity();
+    case Kind::Lut1D:
+    default:
+        return false;
+    }
+}
+
+bool is_linear_map(const Stage& s) {
+    return s.kind == Kind::Matrix || s.kind == Kind::Scale;
+}
+
+M33f as_matrix(const Stage& s) {
+    if (s.kind == Kind::Matrix) {
+        return s.matrix;
+    }
+    return M33f(s.scale.x, 0.0f, 0.0f, 0.0f, s.scale.y, 0.0f, 0.0f, 0.0f,
+                s.scale.z);
+}
+
+void scale(const V3f& s, detail::Tile& tile, size_t n) {
+    for (int c = 0; c < 3; ++c) {
+        f32* __restrict v = tile.c[c];
+        const f32 k = s[c];
+        for (size_t i = 0; i < n; ++i) {
+            v[i] *= k;
+        }
+    }
+}
+
+void clamp(f32 lo, f32 hi, detail::Tile& tile, size_t n) {
+    for (int c = 0; c < 3; ++c) {
+        detail::kernels().clamp(lo, hi, tile.c[c], n);
+    }
+}
+
+void lookup(const Lut1D& lut, detail::Tile& tile, size_t n) {
+    for (int c = 0; c < 3; ++c) {
+        f32* __restrict v = tile.c[c];
+        for (size_t i = 0; i < n; ++i) {
+            v[i] = lut(v[i]);
+        }
+    }
+}
+
+// run stages [first, p.size()) over the first n colours of tile
+void run(const Pipeline& p, detail::Tile& tile, size_t n, size_t first = 0) {
+    for (size_t s = first; s < p.size(); ++s) {
+        const Stage& stage = p[s];
+        switch (stage.kind) {
+        case Kind::Transfer:
+            detail::apply_transfer(stage.transfer, tile, n,
+                                   stage.accuracy);
+            break;
+        case Kind::Matrix:
+            detail::transform(stage.matrix, tile, n);
+            break;
+        case Kind::Scale:
+            scale(stage.scale, tile, n);
+            break;
+        case Kind::Clamp:
+            clamp(stage.lo, stage.hi, tile, n);
+            break;
+        case Kind::Lut1D:
+            lookup(*stage.lut, tile, n);
+            break;
+        }
+    }
+}
+
+template <typename S, typename D>
+void apply_image(const Pipeline& p, const ImageView<const S>& src,
+                 const ImageView<D>& dst, Dither dither) {
+    color_assert(src.width == dst.width && src.height == dst.height,
+                 "source ({}x{}) and destination ({}x{}) sizes differ",
+                 src.width, src.height, dst.width, dst.height);
+
+    // a leading transfer on an 8 or 16-bit source is looked up as it is
+    // loaded
+    const f32* table = nullptr;
+    if (!p.empty() && p[0].kind == Kind::Transfer) {
+        table = detail::transfer_table(p[0].transfer, src.channel[0]);
+    }
+    const size_t first = table ? 1 : 0;
+
+    const size_t grain = detail::row_grain(src.width);
+    parallel_for(src.height, grain, [&](size_t y0, size_t y1) {
+        detail::Tile tile;
+        for (size_t y = y0; y < y1; ++y) {
+            for (size_t x = 0; x < src.width; x += detail::k_tile) {
+                size_t n = std::min(detail::k_tile, src.width - x);
+                if (table) {
+                    detail::load(src, x, y, n, table, tile);
+                } else {
+                    detail::load(src, x, y, n, tile);
+                }
+                run(p, tile, n, first);
+                detail::store(tile, n, dst, x, y, dither);
+            }
+        }
+    });
+}
+} // namespace
+
+Pipeline& Pipeline::transfer(TransferFunction tf, Accuracy accuracy) {
+    Stage s(Kind::Transfer);
+    s.transfer = std::move(tf);
+    s.accuracy = accuracy;
+    _stages.push_back(std::move(s));
+    return *this;
+}
+
+Pipeline& Pipeline::matrix(const M33f& m) {
+    Stage s(Kind::Matrix);
+    s.matrix = m;
+    _stages.push_back(std::move(s));
+    return *this;
+}
+
+Pipeline& Pipeline::scale(V3f k) {
+    Stage s(Kind::Scale);
+    s.scale = k;
+    _stages.push_back(std::move(s));
+    return *this;
+}
+
+Pipeline& Pipeline::clamp(f32 lo, f32 hi) {
+    color_assert(lo <= hi, "clamp range [{}, {}] is empty", lo, hi);
+    Stage s(Kind::Clamp);
+    s.lo = lo;
+    s.hi = hi;
+    _stages.push_back(std::move(s));
+    return *this;
+}
+
+Pipeline& Pipeline::lut(Lut1D lut) {
+    Stage s(Kind::Lut1D);
+    s.lut = std::make_shared<const Lut1D>(std::move(lut));
+    _stages.push_back(std::move(s));
+    return *this;
+}
+
+Pipeline& Pipeline::append(const Pipeline& p) {
+    _stages.insert(_stages.end(), p._stages.begin(), p._stages.end());
+    return *this;
+}
+
+Pipeline& Pipeline::convert(const ColorSpaceConversion& conversion) {
+    return transfer(conversion.decode())
+        .matrix(conversion.matrix())
+        .transfer(conversion.encode());
+}
+
+Pipeline& Pipeline::xyz_to_rgb(const ColorSpaceRGB& cs, bool ignore_transfer) {
+    matrix(cs.m_xyz_to_rgb);
+    if (!ignore_transfer) {
+        transfer(cs.oetf);
+    }
+    return *this;
+}
+
+Pipeline& Pipeline::rgb_to_xyz(const ColorSpaceRGB& cs, bool ignore_transfer) {
+    if (!ignore_transfer) {
+        transfer(cs.eotf);
+    }
+    return matrix(cs.m_rgb_to_xyz);
+}
+
+void Pipeline::_push(std::vector<Stage>& stages, Stage s) {
+    if (is_identity(s)) {
+        return;
+    }
+
+    if (stages.empty()) {
+        stages.push_back(std::move(s));
+        return;
+    }
+
+    const Stage& last = stages.back();
+    if (is_linear_map(last) && is_linear_map(s)) {
+        Stage fused(Kind::Scale);
+        if (last.kind == Kind::Scale && s.kind == Kind::Scale) {
+            fused.scale = last.scale * s.scale;
+        } else {
+            fused.kind = Kind::Matrix;
+            fused.matrix = as_matrix(s) * as_matrix(last);
+        }
+        stages.pop_back();
+        _push(stages, std::move(fused));
+        return;
+    }
+
+    if (last.kind == Kind::Transfer && s.kind == Kind::Transfer) {
+        if (s.transfer.is_inverse_of(last.transfer)) {
+            stages.pop_back();
+            return;
+        }
+        using Curve = TransferFunction::Curve;
+        if (last.transfer.curve() == Curve::Gamma &&
+            s.transfer.curve() == Curve::Gamma) {
+            Stage fused(Kind::Transfer);
+            fused.transfer = TransferFunction::gamma(last.transfer.gamma() *
+                                                     s.transfer.gamma());
+            // keep the tighter of the two bounds
+            fused.accuracy = std::min(last.accuracy, s.accuracy);
+            stages.pop_back();
+            _push(stages, std::move(fused));
+            return;
+        }
+    }
+
+    if (last.kind == Kind::Clamp && s.kind == Kind::Clamp) {
+        Stage fused(Kind::Clamp);
+        fused.lo = color::clamp(last.lo, s.lo, s.hi);
+        fused.hi = color::clamp(last.hi, s.lo, s.hi);
+        stages.pop_back();
+        _push(stages, std::move(fused));
+        return;
+    }
+
+    stages.push_back(std::move(s));
+}
+
+auto Pipeline::compile() const -> Pipeline {
+    Pipeline result;
+    for (const auto& s : _stages) {
+        _push(result._stages, s);
+    }
+    return result;
+}
+
+RGBf32 Pipeline::operator()(RGBf32 c) const {
+    for (const auto& s : _stages) {
+        switch (s.kind) {
+        case Kind::Transfer:
+            c = s.transfer(c);
+            break;
+        case Kind::Matrix: {
+            const M33f& m = s.matrix;
+            c = RGBf32(m[0][0] * c.r + m[0][1] * c.g + m[0][2] * c.b,
+                       m[1][0] * c.r + m[1][1] * c.g + m[1][2] * c.b,
+                       m[2][0] * c.r + m[2][1] * c.g + m[2][2] * c.b);
+            break;
+        }
+        case Kind::Scale:
+            c = RGBf32(c.r * s.scale.x, c.g * s.scale.y, c.b * s.scale.z);
+            break;
+        case Kind::Clamp:
+            c = RGBf32(color::clamp(c.r, s.lo, s.hi),
+                       color::clamp(c.g, s.lo, s.hi),
+                       color::clamp(c.b, s.lo, s.hi));
+            break;
+        case Kind::Lut1D:
+            c = RGBf32((*s.lut)(c.r), (*s.lut)(c.g), (*s.lut)(c.b));
+            break;
+        }
+    }
+    return c;
+}
+
+void Pipeline::apply(RGBf32* c, size_t n) const {
+    if (_stages.empty()) {
+        return;
+    }
+
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        detail::Tile tile;
+        for (size_t i = begin; i < end; i += detail::k_tile) {
+            size_t m = std::min(detail::k_tile, end - i);
+            detail::load(c + i, m, tile);
+            run(*this, tile, m);
+            detail::store(tile, m, c + i);
+        }
+    });
+}
+
+namespace detail {
+template <typename S, typename D>
+void apply_pipeline(const Pipeline& p, const ImageView<const S>& src,
+                    const ImageView<D>& dst, Dither dither) {
+    apply_image(p, src, dst, dither);
+}
+
+#define COLOR_APPLY_PIPELINE(S, D)                                             \
+    template void apply_pipeline(const Pipeline&, const ImageView<const S>&,   \
+                                 const ImageView<D>&, Dither);
+
+COLOR_IMAGE_CHANNEL_PAIRS(COLOR_APPLY_PIPELINE)
+
+#undef COLOR_APPLY_PIPELINE
+} // namespace detail
+
+} // namespace color
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "color/color_space_conversion.hpp"
+#include "color/image.hpp"
+#include "color/quantize.hpp"
+#include "color/transfer_function.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace color {
+
+/**
+ * @brief A 1D lookup table applied to each channel
+ * @details table samples the curve uniformly over [domain_min, domain_max].
+ * Inputs are clamped to the domain and looked up with linear interpolation
+ */
+struct Lut1D {
+    std::vector<f32> table;
+    f32 domain_min;
+    f32 domain_max;
+
+    Lut1D(std::vector<f32> table, f32 domain_min = 0.0f,
+          f32 domain_max = 1.0f)
+        : table(std::move(table)), domain_min(domain_min),
+          domain_max(domain_max) {
+        color_assert(this->table.size() > 1,
+                     "lut needs at least 2 entries, got {}",
+                     this->table.size());
+        color_assert(domain_max > domain_min, "lut domain [{}, {}] is empty",
+                     domain_min, domain_max);
+    }
+
+    f32 operator()(f32 x) const {
+        const f32 last = f32(table.size() - 1);
+        f32 u = clamp((x - domain_min) / (domain_max - domain_min) * last,
+                      0.0f, last);
+        size_t i = std::min(size_t(u), table.size() - 2);
+        return lerp(table[i], table[i + 1], u - f32(i));
+    }
+};
+
+class Pipeline;
+
+namespace detail {
+/// Instantiated for f32, f16, u16 and u8 channels
+template <typename S, typename D>
+void apply_pipeline(const Pipeline& p, const ImageView<const S>& src,
+                    const ImageView<D>& dst, Dither dither);
+} // namespace detail
+
+/**
+ * @brief A sequence of per-colour operations run as one pass over a buffer
+ * @details Stages are appended in the order they are applied. compile()
+ * returns an equivalent pipeline with adjacent matrices and scales
+ * multiplied together, adjacent clamps intersected, transfer functions
+ * followed by their inverse removed and identity stages dropped. Buffers
+ * are processed a tile at a time, running every stage over the tile while
+ * it is in L1, so a pipeline costs one read and one write of the image no
+ * matter how many stages it has.
+ */
+class Pipeline {
+public:
+    struct Stage {
+        enum class Kind : int {
+            Transfer = 0,
+            /// 3x3 matrix applied to each colour
+            Matrix,
+            /// Per-channel multiply
+            Scale,
+            /// Per-channel clamp to [lo, hi]
+            Clamp,
+            Lut1D
+        };
+
+        Kind kind;
+        TransferFunction transfer;
+        Accuracy accuracy;
+        M33f matrix;
+        V3f scale;
+        f32 lo;
+        f32 hi;
+        std::shared_ptr<const color::Lut1D> lut;
+
+        explicit Stage(Kind kind)
+            : kind(kind), accuracy(Accuracy::Exact), scale(1.0f), lo(0.0f),
+              hi(0.0f) {}
+    };
+
+    /// Apply tf, evaluated to within accuracy. See TransferFunction::apply()
+    Pipeline& transfer(TransferFunction tf,
+                       Accuracy accuracy = Accuracy::Exact);
+    Pipeline& matrix(const M33f& m);
+    Pipeline& scale(f32 s) { return scale(V3f(s)); }
+    Pipeline& scale(V3f s);
+    Pipeline& clamp(f32 lo, f32 hi);
+    Pipeline& lut(Lut1D lut);
+    /// Append the stages of p
+    Pipeline& append(const Pipeline& p);
+
+    /// Append the decode, matrix and encode of conversion
+    Pipeline& convert(const ColorSpaceConversion& conversion);
+    /// Append the conversion from linear XYZ to RGB in cs
+    Pipeline& xyz_to_rgb(const ColorSpaceRGB& cs, bool ignore_transfer = false);
+    /// Append the conversion from RGB in cs to linear XYZ
+    Pipeline& rgb_to_xyz(const ColorSpaceRGB& cs, bool ignore_transfer = false);
+
+    /// An equivalent pipeline with fused and redundant stages removed
+    auto compile() const -> Pipeline;
+
+    size_t size() const { return _stages.size(); }
+    bool empty() const { return _stages.empty(); }
+    const Stage& operator[](size_t i) const { return _stages[i]; }
+
+    /// Run one colour through every stage
+    RGBf32 operator()(RGBf32 c) const;
+
+    /// Run n colours through every stage, in place and in parallel, see
+    /// set_num_threads()
+    void apply(RGBf32* c, size_t n) const;
+
+    /**
+     * @brief Run every pixel of src through the pipeline into dst
+     * @details src and dst must have the same dimensions and may be the
+     * same image. Integer destinations are quantized with dither as they
+     * are written, see quantize(). Rows are processed in parallel, see
+     * set_num_threads()
+     */
+    template <typename S, typename D>
+    void apply(const ImageView<S>& src, const ImageView<D>& dst,
+               Dither dither = Dither::None) const {
+        detail::apply_pipeline(
+            *this,
+            ImageView<const typename std::remove_const<S>::type>(src), dst,
+            dither);
+    }
+
+private:
+    // append s to the end of stages, folding it into the last stage where
+    // possible
+    static void _push(std::vector<Stage>& stages, Stage s);
+
+    std::vector<Stage> _stages;
+};
+
+} // namespace color
@@ -2,3 +2,6 @@
 
 #define COLOR_FN_PURE __attribute__((pure))
 #define COLOR_FN_CONST __attribute__((const))
+/// Inline regardless of size, for the lane functions, whose values only stay
+/// in registers once inlined into the loop calling them
+#define COLOR_FN_INLINE inline __attribute__((always_inline))
@@ -0,0 +1,279 @@
+#include "color/quantize.hpp"
+#include "color/kernels.hpp"
+#include "color/parallel.hpp"
+#include "color/tile.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace color {
+
+static_assert(sizeof(RGBu8) == 3 * sizeof(u8) &&
+                  sizeof(RGBu16) == 3 * sizeof(u16) &&
+                  sizeof(RGBf32) == 3 * sizeof(f32),
+              "colours must be tightly packed channels");
+
+namespace {
+template <typename D>
+void quantize_rgb(const RGBf32* src, D* dst, size_t n,
+                  const TransferFunction& encode, Accuracy accuracy) {
+    parallel_for(n, detail::k_colour_grain, [&](size_t begin, size_t end) {
+        if (encode.is_linear()) {
+            quantize(&src[begin].r, &dst[begin].r, 3 * (end - begin));
+            return;
+        }
+
+        RGBf32 scratch[detail::k_tile];
+        for (size_t i = begin; i < end; i += detail::k_tile) {
+            size_t m = std::min(detail::k_tile, end - i);
+            std::copy(src + i, src + i + m, scratch);
+            encode.apply(scratch, m, accuracy);
+            quantize(&scratch[0].r, &dst[i].r, 3 * m);
+        }
+    });
+}
+
+template <typename T>
+void quantize_image(const RGBf32* src, RGBu<T>* dst, size_t width,
+                    size_t height, Dither dither,
+                    const TransferFunction& encode, Accuracy accuracy) {
+    // the rows are quantized as they are, three channels at a time, against
+    // offsets repeated for each channel
+    const size_t grain = detail::row_grain(width);
+    parallel_for(height, grain, [&](size_t y0, size_t y1) {
+        RGBf32 scratch[detail::k_tile];
+        for (size_t y = y0; y < y1; ++y) {
+            for (size_t x = 0; x < width; x += detail::k_tile) {
+                size_t n = std::min(detail::k_tile, width - x);
+                const RGBf32* s = src + y * width + x;
+                const f32* offsets = detail::dither_row_rgb(dither, x, y);
+                if (!encode.is_linear()) {
+                    std::copy(s, s + n, scratch);
+                    encode.apply(scratch, n, accuracy);
+                    s = scratch;
+                }
+                quantize(&s[0].r, &dst[y * width + x].r, 3 * n, offsets);
+            }
+        }
+    });
+}
+
+constexpr size_t k_mask_pixels = k_dither_size * k_dither_size;
+// each row of the masks is stored repeated out to this width, so that a
+// whole tile's worth of offsets starting at any column is contiguous
+constexpr size_t k_row_width = k_dither_size + detail::k_tile;
+
+// rank of pixel (x, y) in the 8x8 Bayer matrix, built up from the 2x2
+// matrix a bit of each coordinate at a time, the lowest bits being the
+// most significant
+auto bayer_rank(size_t x, size_t y) -> size_t {
+    static const size_t m2[2][2] = {{0, 2}, {3, 1}};
+    size_t rank = 0;
+    for (int bit = 0; bit < 3; ++bit) {
+        rank += m2[(y >> bit) & 1][(x >> bit) & 1] << (2 * (2 - bit));
+    }
+    return rank;
+}
+
+/**
+ * Rank of each pixel in a blue noise ordering built with Ulichney's
+ * void-and-cluster method. Energy is the sum of a Gaussian over the set
+ * pixels, wrapping around the edges so the mask tiles seamlessly. A sparse
+ * random pattern is relaxed by moving its tightest cluster to its largest
+ * void until they coincide. Ranks below its population are given by
+ * removing clusters from it one at a time, the rest by filling voids
+ */
+auto void_and_cluster() -> std::vector<size_t> {
+    const size_t N = k_dither_size;
+    const f32 sigma = 1.5f;
+    std::vector<f32> kernel(k_mask_pixels);
+    for (size_t y = 0; y < N; ++y) {
+        for (size_t x = 0; x < N; ++x) {
+            f32 dx = f32(std::min(x, N - x)), dy = f32(std::min(y, N - y));
+            kernel[y * N + x] =
+                std::exp(-(dx * dx + dy * dy) / (2.0f * sigma * sigma));
+        }
+    }
+
+    std::vector<bool> set(k_mask_pixels, false);
+    std::vector<f32> energy(k_mask_pixels, 0.0f);
+    auto toggle = [&](size_t p) {
+        const f32 sign = set[p] ? -1.0f : 1.0f;
+        set[p] = !set[p];
+        const size_t px = p % N, py = p / N;
+        for (size_t y = 0; y < N; ++y) {
+            const f32* k = &kernel[((y + N - py) % N) * N];
+            for (size_t x = 0; x < N; ++x) {
+                energy[y * N + x] += sign * k[(x + N - px) % N];
+            }
+        }
+    };
+    auto tightest_cluster = [&]() {
+        size_t best = k_mask_pixels;
+        for (size_t p = 0; p < k_mask_pixels; ++p) {
+            if (set[p] && (best == k_mask_pixels || energy[p] > energy[best])) {
+                best = p;
+            }
+        }
+        return best;
+    };
+    auto largest_void = [&]() {
+        size_t best = k_mask_pixels;
+        for (size_t p = 0; p < k_mask_pixels; ++p) {
+            if (!set[p] &&
+                (best == k_mask_pixels || energy[p] < energy[best])) {
+                best = p;
+            }
+        }
+        return best;
+    };
+
+    // a fixed xorshift sequence, so every build gets the same mask
+    u32 state = 0x9e3779b9u;
+    const size_t population = k_mask_pixels / 10;
+    for (size_t placed = 0; placed < population;) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        size_t p = state % k_mask_pixels;
+        if (!set[p]) {
+            toggle(p);
+            ++placed;
+        }
+    }
+    for (size_t i = 0; i < k_mask_pixels; ++i) {
+        size_t cluster = tightest_cluster();
+        toggle(cluster);
+        size_t hole = largest_void();
+        toggle(hole);
+        if (hole == cluster) {
+            break;
+        }
+    }
+
+    std::vector<size_t> rank(k_mask_pixels);
+    const std::vector<bool> initial_set = set;
+    const std::vector<f32> initial_energy = energy;
+    for (size_t r = population; r-- > 0;) {
+        size_t cluster = tightest_cluster();
+        toggle(cluster);
+        rank[cluster] = r;
+    }
+    set = initial_set;
+    energy = initial_energy;
+    for (size_t r = population; r < k_mask_pixels; ++r) {
+        size_t hole = largest_void();
+        toggle(hole);
+        rank[hole] = r;
+    }
+    return rank;
+}
+
+struct Mask {
+    std::once_flag once;
+    std::vector<f32> values;
+    // rows repeated out to k_row_width
+    std::vector<f32> rows;
+    // the same with each offset repeated for the three channels
+    std::vector<f32> rgb_rows;
+};
+
+auto get_mask(Dither dither) -> const Mask* {
+    static Mask masks[3];
+    if (dither == Dither::None) {
+        return nullptr;
+    }
+    color_assert(int(dither) > 0 && int(dither) < 3,
+                 "unknown dither ({})", int(dither));
+
+    Mask& mask = masks[int(dither)];
+    std::call_once(mask.once, [&]() {
+        // offsets are the ranks spread evenly over (-0.5, 0.5)
+        mask.values.resize(k_mask_pixels);
+        if (dither == Dither::Ordered) {
+            for (size_t p = 0; p < k_mask_pixels; ++p) {
+                size_t rank = bayer_rank(p % k_dither_size, p / k_dither_size);
+                mask.values[p] = (f32(rank) + 0.5f) / 64.0f - 0.5f;
+            }
+        } else {
+            std::vector<size_t> rank = void_and_cluster();
+            for (size_t p = 0; p < k_mask_pixels; ++p) {
+                mask.values[p] =
+                    (f32(rank[p]) + 0.5f) / f32(k_mask_pixels) - 0.5f;
+            }
+        }
+
+        mask.rows.resize(k_dither_size * k_row_width);
+        mask.rgb_rows.resize(3 * mask.rows.size());
+        for (size_t y = 0; y < k_dither_size; ++y) {
+            for (size_t x = 0; x < k_row_width; ++x) {
+                const size_t i = y * k_row_width + x;
+                mask.rows[i] =
+                    mask.values[y * k_dither_size + x % k_dither_size];
+                for (size_t c = 0; c < 3; ++c) {
+                    mask.rgb_rows[3 * i + c] = mask.rows[i];
+                }
+            }
+        }
+    });
+    return &mask;
+}
+} // namespace
+
+auto dither_mask(Dither dither) -> const f32* {
+    const Mask* mask = get_mask(dither);
+    return mask ? mask->values.data() : nullptr;
+}
+
+namespace detail {
+auto dither_row(Dither dither, size_t x, size_t y) -> const f32* {
+    const Mask* mask = get_mask(dither);
+    if (!mask) {
+        return nullptr;
+    }
+    return &mask->rows[(y % k_dither_size) * k_row_width + x % k_dither_size];
+}
+
+auto dither_row_rgb(Dither dither, size_t x, size_t y) -> const f32* {
+    const Mask* mask = get_mask(dither);
+    if (!mask) {
+        return nullptr;
+    }
+    return &mask->rgb_rows[3 * ((y % k_dither_size) * k_row_width +
+                                x % k_dither_size)];
+}
+} // namespace detail
+
+void quantize(const f32* src, u8* dst, size_t n, const f32* dither) {
+    detail::kernels().quantize_u8(src, dst, n, dither);
+}
+
+void quantize(const f32* src, u16* dst, size_t n, const f32* dither) {
+    detail::kernels().quantize_u16(src, dst, n, dither);
+}
+
+void quantize(const RGBf32* src, RGBu8* dst, size_t n,
+              const TransferFunction& encode, Accuracy accuracy) {
+    quantize_rgb(src, dst, n, encode, accuracy);
+}
+
+void quantize(const RGBf32* src, RGBu16* dst, size_t n,
+              const TransferFunction& encode, Accuracy accuracy) {
+    quantize_rgb(src, dst, n, encode, accuracy);
+}
+
+void quantize(const RGBf32* src, RGBu8* dst, size_t width, size_t height,
+              Dither dither, const TransferFunction& encode,
+              Accuracy accuracy) {
+    quantize_image(src, dst, width, height, dither, encode, accuracy);
+}
+
+void quantize(const RGBf32* src, RGBu16* dst, size_t width, size_t height,
+              Dither dither, const TransferFunction& encode,
+              Accuracy accuracy) {
+    quantize_image(src, dst, width, height, dither, encode, accuracy);
+}
+
+} // namespace color
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "color/rgb.hpp"
+#include "color/transfer_function.hpp"
+
+#include <cstddef>
+
+namespace color {
+
+/**
+ * @brief Noise added to values as they are quantized, to break up banding
+ * @details Each pixel gets an offset in (-0.5, 0.5) LSB from a 64x64 mask
+ * tiled over the image, the same offset for all three channels so that
+ * neutral colours stay neutral. Values that land exactly on a code value
+ * are unaffected.
+ */
+enum class Dither : int {
+    None = 0,
+    /// 8x8 Bayer matrix. Cheap and regular, with a visible cross-hatch
+    Ordered,
+    /// Void-and-cluster blue noise. Unstructured, with its energy at high
+    /// frequencies where it is hardest to see
+    BlueNoise
+};
+
+/// Side of the square dither masks, in pixels
+constexpr size_t k_dither_size = 64;
+
+/**
+ * @brief The k_dither_size x k_dither_size offsets of dither, row-major
+ * @details Built on first use and shared. Null for Dither::None
+ */
+auto dither_mask(Dither dither) -> const f32*;
+
+/**
+ * @brief Quantize n channel values to 8-bit code values
+ * @details v becomes roundf(clamp(v, 0, 1) * 255), the same as rgb_cast(),
+ * with NaN becoming 0. If dither is non-null dither[i] is added to value i,
+ * in code values, before rounding. Values are rounded, clamped and packed
+ * a register at a time, see simd_level()
+ */
+void quantize(const f32* src, u8* dst, size_t n,
+              const f32* dither = nullptr);
+
+/// Quantize n channel values to 16-bit code values. See quantize()
+void quantize(const f32* src, u16* dst, size_t n,
+              const f32* dither = nullptr);
+
+/**
+ * @brief Encode n colours with encode and quantize them into dst
+ * @details The colours are encoded a tile at a time into a scratch buffer
+ * that stays in L1, so src is only read once and is left untouched.
+ * Colours are processed in parallel, see set_num_threads(). Accuracy::U8 is
+ * enough for 8-bit output, see TransferFunction::apply()
+ */
+void quantize(const RGBf32* src, RGBu8* dst, size_t n,
+              const TransferFunction& encode = TransferFunction(),
+              Accuracy accuracy = Accuracy::Exact);
+
+/// Encode n colours with encode and quantize them to 16 bits. See
+/// quantize()
+void quantize(const RGBf32* src, RGBu16* dst, size_t n,
+              const TransferFunction& encode = TransferFunction(),
+              Accuracy accuracy = Accuracy::Exact);
+
+/**
+ * @brief Encode and quantize a tightly packed width x height image,
+ * dithering as it is quantized
+ * @details The dither offsets are added inside the quantize loop, so cost
+ * no extra pass over the image. Rows are processed in parallel, see
+ * set_num_threads(). Dithering into other layouts and from other
+ * pipelines is done by Pipeline::apply()
+ */
+void quantize(const RGBf32* src, RGBu8* dst, size_t width, size_t height,
+              Dither dither,
+              const TransferFunction& encode = TransferFunction(),
+              Accuracy accuracy = Accuracy::Exact);
+
+/// Encode, dither and quantize an image to 16 bits. See quantize()
+void quantize(const RGBf32* src, RGBu16* dst, size_t width, size_t height,
+              Dither dither,
+              const TransferFunction& encode = TransferFunction(),
+              Accuracy accuracy = Accuracy::Exact);
+
+namespace detail {
+/// At least k_tile offsets of dither for row y, starting at column x, or
+/// null for Dither::None
+auto dither_row(Dither dither, size_t x, size_t y) -> const f32*;
+
+/// dither_row() with each offset repeated three times, for interleaved RGB
+auto dither_row_rgb(Dither dither, size_t x, size_t y) -> const f32*;
+} // namespace detail
+
+} // namespace color
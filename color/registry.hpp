@@ -0,0 +1,123 @@
+#pragma once
+
+#include "color/assert.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace color {
+namespace detail {
+
+/**
+ * @brief Named values added at run time, to extend the built-in tables
+ * @details Entries are only ever appended, and never move once added, so
+ * references to them stay valid for the life of the program. Adding takes a
+ * lock; looking up by index or name does not, and may run alongside adds on
+ * other threads.
+ */
+template <typename T> class Registry {
+public:
+    struct Entry {
+        template <typename... Args>
+        Entry(std::string name, Args&&... args)
+            : name(std::move(name)), value(std::forward<Args>(args)...) {}
+
+        const std::string name;
+        const T value;
+    };
+
+    Registry() = default;
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    ~Registry() {
+        const size_t n = _size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            size_t s, o;
+            locate(i, s, o);
+            delete _segments[s][o];
+        }
+        for (auto* segment : _segments) {
+            delete[] segment;
+        }
+    }
+
+    /// Add a value constructed from args under name, returning its index
+    template <typename... Args>
+    auto add(std::string name, Args&&... args) -> size_t {
+        auto* entry = new Entry(std::move(name), std::forward<Args>(args)...);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const size_t i = _size.load(std::memory_order_relaxed);
+        size_t s, o;
+        locate(i, s, o);
+        color_assert(s < k_max_segments, "registry is full");
+        if (o == 0) {
+            _segments[s] = new const Entry*[k_first << s];
+        }
+        _segments[s][o] = entry;
+        // publishes the entry, and its segment, to readers
+        _size.store(i + 1, std::memory_order_release);
+        return i;
+    }
+
+    auto size() const -> size_t {
+        return _size.load(std::memory_order_acquire);
+    }
+
+    auto operator[](size_t i) const -> const Entry& {
+        color_assert(i < size(), "no entry {} in registry of {}", i, size());
+        size_t s, o;
+        locate(i, s, o);
+        return *_segments[s][o];
+    }
+
+    /// Entry i, throwing std::out_of_range if there is none
+    auto at(size_t i) const -> const Entry& {
+        if (i >= size()) {
+            throw std::out_of_range(
+                fmt::format("no entry {} in registry of {}", i, size()));
+        }
+        return (*this)[i];
+    }
+
+    /// Set index to that of the first entry called name, returning false
+    /// if there is none
+    auto find(const std::string& name, size_t& index) const -> bool {
+        const size_t n = size();
+        for (size_t i = 0; i < n; ++i) {
+            if ((*this)[i].name == name) {
+                index = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    // segment s holds k_first << s entries, so that entries never have to
+    // be moved to make room for more
+    static constexpr size_t k_first = 16;
+    static constexpr size_t k_max_segments = 32;
+
+    static void locate(size_t i, size_t& segment, size_t& offset) {
+        segment = 0;
+        for (size_t n = i / k_first + 1; n > 1; n >>= 1) {
+            ++segment;
+        }
+        offset = i - k_first * ((size_t(1) << segment) - 1);
+    }
+
+    // written before the entries in them are published through _size, and
+    // never changed after
+    const Entry** _segments[k_max_segments] = {};
+    std::atomic<size_t> _size{0};
+    std::mutex _mutex;
+};
+
+} // namespace detail
+} // namespace color
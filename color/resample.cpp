@@ -0,0 +1,134 @@
+#include "color/resample.hpp"
+
+#include <algorithm>
+
+namespace color {
+
+namespace {
+// An output sample is w0 * v[index] + w1 * v[index + 1]
+struct Tap {
+    size_t index;
+    float w0;
+    float w1;
+};
+
+// tap for a wavelength lying a fraction t of the way from sample j to j + 1.
+// t is outside [0, 1] for wavelengths outside the source range
+inline auto make_tap(size_t j, float t, bool inside,
+                     Interpolation interpolation,
+                     Extrapolation extrapolation) -> Tap {
+    if (!inside) {
+        switch (extrapolation) {
+        case Extrapolation::Zero:
+            return Tap{j, 0.0f, 0.0f};
+        case Extrapolation::Linear:
+            return Tap{j, 1.0f - t, t};
+        case Extrapolation::Clamp:
+        default:
+            t = t < 0.0f ? 0.0f : 1.0f;
+            break;
+        }
+    }
+
+    if (interpolation == Interpolation::Nearest) {
+        t = t < 0.5f ? 0.0f : 1.0f;
+    }
+
+    return Tap{j, 1.0f - t, t};
+}
+
+/// Calls fn(i, tap) for each wavelength i of dst, in order
+template <typename F>
+void for_each_tap(const WavelengthGrid& src, const WavelengthGrid& dst,
+                  Interpolation interpolation, Extrapolation extrapolation,
+                  F&& fn) {
+    const size_t n = src.size;
+    color_assert(n > 1, "number of source wavelengths ({}) must be greater "
+                        "than 1",
+                 n);
+
+    if (src.is_uniform()) {
+        // direct index arithmetic
+        const float last = float(n - 1);
+        const float inv_step = 1.0f / src.step;
+        for (size_t i = 0; i < dst.size; ++i) {
+            float u = (dst[i] - src.start) * inv_step;
+            bool inside = u >= 0.0f && u <= last;
+            size_t j = u < 0.0f ? 0 : std::min(size_t(u), n - 2);
+            fn(i, make_tap(j, u - float(j), inside, interpolation,
+                           extrapolation));
+        }
+    } else {
+        // single merge walk over both grids
+        const float* w = src.wavelengths;
+        size_t j = 0;
+        for (size_t i = 0; i < dst.size; ++i) {
+            float x = dst[i];
+            if (x < w[j]) {
+                // dst is not monotonic, so find our place again from scratch
+                j = size_t(std::max(std::upper_bound(w, w + n, x) - w,
+                                    std::ptrdiff_t(1))) -
+                    1;
+            }
+
+            // advance until w[j] <= x <= w[j + 1]
+            while (j + 2 < n && w[j + 1] < x) {
+                ++j;
+            }
+
+            bool inside = x >= w[0] && x <= w[n - 1];
+            float t = (x - w[j]) / (w[j + 1] - w[j]);
+            fn(i, make_tap(j, t, inside, interpolation, extrapolation));
+        }
+    }
+}
+} // namespace
+
+void resample(const WavelengthGrid& src, const float* src_values,
+              const WavelengthGrid& dst, float* dst_values,
+              Extrapolation extrapolation) {
+    for_each_tap(src, dst, Interpolation::Linear, extrapolation,
+                 [&](size_t i, Tap tap) {
+                     dst_values[i] = tap.w0 * src_values[tap.index] +
+                                     tap.w1 * src_values[tap.index + 1];
+                 });
+}
+
+ResamplePlan::ResamplePlan(const WavelengthGrid& src,
+                           const WavelengthGrid& dst,
+                           Interpolation interpolation,
+                           Extrapolation extrapolation)
+    : _src_size(src.size), _index(dst.size), _w0(dst.size), _w1(dst.size) {
+    for_each_tap(src, dst, interpolation, extrapolation,
+                 [&](size_t i, Tap tap) {
+                     _index[i] = u32(tap.index);
+                     _w0[i] = tap.w0;
+                     _w1[i] = tap.w1;
+                 });
+}
+
+void ResamplePlan::apply(const float* src, float* dst) const {
+    const u32* __restrict index = _index.data();
+    const float* __restrict w0 = _w0.data();
+    const float* __restrict w1 = _w1.data();
+    const size_t n = _index.size();
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = w0[i] * src[index[i]] + w1[i] * src[index[i] + 1];
+    }
+}
+
+void ResamplePlan::apply(const float* src, size_t src_stride, float* dst,
+                         size_t dst_stride, size_t count) const {
+    color_assert(src_stride >= _src_size,
+                 "source stride ({}) is less than source size ({})",
+                 src_stride, _src_size);
+    color_assert(dst_stride >= dst_size(),
+                 "destination stride ({}) is less than destination size ({})",
+                 dst_stride, dst_size());
+
+    for (size_t s = 0; s < count; ++s) {
+        apply(src + s * src_stride, dst + s * dst_stride);
+    }
+}
+
+} // namespace color
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "color/assert.hpp"
+#include "color/math.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace color {
+
+/// Policy for wavelengths that fall outside the range of the source samples
+enum class Extrapolation : int {
+    /// Hold the first or last source value
+    Clamp = 0,
+    /// Treat the spectrum as zero outside its range
+    Zero,
+    /// Continue the slope of the first or last pair of source samples
+    Linear
+};
+
+/// Kernel used to reconstruct a spectrum between its samples
+enum class Interpolation : int {
+    /// Lerp between the two bracketing samples
+    Linear = 0,
+    /// Take the closest of the two bracketing samples
+    Nearest
+};
+
+/**
+ * @brief Non-owning description of where a spectrum is sampled
+ * @details A grid is either uniform (start + i * step) or an explicit array
+ * of strictly increasing wavelengths that must outlive the grid.
+ */
+struct WavelengthGrid {
+    float start;
+    // step size between samples. will be zero if non-uniform
+    float step;
+    size_t size;
+    // explicit wavelengths. will be null if uniform
+    const float* wavelengths;
+
+    WavelengthGrid(float start, float step, size_t size)
+        : start(start), step(step), size(size), wavelengths(nullptr) {
+        color_assert(step > 0.0f, "uniform grid step ({}) must be positive",
+                     step);
+    }
+
+    WavelengthGrid(const float* wavelengths, size_t size)
+        : start(wavelengths[0]), step(0.0f), size(size),
+          wavelengths(wavelengths) {}
+
+    /// Number of samples the range [start, end) holds at step
+    static size_t count(float start, float end, float step) {
+        size_t n = 0;
+        for (float l = start; l < end; l += step) {
+            ++n;
+        }
+        return n;
+    }
+
+    bool is_uniform() const { return wavelengths == nullptr; }
+
+    float operator[](size_t i) const {
+        return wavelengths ? wavelengths[i] : start + float(i) * step;
+    }
+
+    float front() const { return (*this)[0]; }
+    float back() const { return (*this)[size - 1]; }
+};
+
+/**
+ * @brief Linearly resample values sampled on src onto the wavelengths of dst
+ * @details Runs in O(N + M). A uniform source is indexed directly, otherwise
+ * a single merge walk is made over both grids. Wavelengths of dst outside
+ * [src.front(), src.back()] are handled according to extrapolation.
+ */
+void resample(const WavelengthGrid& src, const float* src_values,
+              const WavelengthGrid& dst, float* dst_values,
+              Extrapolation extrapolation = Extrapolation::Clamp);
+
+/**
+ * @brief Precomputed resampling from one wavelength grid to another
+ * @details Resampling is a sparse matrix with at most two non-zero weights
+ * per output sample. Building the plan does the bracketing search once, so
+ * that any number of spectra sharing the source grid can then be resampled
+ * with a single tight loop over the stored indices and weights.
+ */
+class ResamplePlan {
+public:
+    ResamplePlan(const WavelengthGrid& src, const WavelengthGrid& dst,
+                 Interpolation interpolation = Interpolation::Linear,
+                 Extrapolation extrapolation = Extrapolation::Clamp);
+
+    size_t src_size() const { return _src_size; }
+    size_t dst_size() const { return _index.size(); }
+
+    /// Resample src_size() values from src into dst_size() values in dst
+    void apply(const float* src, float* dst) const;
+
+    /**
+     * @brief Resample count spectra stored contiguously
+     * @details Spectrum s is read from src + s * src_stride and written to
+     * dst + s * dst_stride
+     */
+    void apply(const float* src, size_t src_stride, float* dst,
+               size_t dst_stride, size_t count) const;
+
+private:
+    size_t _src_size;
+    // output sample i is _w0[i] * src[_index[i]] + _w1[i] * src[_index[i] + 1]
+    std::vector<u32> _index;
+    std::vector<float> _w0;
+    std::vector<float> _w1;
+};
+
+} // namespace color
@@ -1,9 +1,11 @@
 #pragma once
 
+#include "color/assert.hpp"
 #include "color/math.hpp"
 
 #include <spdlog/fmt/ostr.h>
 
+#include <iomanip>
 #include <limits>
 
 namespace color {
@@ -100,8 +102,8 @@ template <typename T> struct RGBu {
 
     using channel_type = T;
 
-    RGBu(T v = 0.0f) : r(v), g(v), b(v) {}
-    RGBu(T r, T g, T b) : r(r), g(g), b(b) {}
+    constexpr RGBu(T v = 0.0f) : r(v), g(v), b(v) {}
+    constexpr RGBu(T r, T g, T b) : r(r), g(g), b(b) {}
 
     RGBu(const RGBu&) = default;
     RGBu& operator=(const RGBu&) = default;
@@ -0,0 +1,543 @@
+#pragma once
+
+#include "color/platform.hpp"
+#include "color/rgb.hpp"
+#include "color/types.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Vector lane types for the batch kernels, built on the GCC/Clang vector
+ * extensions. A value of N lanes is held as N / W vectors of the target's
+ * native width W, and every operation is applied to each of them in turn.
+ * Left to itself the compiler would split wide vectors up the same way for
+ * arithmetic, but falls back to one lane at a time for selects and
+ * conversions, and passing vectors wider than W by value changes the
+ * calling convention.
+ *
+ * The library builds its kernels for several instruction sets, see
+ * color/simd.hpp, so everything here lives in an inline namespace named
+ * after the one it is compiled for. That keeps the AVX-512 build of an
+ * inline function from being linked in place of the SSE2 one.
+ */
+#if defined(__AVX512F__)
+#define COLOR_SIMD_NS avx512
+#elif defined(__AVX2__)
+#define COLOR_SIMD_NS avx2
+#elif defined(__AVX__)
+#define COLOR_SIMD_NS avx
+#elif defined(__SSE2__)
+#define COLOR_SIMD_NS sse2
+#else
+#define COLOR_SIMD_NS generic
+#endif
+
+namespace color {
+
+namespace detail {
+inline namespace COLOR_SIMD_NS {
+#if defined(__AVX512F__)
+constexpr int k_native_lanes = 16;
+#elif defined(__AVX__)
+constexpr int k_native_lanes = 8;
+#else
+constexpr int k_native_lanes = 4;
+#endif
+
+template <int N> struct Lanes {
+    /// Lanes in each native vector
+    static constexpr int width = N < k_native_lanes ? N : k_native_lanes;
+    /// Native vectors making up N lanes
+    static constexpr int parts = N / width;
+    static_assert(parts * width == N, "lanes must fill whole vectors");
+
+    typedef f32 f32s __attribute__((vector_size(width * sizeof(f32))));
+    typedef i32 i32s __attribute__((vector_size(width * sizeof(i32))));
+    // for loads and stores through unaligned f32 pointers
+    typedef f32 f32u __attribute__((vector_size(width * sizeof(f32)),
+                                    aligned(alignof(f32)), may_alias));
+};
+
+// b < a ? b : a and a < b ? b : a on native vectors. The compiler only
+// spots that these are SSE and AVX min and max instructions some of the
+// time, so they are spelled out there. Like std::min and std::max they
+// return a if either is NaN
+template <typename V> inline auto min_lanes(V a, V b) -> V {
+    return b < a ? b : a;
+}
+template <typename V> inline auto max_lanes(V a, V b) -> V {
+    return a < b ? b : a;
+}
+#if defined(__SSE2__)
+inline auto min_lanes(Lanes<4>::f32s a, Lanes<4>::f32s b) -> Lanes<4>::f32s {
+    return _mm_min_ps(b, a);
+}
+inline auto max_lanes(Lanes<4>::f32s a, Lanes<4>::f32s b) -> Lanes<4>::f32s {
+    return _mm_max_ps(b, a);
+}
+#endif
+#if defined(__AVX__)
+inline auto min_lanes(Lanes<8>::f32s a, Lanes<8>::f32s b) -> Lanes<8>::f32s {
+    return _mm256_min_ps(b, a);
+}
+inline auto max_lanes(Lanes<8>::f32s a, Lanes<8>::f32s b) -> Lanes<8>::f32s {
+    return _mm256_max_ps(b, a);
+}
+#endif
+
+#if defined(__SSE2__)
+// n 32-bit lanes, a multiple of 16, packed to 8 bits with SSE2's saturating
+// packs. The compiler narrows vectors a lane at a time
+inline void pack(const __m128i* i, int n, u8* p) {
+    for (int k = 0; k < n / 4; k += 4) {
+        __m128i ab = _mm_packs_epi32(i[k], i[k + 1]);
+        __m128i cd = _mm_packs_epi32(i[k + 2], i[k + 3]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 4 * k),
+                         _mm_packus_epi16(ab, cd));
+    }
+}
+
+// n 32-bit lanes, a multiple of 8, packed to 16 bits. SSE2 has no unsigned
+// 32 to 16-bit pack, so [0, 65535] is shifted down to the signed range,
+// packed with signed saturation and the top bit flipped back
+inline void pack(const __m128i* i, int n, u16* p) {
+    const __m128i bias = _mm_set1_epi32(32768);
+    const __m128i top = _mm_set1_epi16(i16(0x8000));
+    for (int k = 0; k < n / 4; k += 2) {
+        __m128i a = _mm_sub_epi32(i[k], bias);
+        __m128i b = _mm_sub_epi32(i[k + 1], bias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 4 * k),
+                         _mm_xor_si128(_mm_packs_epi32(a, b), top));
+    }
+}
+#endif
+} // namespace COLOR_SIMD_NS
+} // namespace detail
+
+inline namespace COLOR_SIMD_NS {
+
+// operator op applied to each native vector of this and o, giving an R
+#define COLOR_LANES_OP(R, op)                                                  \
+    R operator op(const Self& o) const {                                       \
+        R r;                                                                   \
+        for (int j = 0; j < parts; ++j) {                                      \
+            r.v[j] = v[j] op o.v[j];                                           \
+        }                                                                      \
+        return r;                                                              \
+    }
+
+/**
+ * @brief N i32 values operated on together
+ * @details Also the result of comparing f32x, with every bit of a lane set
+ * where the comparison holds, as a mask for select(), all() and any()
+ */
+template <int N> struct i32x {
+    using Self = i32x;
+    using vector = typename detail::Lanes<N>::i32s;
+    static constexpr int size = N;
+    static constexpr int parts = detail::Lanes<N>::parts;
+
+    vector v[parts];
+
+    i32x() = default;
+    i32x(i32 s) {
+        for (int j = 0; j < parts; ++j) {
+            v[j] = vector{} + s;
+        }
+    }
+
+    i32 operator[](int i) const {
+        return v[i / detail::Lanes<N>::width][i % detail::Lanes<N>::width];
+    }
+
+    COLOR_LANES_OP(i32x, +)
+    COLOR_LANES_OP(i32x, -)
+    COLOR_LANES_OP(i32x, &)
+    COLOR_LANES_OP(i32x, |)
+    COLOR_LANES_OP(i32x, ==)
+    COLOR_LANES_OP(i32x, !=)
+
+    i32x& operator+=(const i32x& o) { return *this = *this + o; }
+    i32x& operator-=(const i32x& o) { return *this = *this - o; }
+
+    i32x operator<<(int s) const {
+        i32x r;
+        for (int j = 0; j < parts; ++j) {
+            r.v[j] = v[j] << s;
+        }
+        return r;
+    }
+
+    /// Arithmetic shift right
+    i32x operator>>(int s) const {
+        i32x r;
+        for (int j = 0; j < parts; ++j) {
+            r.v[j] = v[j] >> s;
+        }
+        return r;
+    }
+};
+
+/// N f32 values operated on together
+template <int N> struct f32x {
+    using Self = f32x;
+    using vector = typename detail::Lanes<N>::f32s;
+    static constexpr int size = N;
+    static constexpr int parts = detail::Lanes<N>::parts;
+
+    vector v[parts];
+
+    f32x() = default;
+    f32x(f32 s) {
+        for (int j = 0; j < parts; ++j) {
+            v[j] = vector{} + s;
+        }
+    }
+
+    /// N values from p, which needn't be aligned
+    static auto load(const f32* p) -> f32x {
+        using unaligned = typename detail::Lanes<N>::f32u;
+        f32x x;
+        for (int j = 0; j < parts; ++j) {
+            x.v[j] = reinterpret_cast<const unaligned*>(p)[j];
+        }
+        return x;
+    }
+
+    /// n < N values from p, with the remaining lanes zero
+    static auto load(const f32* p, size_t n) -> f32x {
+        f32x x(0.0f);
+        memcpy(x.v, p, n * sizeof(f32));
+        return x;
+    }
+
+    void store(f32* p) const {
+        using unaligned = typename detail::Lanes<N>::f32u;
+        for (int j = 0; j < parts; ++j) {
+            reinterpret_cast<unaligned*>(p)[j] = v[j];
+        }
+    }
+
+    /// Store the first n < N values to p
+    void store(f32* p, size_t n) const { memcpy(p, v, n * sizeof(f32)); }
+
+    f32 operator[](int i) const {
+        return v[i / detail::Lanes<N>::width][i % detail::Lanes<N>::width];
+    }
+
+    f32x operator-() const { return f32x(0.0f) - *this; }
+    COLOR_LANES_OP(f32x, +)
+    COLOR_LANES_OP(f32x, -)
+    COLOR_LANES_OP(f32x, *)
+    COLOR_LANES_OP(f32x, /)
+    f32x& operator+=(const f32x& o) { return *this = *this + o; }
+    f32x& operator-=(const f32x& o) { return *this = *this - o; }
+    f32x& operator*=(const f32x& o) { return *this = *this * o; }
+    f32x& operator/=(const f32x& o) { return *this = *this / o; }
+
+    COLOR_LANES_OP(i32x<N>, <)
+    COLOR_LANES_OP(i32x<N>, <=)
+    COLOR_LANES_OP(i32x<N>, >)
+    COLOR_LANES_OP(i32x<N>, >=)
+    COLOR_LANES_OP(i32x<N>, ==)
+
+    /// The bits of each lane
+    auto bits() const -> i32x<N> {
+        i32x<N> i;
+        for (int j = 0; j < parts; ++j) {
+            i.v[j] = typename i32x<N>::vector(v[j]);
+        }
+        return i;
+    }
+
+    /// Lanes with the given bits
+    static auto from_bits(const i32x<N>& i) -> f32x {
+        f32x x;
+        for (int j = 0; j < parts; ++j) {
+            x.v[j] = vector(i.v[j]);
+        }
+        return x;
+    }
+
+    /// Each integer lane as a float
+    static auto from_ints(const i32x<N>& i) -> f32x {
+        f32x x;
+        for (int j = 0; j < parts; ++j) {
+            x.v[j] = __builtin_convertvector(i.v[j], vector);
+        }
+        return x;
+    }
+};
+
+#undef COLOR_LANES_OP
+
+template <int N>
+inline auto operator+(f32 s, const f32x<N>& x) -> f32x<N> {
+    return f32x<N>(s) + x;
+}
+template <int N>
+inline auto operator-(f32 s, const f32x<N>& x) -> f32x<N> {
+    return f32x<N>(s) - x;
+}
+template <int N>
+inline auto operator*(f32 s, const f32x<N>& x) -> f32x<N> {
+    return f32x<N>(s) * x;
+}
+
+/// m ? a : b, lane-wise
+template <int N>
+inline auto select(const i32x<N>& m, const f32x<N>& a, const f32x<N>& b)
+    -> f32x<N> {
+    f32x<N> r;
+    for (int j = 0; j < f32x<N>::parts; ++j) {
+        r.v[j] = m.v[j] ? a.v[j] : b.v[j];
+    }
+    return r;
+}
+
+/// True if every lane of m is set
+template <int N> inline auto all(const i32x<N>& m) -> bool {
+    for (int i = 0; i < N; ++i) {
+        if (!m[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// True if any lane of m is set
+template <int N> inline auto any(const i32x<N>& m) -> bool {
+    for (int i = 0; i < N; ++i) {
+        if (m[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Each lane truncated towards zero to an integer, as in i32(f)
+template <int N> inline auto truncate(const f32x<N>& x) -> i32x<N> {
+    i32x<N> i;
+    for (int j = 0; j < f32x<N>::parts; ++j) {
+        i.v[j] = __builtin_convertvector(x.v[j], typename i32x<N>::vector);
+    }
+    return i;
+}
+
+/// Store the lanes of i to p as u8 or u16. Every lane must fit in T
+template <typename T, int N> inline void store_as(const i32x<N>& i, T* p) {
+#if defined(__SSE2__)
+    if (N % 16 == 0) {
+        __m128i q[N / 4];
+        memcpy(q, i.v, sizeof(q));
+        detail::pack(q, N, p);
+        return;
+    }
+#endif
+    for (int k = 0; k < N; ++k) {
+        p[k] = T(i[k]);
+    }
+}
+
+/// std::min lane-wise: b if b < a, otherwise a
+template <int N>
+inline auto min(const f32x<N>& a, const f32x<N>& b) -> f32x<N> {
+    f32x<N> r;
+    for (int j = 0; j < f32x<N>::parts; ++j) {
+        r.v[j] = detail::min_lanes(a.v[j], b.v[j]);
+    }
+    return r;
+}
+
+/// std::max lane-wise: b if a < b, otherwise a
+template <int N>
+inline auto max(const f32x<N>& a, const f32x<N>& b) -> f32x<N> {
+    f32x<N> r;
+    for (int j = 0; j < f32x<N>::parts; ++j) {
+        r.v[j] = detail::max_lanes(a.v[j], b.v[j]);
+    }
+    return r;
+}
+
+/// color::clamp() lane-wise, so NaN becomes a
+template <int N>
+inline auto clamp(const f32x<N>& x, const f32x<N>& a, const f32x<N>& b)
+    -> f32x<N> {
+    return max(a, min(x, b));
+}
+
+template <int N>
+inline auto lerp(const f32x<N>& a, const f32x<N>& b, const f32x<N>& t)
+    -> f32x<N> {
+    return (1.0f - t) * a + t * b;
+}
+
+/// powf lane-wise. See fast::pow() for a vectorized approximation
+template <int N> inline auto pow(const f32x<N>& x, f32 e) -> f32x<N> {
+    f32 r[N];
+    for (int i = 0; i < N; ++i) {
+        r[i] = powf(x[i], e);
+    }
+    return f32x<N>::load(r);
+}
+
+/// Sum of the lanes, added in lane order
+template <int N> inline auto hsum(const f32x<N>& x) -> f32 {
+    f32 sum = 0.0f;
+    for (int i = 0; i < N; ++i) {
+        sum += x[i];
+    }
+    return sum;
+}
+
+/// Lanes that are neither infinite nor NaN
+template <int N> inline auto is_real(const f32x<N>& x) -> i32x<N> {
+    const i32 exponent = 0x7f800000;
+    return (x.bits() & exponent) != exponent;
+}
+
+/**
+ * @brief N colours held as one f32x per channel
+ * @details The SoA counterpart of RGBf32, with the same arithmetic and
+ * helpers applied to all N colours at once
+ */
+template <int N> struct RGBx {
+    f32x<N> r;
+    f32x<N> g;
+    f32x<N> b;
+
+    static constexpr int size = N;
+
+    RGBx() = default;
+    RGBx(f32 v) : r(v), g(v), b(v) {}
+    RGBx(const f32x<N>& r, const f32x<N>& g, const f32x<N>& b)
+        : r(r), g(g), b(b) {}
+    /// c in every lane
+    RGBx(const RGBf32& c) : r(c.r), g(c.g), b(c.b) {}
+
+    /// Deinterleave N colours from rgb
+    static auto load(const RGBf32* rgb) -> RGBx { return load(rgb, N); }
+
+    /// Deinterleave n <= N colours from rgb, with the remaining lanes zero
+    static auto load(const RGBf32* rgb, size_t n) -> RGBx {
+        f32 c[3][N] = {};
+        for (size_t i = 0; i < n; ++i) {
+            c[0][i] = rgb[i].r;
+            c[1][i] = rgb[i].g;
+            c[2][i] = rgb[i].b;
+        }
+        return load(c[0], c[1], c[2]);
+    }
+
+    /// N colours from three planes
+    static auto load(const f32* r, const f32* g, const f32* b) -> RGBx {
+        return RGBx(f32x<N>::load(r), f32x<N>::load(g), f32x<N>::load(b));
+    }
+
+    /// Interleave the N colours into rgb
+    void store(RGBf32* rgb) const { store(rgb, N); }
+
+    /// Interleave the first n <= N colours into rgb
+    void store(RGBf32* rgb, size_t n) const {
+        f32 c[3][N];
+        store(c[0], c[1], c[2]);
+        for (size_t i = 0; i < n; ++i) {
+            rgb[i].r = c[0][i];
+            rgb[i].g = c[1][i];
+            rgb[i].b = c[2][i];
+        }
+    }
+
+    /// Store the N colours to three planes
+    void store(f32* r_, f32* g_, f32* b_) const {
+        r.store(r_);
+        g.store(g_);
+        b.store(b_);
+    }
+
+    /// Colour i
+    RGBf32 operator[](int i) const { return RGBf32(r[i], g[i], b[i]); }
+
+    RGBx operator+(const RGBx& o) const {
+        return RGBx(r + o.r, g + o.g, b + o.b);
+    }
+    RGBx operator-(const RGBx& o) const {
+        return RGBx(r - o.r, g - o.g, b - o.b);
+    }
+    RGBx operator*(const RGBx& o) const {
+        return RGBx(r * o.r, g * o.g, b * o.b);
+    }
+    RGBx operator/(const RGBx& o) const {
+        return RGBx(r / o.r, g / o.g, b / o.b);
+    }
+    RGBx& operator+=(const RGBx& o) { return *this = *this + o; }
+    RGBx& operator-=(const RGBx& o) { return *this = *this - o; }
+    RGBx& operator*=(const RGBx& o) { return *this = *this * o; }
+    RGBx& operator/=(const RGBx& o) { return *this = *this / o; }
+
+    /// Every channel of each colour times that colour's lane of s
+    RGBx operator*(const f32x<N>& s) const {
+        return RGBx(r * s, g * s, b * s);
+    }
+};
+
+using RGBx4 = RGBx<4>;
+using RGBx8 = RGBx<8>;
+using RGBx16 = RGBx<16>;
+
+template <int N>
+inline auto operator*(f32 f, const RGBx<N>& c) -> RGBx<N> {
+    return c * RGBx<N>(f);
+}
+
+/// m * c for each colour
+template <int N>
+inline auto transform(const M33f& m, const RGBx<N>& c) -> RGBx<N> {
+    return RGBx<N>(m[0][0] * c.r + m[0][1] * c.g + m[0][2] * c.b,
+                   m[1][0] * c.r + m[1][1] * c.g + m[1][2] * c.b,
+                   m[2][0] * c.r + m[2][1] * c.g + m[2][2] * c.b);
+}
+
+template <int N> inline auto pow(const RGBx<N>& c, f32 e) -> RGBx<N> {
+    return RGBx<N>(pow(c.r, e), pow(c.g, e), pow(c.b, e));
+}
+
+template <int N>
+inline auto clamp(const RGBx<N>& c, const RGBx<N>& mn, const RGBx<N>& mx)
+    -> RGBx<N> {
+    return RGBx<N>(clamp(c.r, mn.r, mx.r), clamp(c.g, mn.g, mx.g),
+                   clamp(c.b, mn.b, mx.b));
+}
+
+template <int N>
+inline auto lerp(const RGBx<N>& a, const RGBx<N>& b, f32 t) -> RGBx<N> {
+    return (1.0f - t) * a + t * b;
+}
+
+template <int N> inline auto max(const RGBx<N>& c, f32 f) -> RGBx<N> {
+    return RGBx<N>(max(c.r, f32x<N>(f)), max(c.g, f32x<N>(f)),
+                   max(c.b, f32x<N>(f)));
+}
+
+/// Smallest channel of each colour
+template <int N> inline auto hmin(const RGBx<N>& c) -> f32x<N> {
+    return min(c.r, min(c.g, c.b));
+}
+
+/// Largest channel of each colour
+template <int N> inline auto hmax(const RGBx<N>& c) -> f32x<N> {
+    return max(c.r, max(c.g, c.b));
+}
+
+/// Colours with no infinite or NaN channel
+template <int N> inline auto is_real(const RGBx<N>& c) -> i32x<N> {
+    return is_real(c.r) & is_real(c.g) & is_real(c.b);
+}
+
+} // namespace COLOR_SIMD_NS
+} // namespace color
@@ -0,0 +1,124 @@
+#include "color/simd.hpp"
+#include "color/assert.hpp"
+#include "color/kernels.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace color {
+
+namespace {
+const SimdLevel k_levels[] = {SimdLevel::SSE2, SimdLevel::AVX2,
+                              SimdLevel::AVX512};
+
+std::atomic<int> g_level{-1};
+
+auto cpu_supports(SimdLevel level) -> bool {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    switch (level) {
+    case SimdLevel::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case SimdLevel::AVX512:
+        return __builtin_cpu_supports("avx512f");
+    default:
+        return true;
+    }
+#else
+    return level == SimdLevel::SSE2;
+#endif
+}
+
+auto built_with(SimdLevel level) -> bool {
+    switch (level) {
+    case SimdLevel::SSE2:
+        return true;
+    case SimdLevel::AVX2:
+#if defined(COLOR_HAVE_AVX2)
+        return true;
+#else
+        return false;
+#endif
+    case SimdLevel::AVX512:
+#if defined(COLOR_HAVE_AVX512)
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+// the best supported level, capped by COLOR_SIMD_LEVEL
+auto default_level() -> SimdLevel {
+    SimdLevel cap = SimdLevel::AVX512;
+    if (const char* env = std::getenv("COLOR_SIMD_LEVEL")) {
+        for (SimdLevel l : k_levels) {
+            if (strcmp(env, to_string(l)) == 0) {
+                cap = l;
+            }
+        }
+    }
+    SimdLevel level = SimdLevel::SSE2;
+    for (SimdLevel l : k_levels) {
+        if (l <= cap && simd_supported(l)) {
+            level = l;
+        }
+    }
+    return level;
+}
+} // namespace
+
+auto simd_supported(SimdLevel level) -> bool {
+    return built_with(level) && cpu_supports(level);
+}
+
+auto simd_level() -> SimdLevel {
+    int level = g_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        // racing first calls all come to the same answer
+        level = int(default_level());
+        g_level.store(level, std::memory_order_relaxed);
+    }
+    return SimdLevel(level);
+}
+
+void set_simd_level(SimdLevel level) {
+    color_assert(simd_supported(level), "simd level {} is not supported",
+                 to_string(level));
+    g_level.store(int(level), std::memory_order_relaxed);
+}
+
+auto to_string(SimdLevel level) -> const char* {
+    switch (level) {
+    case SimdLevel::SSE2:
+        return "sse2";
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::AVX512:
+        return "avx512";
+    default:
+        return "unknown";
+    }
+}
+
+namespace detail {
+auto kernels() -> const Kernels& {
+    switch (simd_level()) {
+#if defined(COLOR_HAVE_AVX512)
+    case SimdLevel::AVX512:
+        return kernels_avx512();
+#endif
+#if defined(COLOR_HAVE_AVX2)
+    case SimdLevel::AVX2:
+        return kernels_avx2();
+#endif
+    default:
+        return kernels_sse2();
+    }
+}
+} // namespace detail
+
+} // namespace color
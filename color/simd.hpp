@@ -0,0 +1,39 @@
+#pragma once
+
+namespace color {
+
+/**
+ * @brief Instruction sets the batch kernels are built for
+ * @details The library is compiled for its baseline target, with the
+ * kernels behind the batch functions (transfer function approximations,
+ * quantize(), pipelines, colour space conversions and spectral
+ * integration) also built for each level here. The best level the CPU
+ * supports is picked on first use, so one binary runs at full width on
+ * every machine. Every level gives bit-identical results.
+ *
+ * Setting the environment variable COLOR_SIMD_LEVEL to sse2, avx2 or
+ * avx512 caps the level, for benchmarking and testing. Levels the CPU
+ * doesn't support are never used.
+ */
+enum class SimdLevel : int {
+    /// The baseline build, which is SSE2 on x86-64
+    SSE2 = 0,
+    AVX2,
+    /// AVX-512F
+    AVX512
+};
+
+/// True if the library was built with level and the CPU supports it
+auto simd_supported(SimdLevel level) -> bool;
+
+/// The level batch functions run at
+auto simd_level() -> SimdLevel;
+
+/// Run batch functions at level, which must be supported. Not safe to call
+/// while batch functions are running on other threads
+void set_simd_level(SimdLevel level);
+
+/// "sse2", "avx2" or "avx512", as taken by COLOR_SIMD_LEVEL
+auto to_string(SimdLevel level) -> const char*;
+
+} // namespace color
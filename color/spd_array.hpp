@@ -0,0 +1,136 @@
+#pragma once
+
+#include "color/aligned.hpp"
+#include "color/spectral_power_distribution.hpp"
+
+namespace color {
+
+/**
+ * @brief Many spectra sampled on one shared wavelength grid
+ * @details Values are held as a single aligned spectra x wavelengths matrix.
+ * Each spectrum is a row starting on a simd_alignment boundary, so
+ * consecutive spectra are stride() floats apart. The grid is stored once for
+ * the whole array rather than once per spectrum as with SPD.
+ */
+class SPDArray {
+public:
+    /// count spectra sampled uniformly over [start, end) at step
+    SPDArray(size_t count, float start, float end, float step,
+             float v = 0.0f)
+        : _start(start), _step(step) {
+        color_assert(end >= start + step, "end of range is less than step");
+        _allocate(count, WavelengthGrid::count(start, end, step), v);
+    }
+
+    /// count spectra sampled at the given wavelengths
+    SPDArray(size_t count, std::vector<float> wavelengths, float v = 0.0f)
+        : _start(_first(wavelengths)), _step(0.0f),
+          _wavelengths(std::move(wavelengths)) {
+        _allocate(count, _wavelengths.size(), v);
+    }
+
+    /// count spectra sampled on the same grid as spd
+    SPDArray(size_t count, const SPD& spd, float v = 0.0f)
+        : SPDArray(count, spd.grid(), v) {}
+
+    SPDArray(size_t count, const WavelengthGrid& grid, float v = 0.0f)
+        : _start(grid.start), _step(grid.step) {
+        if (!grid.is_uniform()) {
+            _wavelengths.assign(grid.wavelengths, grid.wavelengths + grid.size);
+        }
+        _allocate(count, grid.size, v);
+    }
+
+    /// Number of spectra
+    size_t size() const { return _count; }
+    /// Number of wavelength samples in each spectrum
+    size_t num_samples() const { return _num_samples; }
+    /// Distance in floats between the starts of consecutive spectra
+    size_t stride() const { return _stride; }
+
+    bool is_uniform() const { return _wavelengths.empty(); }
+
+    WavelengthGrid grid() const {
+        if (is_uniform()) {
+            return WavelengthGrid(_start, _step, _num_samples);
+        } else {
+            return WavelengthGrid(_wavelengths.data(), _wavelengths.size());
+        }
+    }
+
+    /// Samples of spectrum i
+    float* operator[](size_t i) {
+        color_assert(i < _count, "spectrum index {} out of range ({})", i,
+                     _count);
+        return _values.data() + i * _stride;
+    }
+
+    const float* operator[](size_t i) const {
+        color_assert(i < _count, "spectrum index {} out of range ({})", i,
+                     _count);
+        return _values.data() + i * _stride;
+    }
+
+    /// Start of the value matrix
+    float* data() { return _values.data(); }
+    const float* data() const { return _values.data(); }
+
+    /// View of spectrum i that can be used wherever an SPDView is accepted
+    SPDView view(size_t i) const { return SPDView(grid(), (*this)[i]); }
+
+    /// Copy spectrum i out into its own SPD
+    auto to_spd(size_t i) const -> SPD { return SPD(view(i)); }
+
+    /// Resample spd onto the shared grid and store it as spectrum i
+    void set(size_t i, const SPD& spd,
+             Extrapolation extrapolation = Extrapolation::Clamp) {
+        resample(spd.grid(), spd.data(), grid(), (*this)[i], extrapolation);
+    }
+
+    /**
+     * @brief Resample count spectra sharing a grid into spectra
+     * [first, first + count)
+     * @details plan must map from the grid of src onto grid(). Source
+     * spectrum s is read from src + s * src_stride
+     */
+    void set(size_t first, size_t count, const float* src, size_t src_stride,
+             const ResamplePlan& plan) {
+        color_assert(plan.dst_size() == _num_samples,
+                     "plan resamples onto {} wavelengths, array has {}",
+                     plan.dst_size(), _num_samples);
+        color_assert(first + count <= _count,
+                     "spectra [{}, {}) out of range ({})", first,
+                     first + count, _count);
+        plan.apply(src, src_stride, (*this)[first], _stride, count);
+    }
+
+private:
+    // checked before the wavelengths are read, so that an empty vector
+    // fails the assertion rather than being indexed
+    static float _first(const std::vector<float>& wavelengths) {
+        color_assert(wavelengths.size() > 1,
+                     "number of wavelengths must be greater than 1");
+        return wavelengths.empty() ? 0.0f : wavelengths[0];
+    }
+
+    void _allocate(size_t count, size_t num_samples, float v) {
+        const size_t lanes = simd_alignment / sizeof(float);
+        _count = count;
+        _num_samples = num_samples;
+        _stride = (num_samples + lanes - 1) / lanes * lanes;
+        _values.assign(_count * _stride, v);
+    }
+
+    // grid shared by all spectra. _wavelengths is only stored if the grid
+    // is non-uniform, in which case _step is zero
+    float _start;
+    float _step;
+    std::vector<float> _wavelengths;
+
+    size_t _count;
+    size_t _num_samples;
+    size_t _stride;
+    AlignedVector<float> _values;
+};
+
+} // namespace color
@@ -1,62 +1,44 @@
 #include "color/spd_conversion.hpp"
+#include "color/parallel.hpp"
+#include "color/spectral_response.hpp"
 
 namespace color {
-auto spd_to_xyz(const SPD& spd, const CMF& cmf, const SPD& illuminant) -> XYZ {
-    // limit our calculation to the smallest range
-    auto lambda_start =
-        std::max(spd.start(), std::max(cmf.x_bar.start(), illuminant.start()));
-    auto lambda_end =
-        std::min(spd.end(), std::min(cmf.x_bar.end(), illuminant.end()));
-
-    size_t idx_start = 0;
-    while (spd._wavelengths[idx_start] < lambda_start) {
-        idx_start++;
-    }
 
-    size_t idx_end = 0;
-    while (spd._wavelengths[idx_end] < lambda_end &&
-           idx_end < spd._wavelengths.size()) {
-        idx_end++;
-    }
+namespace {
+// spectra converted per task by the batch functions, each reading a
+// spectrum and writing a colour
+auto batch_grain(const SPDArray& spectra) -> size_t {
+    return detail::chunk_grain((spectra.stride() + 3) * sizeof(float));
+}
 
-    XYZ xyz(0.0f);
-    float N = 0.0f;
-    for (size_t i = idx_start; i < idx_end; ++i) {
-        float l = spd._wavelengths[i];
-        float Me = spd._values[i] * illuminant.value(l);
-        xyz.x += Me * cmf.x_bar.value(l);
-        xyz.y += Me * cmf.y_bar.value(l);
-        xyz.z += Me * cmf.z_bar.value(l);
-        N += cmf.y_bar.value(l) * illuminant.value(l);
-    }
+// apply response to all of spectra, writing three floats per spectrum to out
+void apply_batch(const SpectralResponse& response, const SPDArray& spectra,
+                 float* out) {
+    const size_t grain = batch_grain(spectra);
+    parallel_for(spectra.size(), grain, [&](size_t begin, size_t end) {
+        response.apply(spectra[begin], spectra.stride(), end - begin,
+                       out + 3 * begin);
+    });
+}
+} // namespace
 
-    return xyz / N;
+auto spd_to_xyz(const SPD& spd, const CMF& cmf, const SPD& illuminant) -> XYZ {
+    return spd_to_xyz(spd.view(), cmf, illuminant);
 }
 
 auto spd_to_xyz(const SPD& spd, const CMF& cmf) -> XYZ {
-    // limit our calculation to the smallest range
-    auto lambda_start = std::max(spd.start(), cmf.x_bar.start());
-    auto lambda_end = std::min(spd.end(), cmf.x_bar.end());
-
-    size_t idx_start = 0;
-    while (spd._wavelengths[idx_start] < lambda_start) {
-        idx_start++;
-    }
-
-    size_t idx_end = 0;
-    while (spd._wavelengths[idx_end] < lambda_end &&
-           idx_end < spd._wavelengths.size()) {
-        idx_end++;
-    }
+    return spd_to_xyz(spd.view(), cmf);
+}
 
-    XYZ xyz(0.0f);
-    for (size_t i = idx_start; i < idx_end; ++i) {
-        xyz.x += spd._values[i] * cmf.x_bar.value(spd._wavelengths[i]);
-        xyz.y += spd._values[i] * cmf.y_bar.value(spd._wavelengths[i]);
-        xyz.z += spd._values[i] * cmf.z_bar.value(spd._wavelengths[i]);
-    }
+auto spd_to_xyz(const SPDView& spd, const CMF& cmf, const SPD& illuminant)
+    -> XYZ {
+    // the CMF and illuminant are resampled onto the spd's grid once and
+    // cached, leaving a single pass over the spd's values
+    return xyz_response(spd.grid, cmf, illuminant)->apply(spd.values);
+}
 
-    return xyz;
+auto spd_to_xyz(const SPDView& spd, const CMF& cmf) -> XYZ {
+    return xyz_response(spd.grid, cmf)->apply(spd.values);
 }
 
 auto spd_to_xyz(float wavelength, float value, const CMF& cmf) -> XYZ {
@@ -77,8 +59,44 @@ auto spd_to_xyz(float wavelength, float value, const CMF& cmf,
 }
 
 auto spd_to_rgb(const SPD& spd, const ColorSpaceRGB& cs) -> RGBf32 {
-    auto xyz =
-        spd_to_xyz(spd, cs.cmf, Illuminant::get(cs.white_point.illuminant));
-    return xyz_to_rgb(xyz, cs);
+    return spd_to_rgb(spd.view(), cs);
+}
+
+auto spd_to_rgb(const SPDView& spd, const ColorSpaceRGB& cs) -> RGBf32 {
+    // integration, normalisation and the xyz -> rgb matrix are all folded
+    // into one cached response for cs on the spd's grid
+    auto rgb = rgb_response(spd.grid, cs)->apply(spd.values);
+    return cs.oetf(RGBf32(rgb.x, rgb.y, rgb.z));
+}
+
+void spd_to_xyz(const SPDArray& spectra, const CMF& cmf,
+                const SPD& illuminant, XYZ* xyz) {
+    if (spectra.size() == 0) {
+        return;
+    }
+    auto response = xyz_response(spectra.grid(), cmf, illuminant);
+    apply_batch(*response, spectra, &xyz[0].x);
+}
+
+void spd_to_xyz(const SPDArray& spectra, const CMF& cmf, XYZ* xyz) {
+    if (spectra.size() == 0) {
+        return;
+    }
+    auto response = xyz_response(spectra.grid(), cmf);
+    apply_batch(*response, spectra, &xyz[0].x);
+}
+
+void spd_to_rgb(const SPDArray& spectra, const ColorSpaceRGB& cs,
+                RGBf32* rgb) {
+    if (spectra.size() == 0) {
+        return;
+    }
+    auto response = rgb_response(spectra.grid(), cs);
+    const size_t grain = batch_grain(spectra);
+    parallel_for(spectra.size(), grain, [&](size_t begin, size_t end) {
+        response->apply(spectra[begin], spectra.stride(), end - begin,
+                        &rgb[begin].r);
+        cs.oetf.apply(rgb + begin, end - begin);
+    });
 }
 }
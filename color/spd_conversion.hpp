@@ -1,6 +1,7 @@
 #pragma once
 
 #include "color/spectral_power_distribution.hpp"
+#include "color/spd_array.hpp"
 #include "color/cmf.hpp"
 #include "color/rgb.hpp"
 #include "color/color_space_rgb.hpp"
@@ -9,7 +10,22 @@ namespace color {
 
 auto spd_to_xyz(const SPD& spd, const CMF& cmf, const SPD& illuminant) -> XYZ;
 auto spd_to_xyz(const SPD& spd, const CMF& cmf) -> XYZ;
+auto spd_to_xyz(const SPDView& spd, const CMF& cmf, const SPD& illuminant)
+    -> XYZ;
+auto spd_to_xyz(const SPDView& spd, const CMF& cmf) -> XYZ;
 auto spd_to_xyz(float wavelength, float value, const CMF& cmf) -> XYZ;
 auto spd_to_rgb(const SPD& spd, const ColorSpaceRGB& cs) -> RGBf32;
+auto spd_to_rgb(const SPDView& spd, const ColorSpaceRGB& cs) -> RGBf32;
+
+/**
+ * @brief Convert every spectrum in spectra, writing spectra.size() results
+ * @details Spectra are split into chunks that are converted in parallel, see
+ * set_num_threads()
+ */
+void spd_to_xyz(const SPDArray& spectra, const CMF& cmf,
+                const SPD& illuminant, XYZ* xyz);
+void spd_to_xyz(const SPDArray& spectra, const CMF& cmf, XYZ* xyz);
+void spd_to_rgb(const SPDArray& spectra, const ColorSpaceRGB& cs,
+                RGBf32* rgb);
 
 }
@@ -2,75 +2,147 @@
 
 #include "color/assert.hpp"
 #include "color/math.hpp"
+#include "color/resample.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <vector>
 
 namespace color {
 
-class CMF;
+namespace detail {
+/// Selects SPD's constructor for the library's built-in tables
+struct StaticSamples {};
+constexpr StaticSamples static_samples{};
+} // namespace detail
+
+/**
+ * @brief Non-owning view of spectral samples on a wavelength grid
+ * @details Lets spectra stored elsewhere, e.g. in an SPDArray, be passed to
+ * anything that works on an SPD's samples without copying them
+ */
+struct SPDView {
+    WavelengthGrid grid;
+    const float* values;
+
+    SPDView(WavelengthGrid grid, const float* values)
+        : grid(grid), values(values) {}
+
+    size_t num_samples() const { return grid.size; }
+    float wavelength(size_t i) const { return grid[i]; }
+};
 
+/**
+ * @brief A spectrum sampled at increasing wavelengths
+ * @details Samples are either owned by the SPD or, for tabulated spectra
+ * such as the colour matching functions and illuminants, held in static
+ * storage that the SPD refers to. Those SPDs are constant-initialized, so
+ * cost nothing at load and can be used from any static initializer, and
+ * copying them copies only the reference. Modifying a copy gives it its
+ * own samples first.
+ */
 class SPD {
 public:
     explicit SPD(float start, float end, float step,
                                        float v = 0.0f)
-        : _step(step) {
+        : _start(start), _step(step) {
         color_assert(end >= start + step, "end of range is less than step");
 
-        for (float l = start; l < end; l += step) {
-            _wavelengths.push_back(l);
-            _values.push_back(v);
-        }
+        float* values =
+            _allocate(WavelengthGrid::count(start, end, step), false);
+        std::fill(values, values + _size, v);
     }
 
-    SPD(std::vector<float> w, std::vector<float> v)
-        : _wavelengths(std::move(w)), _values(std::move(v)) {
-        color_assert(_wavelengths.size() == _values.size(),
+    SPD(std::vector<float> w, std::vector<float> v) {
+        color_assert(w.size() == v.size(),
                      "wavelengh and value array sizes do not match");
-        color_assert(_wavelengths.size() > 1,
+        color_assert(w.size() > 1,
                      "number of wavelengths must be greater than 1");
 
         // scan through the wavelengths and determine if it's a uniform
         // distribution or not
-        _step = _wavelengths[1] - _wavelengths[0];
-        for (size_t i = 2; i < _wavelengths.size(); ++i) {
-            if (_wavelengths[i] - _wavelengths[i - 1] != _step) {
+        _start = w[0];
+        _step = w[1] - w[0];
+        for (size_t i = 2; i < w.size(); ++i) {
+            if (w[i] - w[i - 1] != _step) {
                 _step = 0.0f;
                 break;
             }
         }
+
+        // uniform distributions don't need to store their wavelengths
+        float* values = _allocate(v.size(), !is_uniform());
+        std::copy(v.begin(), v.end(), values);
+        if (!is_uniform()) {
+            std::copy(w.begin(), w.end(), values + _size);
+        }
     }
 
     SPD(float start, float end, float step,
-                              std::vector<float>&& v) {
-        _step = step;
-        float end_inc = end - step;
-        color_assert(int((start - end_inc) / step) == v.size(),
-                     "range does not match size of values array");
+                              std::vector<float>&& v)
+        : _start(start), _step(step) {
+        // end only serves to check v's size
+        (void)end;
+        color_assert(WavelengthGrid::count(start, end, step) == v.size(),
+                     "number of wavelengths does not match number of values");
+        std::copy(v.begin(), v.end(), _allocate(v.size(), false));
+    }
 
-        _values = std::move(v);
+    /// Copy the samples of a view
+    explicit SPD(const SPDView& view)
+        : _start(view.grid.start), _step(view.grid.step) {
+        _own(view.num_samples(), view.grid.wavelengths, view.values);
+    }
 
-        for (float l = start; l < end; l += step) {
-            _wavelengths.push_back(l);
+    /**
+     * @brief N samples every step nm from start, held in static storage
+     * @details For the library's built-in tables only. values is referenced,
+     * not copied, and must never change, since static samples are
+     * recognised by address, e.g. by the spectral response cache
+     */
+    template <size_t N>
+    constexpr SPD(detail::StaticSamples, const float (&values)[N],
+                  float start, float step)
+        : _start(start), _step(step), _size(N), _wavelengths(nullptr),
+          _values(values) {}
+
+    SPD(const SPD& o)
+        : _start(o._start), _step(o._step), _size(o._size),
+          _wavelengths(o._wavelengths), _values(o._values) {
+        if (o._storage) {
+            _own(o._size, o._wavelengths, o._values);
+            _revision = o._revision;
         }
+    }
 
-        color_assert(_wavelengths.size() == _values.size(),
-                     "number of wavelengths does not match number of values");
+    SPD(SPD&& o) noexcept
+        : _start(o._start), _step(o._step), _size(o._size),
+          _wavelengths(o._wavelengths), _values(o._values),
+          _storage(std::move(o._storage)), _revision(o._revision) {
+        o._size = 0;
+        o._wavelengths = nullptr;
+        o._values = nullptr;
+        o._revision = 0;
     }
 
-    SPD(const SPD&) = default;
-    SPD(SPD&&) = default;
-    SPD&
-    operator=(const SPD&) = default;
-    SPD& operator=(SPD&&) = default;
+    SPD& operator=(SPD o) noexcept {
+        std::swap(_start, o._start);
+        std::swap(_step, o._step);
+        std::swap(_size, o._size);
+        std::swap(_wavelengths, o._wavelengths);
+        std::swap(_values, o._values);
+        std::swap(_storage, o._storage);
+        std::swap(_revision, o._revision);
+        return *this;
+    }
 
     bool operator==(const SPD& rhs) {
-        if (start() != rhs.start() || end() != rhs.end() ||
-            step() != rhs.step())
+        if (!is_equal_scale(rhs))
             return false;
 
         for (size_t i = 0; i < num_samples(); ++i) {
-            if (_wavelengths[i] != rhs._wavelengths[i])
-                return false;
             if (_values[i] != rhs._values[i])
                 return false;
         }
@@ -82,23 +154,45 @@ public:
         return !(*this == rhs);
     }
 
-    float start() const { return _wavelengths[0]; }
-    float end() const { return _wavelengths[_wavelengths.size() - 1] + _step; }
+    float start() const { return _start; }
+    float end() const { return wavelength(num_samples() - 1) + _step; }
     float step() const { return _step; }
-    size_t num_samples() const { return _wavelengths.size(); }
+    size_t num_samples() const { return _size; }
     bool is_uniform() const { return !(_step == 0.0f); }
 
+    /// Sample values, one per wavelength
+    const float* data() const { return _values; }
+
+    /// True if the samples are in static storage, as the built-in tables'
+    /// are. Static samples are never modified
+    bool has_static_samples() const { return !_storage && _values; }
+
+    /**
+     * @brief Identifies the samples and wavelengths of an SPD that owns them
+     * @details Changes whenever they are modified, and is kept by copies
+     * until then, so SPDs with equal revisions hold equal samples. Zero if
+     * the samples are static, which are identified by data() instead
+     */
+    u64 revision() const { return _revision; }
+
+    /// Wavelength of the i-th sample
+    float wavelength(size_t i) const {
+        return is_uniform() ? _start + float(i) * _step : _wavelengths[i];
+    }
+
     /**
      * @brief Check if rhs has the same range and step size as this
      */
     bool is_equal_scale(const SPD& rhs) const {
-        if (start() != rhs.start() || end() != rhs.end() ||
-            step() != rhs.step())
+        if (start() != rhs.start() || step() != rhs.step() ||
+            num_samples() != rhs.num_samples())
             return false;
 
-        for (size_t i = 0; i < _wavelengths.size(); ++i) {
-            if (_wavelengths[i] != rhs._wavelengths[i])
-                return false;
+        if (!is_uniform()) {
+            for (size_t i = 0; i < _size; ++i) {
+                if (_wavelengths[i] != rhs._wavelengths[i])
+                    return false;
+            }
         }
 
         return true;
@@ -113,90 +207,67 @@ public:
     //     }
     // }
 
-    // interpolate this SPD from another
-    // currently rhs must have a wider range than this spd (no extrapolation)
-    void interpolate_from(const SPD& rhs) {
-        size_t sz = _wavelengths.size();
+    /**
+     * @brief The wavelengths this SPD is sampled at
+     * @details The returned grid refers to this SPD's storage and is only
+     * valid for as long as the SPD is
+     */
+    WavelengthGrid grid() const {
+        if (is_uniform()) {
+            return WavelengthGrid(_start, _step, _size);
+        } else {
+            return WavelengthGrid(_wavelengths, _size);
+        }
+    }
+
+    /// View of this SPD's samples. Only valid for as long as the SPD is
+    SPDView view() const { return SPDView(grid(), _values); }
 
+    /**
+     * @brief Interpolate this SPD from another, keeping our own sampling
+     * @details Wavelengths outside the range of rhs are handled according to
+     * extrapolation. Runs in time linear in the number of samples of both
+     * SPDs.
+     */
+    void interpolate_from(const SPD& rhs,
+                          Extrapolation extrapolation = Extrapolation::Clamp) {
         // if the other SPD is the same distribution as us, just copy it
         if (is_equal_scale(rhs)) {
             *this = rhs;
             return;
         }
 
-        // first check that the range of the SPD we're interpolating is
-        // at least as big as the range we're representing
-        // i.e. we don't do extrapolation yet
-        color_assert(_wavelengths[0] >= _wavelengths[0], "");
-        color_assert(_wavelengths[sz - 1] <=
-                         rhs._wavelengths[rhs._wavelengths.size() - 1],
-                     "");
-        color_assert(rhs._wavelengths.size() > 1, "");
-
-        // foreach wavelength we want to interpolate onto
-        for (size_t i = 0; i < sz; ++i) {
-            size_t j1 = 0;
-            size_t j0 = 0;
-            // find the first wavelength in rhs that's past our desired
-            // wavelength
-            while (rhs._wavelengths[j1++] < _wavelengths[i])
-                ;
-
-            // j is now the index of the first wavelength greater than our
-            // desired
-            // get the preceding index
-            if (j1 > 0) {
-                j0 = j1 - 1;
-
-                // get the t of where our wavelength sits between the rhs ones
-                float t = (_wavelengths[i] - rhs._wavelengths[j0]) /
-                          (rhs._wavelengths[j1] - rhs._wavelengths[j0]);
-
-                // lerp to get our new value
-                _values[i] = lerp(rhs._values[j0], rhs._values[j1], t);
-            } else {
-                _values[i] = rhs._values[j1];
-            }
-        }
+        float* values = _writable_values();
+        resample(rhs.grid(), rhs._values, grid(), values, extrapolation);
     }
 
     /**
      * @brief Interpolate this SPD onto a simple float array of values
      * @details Used by the CoefficientSpectrum class to fill out its
-     * precomputed
-     * arrays
+     * precomputed arrays. v is sampled uniformly at sz wavelengths starting
+     * at lambda_start with step (lambda_end - lambda_start) / sz
      */
     void interpolate_onto(float* v, float lambda_start, float lambda_end,
-                          int sz) const {
-        color_assert(lambda_start >= start(), "");
-        color_assert(lambda_end - (lambda_end-lambda_start)/sz <= _wavelengths.back(), "");
-
+                          int sz,
+                          Extrapolation extrapolation = Extrapolation::Clamp) const {
         // if sampling is the same, just copy
-        if (sz == _wavelengths.size() && lambda_start == start() &&
-            lambda_end == end())
-            memcpy(v, &(_wavelengths[0]), sizeof(float) * sz);
+        if (size_t(sz) == num_samples() && lambda_start == start() &&
+            lambda_end == end()) {
+            memcpy(v, _values, sizeof(float) * sz);
+            return;
+        }
 
-        float lambda = lambda_start;
         float lambda_step = (lambda_end - lambda_start) / float(sz);
-        for (int i = 0; i < sz; ++i, lambda += lambda_step) {
-            int j1 = 0;
-            int j0 = 0;
-            while (_wavelengths[j1++] < lambda)
-                ;
-
-            if (j1 > 0) {
-                j0 = j1 - 1;
-                float t = (lambda - _wavelengths[j0]) /
-                          (_wavelengths[j1] - _wavelengths[j0]);
-
-                v[i] = lerp(_values[j0], _values[j1], t);
-            } else {
-                v[i] = _values[0];
-            }
-        }
+        resample(grid(), _values,
+                 WavelengthGrid(lambda_start, lambda_step, sz), v,
+                 extrapolation);
     }
 
-    //
+    /**
+     * @brief Linearly interpolated value at lambda
+     * @details Only valid for uniform SPDs, where the bracketing samples are
+     * found directly from the start and step
+     */
     float value(float lambda) const {
         color_assert(lambda >= start(),
                      "lambda ({}) is less than beginning of spd range ({})",
@@ -209,39 +280,74 @@ public:
         color_assert(_step != 0,
                      "cannot interpolate value from nonuniform SPD");
 
-        float s = start();
-        float e = end();
-        float sz = e - s;
-        int num = _wavelengths.size();
-        float t = (lambda - s) / (sz);
-        int i_0 = int(t * num);
-        if (i_0 < _wavelengths.size() - 1) {
-            int i_1 = i_0 + 1;
-            float w_0 = _wavelengths[i_0];
-            float w_1 = _wavelengths[i_1];
-            float t_lambda = (lambda - w_0) / (w_1 - w_0);
-            return lerp(_values[i_0], _values[i_1], t_lambda);
+        float u = (lambda - _start) / _step;
+        size_t i_0 = size_t(u);
+        if (i_0 + 1 < _size) {
+            return lerp(_values[i_0], _values[i_0 + 1], u - float(i_0));
         } else {
-            return _values[i_0];
+            return _values[_size - 1];
         }
     }
 
-    friend auto spd_to_xyz(const SPD& spd, const CMF& cmf, const SPD& illuminant) -> XYZ;
-    friend auto spd_to_xyz(const SPD& spd, const CMF& cmf) -> XYZ;
-
 private:
+    // storage for n values, followed by n wavelengths if with_wavelengths,
+    // returning the values
+    float* _allocate(size_t n, bool with_wavelengths) {
+        _storage.reset(new float[with_wavelengths ? 2 * n : n]);
+        _revision = _next_revision();
+        _size = n;
+        _values = _storage.get();
+        _wavelengths = with_wavelengths ? _storage.get() + n : nullptr;
+        return _storage.get();
+    }
+
+    // take our own copy of n values and, if not null, wavelengths
+    void _own(size_t n, const float* wavelengths, const float* values) {
+        float* v = _allocate(n, wavelengths != nullptr);
+        std::copy(values, values + n, v);
+        if (wavelengths) {
+            std::copy(wavelengths, wavelengths + n, v + n);
+        }
+    }
+
+    // our values, copied out of static storage first if they are in it.
+    // called before the values are modified, so gives them a new revision
+    float* _writable_values() {
+        if (!_storage) {
+            _own(_size, _wavelengths, _values);
+        } else {
+            _revision = _next_revision();
+        }
+        return _storage.get();
+    }
+
+    static u64 _next_revision() {
+        static std::atomic<u64> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // wavelength of the first sample
+    float _start = 0.0f;
     // step size between wavelength samples. will be zero if non-uniform
-    float _step;
-    std::vector<float> _wavelengths;
-    std::vector<float> _values;
+    float _step = 0.0f;
+    size_t _size = 0;
+    // wavelength of each sample. only stored if non-uniform, uniform SPDs
+    // compute wavelengths from _start and _step
+    const float* _wavelengths = nullptr;
+    const float* _values = nullptr;
+    // the values then any wavelengths, if this SPD owns them. null if they
+    // are in static storage
+    std::unique_ptr<float[]> _storage;
+    // see revision()
+    u64 _revision = 0;
 };
 
 inline std::ostream& operator<<(std::ostream& os,
                                 const SPD& spd) {
     os << "{";
-    for (size_t i = 0; i < spd._wavelengths.size(); ++i) {
-        os << fmt::format("{:.2f}: {:.2f}\n", spd._wavelengths[i],
-                          spd._values[i]);
+    for (size_t i = 0; i < spd.num_samples(); ++i) {
+        os << fmt::format("{:.2f}: {:.2f}\n", spd.wavelength(i),
+                          spd.data()[i]);
     }
     os << "}";
     return os;
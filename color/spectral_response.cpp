@@ -0,0 +1,320 @@
+#include "color/spectral_response.hpp"
+#include "color/kernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace color {
+
+namespace {
+// What a response was built from: the grid, the spectra sampled onto it
+// and any matrix folded in. Spectra are identified without reading their
+// samples: built-in tables by address, since they never change, and any
+// other spectrum by its revision, which changes whenever it is modified
+struct ResponseKey {
+    static constexpr int k_max_spectra = 4;
+
+    struct Spectrum {
+        // the samples if they are static, otherwise null
+        const float* table;
+        // zero if the samples are static
+        u64 revision;
+        float start;
+        float step;
+        size_t size;
+
+        bool operator==(const Spectrum& o) const {
+            return table == o.table && revision == o.revision &&
+                   start == o.start && step == o.step && size == o.size;
+        }
+    };
+
+    ResponseKey() = default;
+
+    // refers to the wavelengths of a non-uniform grid, so is only valid for
+    // as long as the grid is. Copies hold their own
+    ResponseKey(int kind, const WavelengthGrid& grid)
+        : kind(kind), start(grid.start), step(grid.step), size(grid.size),
+          wavelengths(grid.wavelengths) {}
+
+    ResponseKey(const ResponseKey& o) { *this = o; }
+
+    ResponseKey& operator=(const ResponseKey& o) {
+        if (this == &o) {
+            return *this;
+        }
+        kind = o.kind;
+        start = o.start;
+        step = o.step;
+        size = o.size;
+        num_spectra = o.num_spectra;
+        std::copy(o.spectra, o.spectra + o.num_spectra, spectra);
+        std::copy(o.matrix, o.matrix + 9, matrix);
+        // reuses our storage, so that remembering a key usually doesn't
+        // allocate
+        if (o.wavelengths) {
+            _wavelengths.assign(o.wavelengths, o.wavelengths + o.size);
+            wavelengths = _wavelengths.data();
+        } else {
+            _wavelengths.clear();
+            wavelengths = nullptr;
+        }
+        return *this;
+    }
+
+    void add(const SPD& spd) {
+        color_assert(num_spectra < k_max_spectra, "too many spectra in key");
+        spectra[num_spectra++] = Spectrum{
+            spd.has_static_samples() ? spd.data() : nullptr, spd.revision(),
+            spd.start(), spd.step(), spd.num_samples()};
+    }
+
+    void add(const M33f& m) { std::copy(m[0], m[0] + 9, matrix); }
+
+    bool operator==(const ResponseKey& o) const {
+        return kind == o.kind && start == o.start && step == o.step &&
+               size == o.size && num_spectra == o.num_spectra &&
+               std::equal(spectra, spectra + num_spectra, o.spectra) &&
+               std::equal(matrix, matrix + 9, o.matrix) &&
+               (wavelengths == nullptr) == (o.wavelengths == nullptr) &&
+               (!wavelengths ||
+                std::equal(wavelengths, wavelengths + size, o.wavelengths));
+    }
+
+    int kind = 0;
+    float start = 0.0f;
+    float step = 0.0f;
+    size_t size = 0;
+    // the grid's wavelengths if it is non-uniform, otherwise null
+    const float* wavelengths = nullptr;
+    int num_spectra = 0;
+    Spectrum spectra[k_max_spectra];
+    // a matrix folded into the response, zeros if there is none
+    float matrix[9] = {};
+
+private:
+    std::vector<float> _wavelengths;
+};
+
+struct ResponseKeyHash {
+    size_t operator()(const ResponseKey& k) const {
+        size_t h = std::hash<int>()(k.kind);
+        auto combine = [&h](size_t v) {
+            h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+        };
+        combine(std::hash<float>()(k.start));
+        combine(std::hash<float>()(k.step));
+        combine(std::hash<size_t>()(k.size));
+        if (k.wavelengths) {
+            for (size_t i = 0; i < k.size; ++i) {
+                combine(std::hash<float>()(k.wavelengths[i]));
+            }
+        }
+        for (int i = 0; i < k.num_spectra; ++i) {
+            const ResponseKey::Spectrum& s = k.spectra[i];
+            combine(std::hash<const float*>()(s.table));
+            combine(std::hash<u64>()(s.revision));
+            combine(std::hash<float>()(s.start));
+            combine(std::hash<float>()(s.step));
+            combine(std::hash<size_t>()(s.size));
+        }
+        for (float v : k.matrix) {
+            combine(std::hash<float>()(v));
+        }
+        return h;
+    }
+};
+
+enum ResponseKind : int { XYZ_REFLECTANCE = 0, XYZ_EMISSION, RGB_REFLECTANCE };
+
+// responses for grids we haven't seen before get built once and shared.
+// the cache is dropped wholesale when it gets large, since in practice a
+// handful of grids are in use at any one time
+constexpr size_t k_max_cached_responses = 256;
+
+std::mutex g_cache_mutex;
+// bumped whenever the cache is cleared, to invalidate per-thread lookups
+std::atomic<u64> g_cache_generation{0};
+std::unordered_map<ResponseKey, std::shared_ptr<const SpectralResponse>,
+                   ResponseKeyHash>
+    g_cache;
+
+template <typename F>
+auto cached_response(const ResponseKey& key, F&& build)
+    -> std::shared_ptr<const SpectralResponse> {
+    // most callers convert a run of spectra on the same grid, so remember
+    // the last response used on this thread to avoid taking the lock
+    thread_local ResponseKey last_key;
+    thread_local std::shared_ptr<const SpectralResponse> last_response;
+    thread_local u64 last_generation = 0;
+    u64 generation = g_cache_generation.load(std::memory_order_acquire);
+    if (last_response && last_generation == generation && last_key == key) {
+        return last_response;
+    }
+
+    std::shared_ptr<const SpectralResponse> response;
+    {
+        std::lock_guard<std::mutex> lock(g_cache_mutex);
+        auto it = g_cache.find(key);
+        if (it != g_cache.end()) {
+            response = it->second;
+        }
+    }
+
+    if (!response) {
+        response = build();
+        std::lock_guard<std::mutex> lock(g_cache_mutex);
+        if (g_cache.size() >= k_max_cached_responses) {
+            g_cache.clear();
+        }
+        g_cache.emplace(key, response);
+    }
+
+    last_key = key;
+    last_response = response;
+    last_generation = generation;
+    return response;
+}
+
+// sample s onto grid, zeroing everything outside [lambda_start, lambda_end)
+void sample_onto(const SPD& s, const WavelengthGrid& grid, float lambda_start,
+                 float lambda_end, float* out) {
+    resample(s.grid(), s.data(), grid, out, Extrapolation::Clamp);
+    for (size_t i = 0; i < grid.size; ++i) {
+        if (grid[i] < lambda_start || grid[i] >= lambda_end) {
+            out[i] = 0.0f;
+        }
+    }
+}
+} // namespace
+
+SpectralResponse::SpectralResponse(size_t num_samples)
+    : _num_samples(num_samples),
+      _stride((num_samples + 15) / 16 * 16), _weights(3 * _stride, 0.0f) {}
+
+auto SpectralResponse::apply(const float* values) const -> V3f {
+    f32 sum[3];
+    detail::kernels().respond(row(0), _stride, values, _num_samples, sum);
+    return V3f(sum[0], sum[1], sum[2]);
+}
+
+void SpectralResponse::apply(const float* values, size_t stride,
+                             size_t count, float* out) const {
+    const detail::Kernels& k = detail::kernels();
+    const size_t block = detail::k_respond_block;
+    size_t s = 0;
+    for (; s + block <= count; s += block) {
+        const float* v[detail::k_respond_block];
+        for (size_t b = 0; b < block; ++b) {
+            v[b] = values + (s + b) * stride;
+        }
+        k.respond_block(row(0), _stride, v, _num_samples, out + 3 * s);
+    }
+
+    for (; s < count; ++s) {
+        V3f r = apply(values + s * stride);
+        out[3 * s] = r.x;
+        out[3 * s + 1] = r.y;
+        out[3 * s + 2] = r.z;
+    }
+}
+
+auto xyz_response(const WavelengthGrid& grid, const CMF& cmf,
+                  const SPD& illuminant)
+    -> std::shared_ptr<const SpectralResponse> {
+    ResponseKey key(XYZ_REFLECTANCE, grid);
+    key.add(cmf.x_bar);
+    key.add(cmf.y_bar);
+    key.add(cmf.z_bar);
+    key.add(illuminant);
+    return cached_response(key, [&]() {
+        // limit our calculation to the smallest range
+        auto lambda_start = std::max(grid.front(),
+                                     std::max(cmf.x_bar.start(),
+                                              illuminant.start()));
+        auto lambda_end =
+            std::min(grid.back() + grid.step,
+                     std::min(cmf.x_bar.end(), illuminant.end()));
+
+        auto response = std::make_shared<SpectralResponse>(grid.size);
+        std::vector<float> illum(grid.size);
+        sample_onto(illuminant, grid, lambda_start, lambda_end, illum.data());
+        const SPD* bars[3] = {&cmf.x_bar, &cmf.y_bar, &cmf.z_bar};
+        for (int c = 0; c < 3; ++c) {
+            float* r = response->row(c);
+            sample_onto(*bars[c], grid, lambda_start, lambda_end, r);
+            for (size_t i = 0; i < grid.size; ++i) {
+                r[i] *= illum[i];
+            }
+        }
+
+        // normalise so that the illuminant itself has Y = 1
+        float N = 0.0f;
+        for (size_t i = 0; i < grid.size; ++i) {
+            N += response->row(1)[i];
+        }
+        for (int c = 0; c < 3; ++c) {
+            float* r = response->row(c);
+            for (size_t i = 0; i < grid.size; ++i) {
+                r[i] /= N;
+            }
+        }
+        return response;
+    });
+}
+
+auto xyz_response(const WavelengthGrid& grid, const CMF& cmf)
+    -> std::shared_ptr<const SpectralResponse> {
+    ResponseKey key(XYZ_EMISSION, grid);
+    key.add(cmf.x_bar);
+    key.add(cmf.y_bar);
+    key.add(cmf.z_bar);
+    return cached_response(key, [&]() {
+        auto lambda_start = std::max(grid.front(), cmf.x_bar.start());
+        auto lambda_end = std::min(grid.back() + grid.step, cmf.x_bar.end());
+
+        auto response = std::make_shared<SpectralResponse>(grid.size);
+        const SPD* bars[3] = {&cmf.x_bar, &cmf.y_bar, &cmf.z_bar};
+        for (int c = 0; c < 3; ++c) {
+            sample_onto(*bars[c], grid, lambda_start, lambda_end,
+                        response->row(c));
+        }
+        return response;
+    });
+}
+
+auto rgb_response(const WavelengthGrid& grid, const ColorSpaceRGB& cs)
+    -> std::shared_ptr<const SpectralResponse> {
+    const SPD& illuminant = Illuminant::get(cs.white_point.illuminant);
+    ResponseKey key(RGB_REFLECTANCE, grid);
+    key.add(cs.cmf.x_bar);
+    key.add(cs.cmf.y_bar);
+    key.add(cs.cmf.z_bar);
+    key.add(illuminant);
+    key.add(cs.m_xyz_to_rgb);
+    return cached_response(key, [&]() {
+        auto xyz = xyz_response(grid, cs.cmf, illuminant);
+
+        auto response = std::make_shared<SpectralResponse>(grid.size);
+        const M33f& m = cs.m_xyz_to_rgb;
+        for (int c = 0; c < 3; ++c) {
+            float* r = response->row(c);
+            for (size_t i = 0; i < grid.size; ++i) {
+                r[i] = m[c][0] * xyz->row(0)[i] + m[c][1] * xyz->row(1)[i] +
+                       m[c][2] * xyz->row(2)[i];
+            }
+        }
+        return response;
+    });
+}
+
+void clear_spectral_response_cache() {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    g_cache.clear();
+    g_cache_generation.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace color
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "color/aligned.hpp"
+#include "color/cmf.hpp"
+#include "color/color_space_rgb.hpp"
+
+#include <memory>
+
+namespace color {
+
+/**
+ * @brief Three weighting functions sampled on a wavelength grid
+ * @details Integrating a spectrum sampled on the same grid against the
+ * response is three dot products, computed together in a single pass over
+ * the spectrum. Any normalisation is folded into the weights.
+ */
+class SpectralResponse {
+public:
+    /// A response of zeros over num_samples wavelengths
+    explicit SpectralResponse(size_t num_samples);
+
+    size_t num_samples() const { return _num_samples; }
+
+    /// Weights for channel c, padded with zeros to a multiple of 16 floats
+    const float* row(int c) const { return _weights.data() + c * _stride; }
+    float* row(int c) { return _weights.data() + c * _stride; }
+
+    /// Integrate num_samples() values against the three weighting functions
+    auto apply(const float* values) const -> V3f;
+
+    /**
+     * @brief Integrate count spectra stored at a fixed stride
+     * @details Spectrum s is read from values + s * stride and its three
+     * results written to out[3 * s], out[3 * s + 1] and out[3 * s + 2].
+     * This is the (spectra x wavelengths) . (wavelengths x 3) product,
+     * computed in blocks of spectra that share each load of the weights.
+     */
+    void apply(const float* values, size_t stride, size_t count,
+               float* out) const;
+
+private:
+    size_t _num_samples;
+    size_t _stride;
+    AlignedVector<float> _weights;
+};
+
+/**
+ * @brief Response taking spectra sampled on grid to XYZ under illuminant
+ * @details Both the colour matching functions and the illuminant are
+ * resampled onto grid, over the range the three of them have in common, and
+ * normalised so that a perfect reflector has Y = 1. Responses are cached on
+ * the grid and on which samples cmf and illuminant hold, without reading
+ * them: the built-in tables are recognised by address and other spectra by
+ * SPD::revision(), so any spectra may be passed, including temporaries.
+ */
+auto xyz_response(const WavelengthGrid& grid, const CMF& cmf,
+                  const SPD& illuminant)
+    -> std::shared_ptr<const SpectralResponse>;
+
+/// Response taking emission spectra sampled on grid to unnormalised XYZ
+auto xyz_response(const WavelengthGrid& grid, const CMF& cmf)
+    -> std::shared_ptr<const SpectralResponse>;
+
+/**
+ * @brief Response taking spectra sampled on grid to linear RGB in cs
+ * @details The XYZ response for cs's colour matching functions and white
+ * point illuminant with cs.m_xyz_to_rgb folded in, so converting a spectrum
+ * to linear RGB is three dot products. Cached on the grid, cs's matrix and
+ * its colour matching functions and white point illuminant, identified as
+ * for xyz_response(), so cs may be a temporary, or modified between calls.
+ */
+auto rgb_response(const WavelengthGrid& grid, const ColorSpaceRGB& cs)
+    -> std::shared_ptr<const SpectralResponse>;
+
+/// Drop all cached responses. Responses still referenced stay alive
+void clear_spectral_response_cache();
+
+} // namespace color
@@ -0,0 +1,84 @@
+#include "color/tile.hpp"
+#include "color/kernels.hpp"
+#include "color/parallel.hpp"
+#include "color/quantize.hpp"
+
+#include <algorithm>
+
+namespace color {
+namespace detail {
+
+namespace {
+template <typename T>
+void store_quantized(const Tile& tile, size_t n, const ImageView<T>& img,
+                     size_t x, size_t y, Dither dither) {
+    // the offsets for this stretch of the row, shared by all channels
+    const f32* offsets = dither_row(dither, x, y);
+    for (int c = 0; c < 3; ++c) {
+        T* p = img.at(c, x, y);
+        if (img.pixel_stride == 1) {
+            quantize(tile.c[c], p, n, offsets);
+            continue;
+        }
+        // quantize the whole channel with the vector kernel, then scatter
+        T q[k_tile];
+        quantize(tile.c[c], q, n, offsets);
+        for (size_t i = 0; i < n; ++i) {
+            p[ptrdiff_t(i) * img.pixel_stride] = q[i];
+        }
+    }
+}
+} // namespace
+
+void store(const Tile& tile, size_t n, const ImageView<u8>& img, size_t x,
+           size_t y, Dither dither) {
+    store_quantized(tile, n, img, x, y, dither);
+}
+
+void store(const Tile& tile, size_t n, const ImageView<u16>& img, size_t x,
+           size_t y, Dither dither) {
+    store_quantized(tile, n, img, x, y, dither);
+}
+
+void load(const RGBf32* rgb, size_t n, Tile& tile) {
+    for (size_t i = 0; i < n; ++i) {
+        tile.c[0][i] = rgb[i].r;
+        tile.c[1][i] = rgb[i].g;
+        tile.c[2][i] = rgb[i].b;
+    }
+}
+
+void store(const Tile& tile, size_t n, RGBf32* rgb) {
+    for (size_t i = 0; i < n; ++i) {
+        rgb[i] = RGBf32(tile.c[0][i], tile.c[1][i], tile.c[2][i]);
+    }
+}
+
+void transform(const M33f& m, Tile& tile, size_t n) {
+    kernels().transform_planar(m[0], tile.c[0], tile.c[1], tile.c[2], n);
+}
+
+void apply_transfer(const TransferFunction& tf, Tile& tile, size_t n,
+                    Accuracy accuracy) {
+    if (tf.curve() == TransferFunction::Curve::Custom) {
+        // custom curves are defined on whole colours
+        for (size_t i = 0; i < n; ++i) {
+            RGBf32 rgb =
+                tf(RGBf32(tile.c[0][i], tile.c[1][i], tile.c[2][i]));
+            tile.c[0][i] = rgb.r;
+            tile.c[1][i] = rgb.g;
+            tile.c[2][i] = rgb.b;
+        }
+    } else {
+        for (int c = 0; c < 3; ++c) {
+            tf.apply(tile.c[c], n, accuracy);
+        }
+    }
+}
+
+auto row_grain(size_t width) -> size_t {
+    return chunk_grain(width * 2 * sizeof(RGBf32));
+}
+
+} // namespace detail
+} // namespace color
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "color/aligned.hpp"
+#include "color/image.hpp"
+#include "color/parallel.hpp"
+#include "color/quantize.hpp"
+#include "color/rgb.hpp"
+#include "color/transfer_function.hpp"
+
+#include <cstddef>
+
+namespace color {
+namespace detail {
+
+/// Pixels processed at a time by the buffer kernels
+constexpr size_t k_tile = 256;
+
+/// Colours handed to each task by the functions on arrays of colours, a
+/// whole number of tiles of float colours in and out
+constexpr size_t k_colour_grain =
+    chunk_grain(2 * sizeof(RGBf32)) / k_tile * k_tile;
+
+/**
+ * @brief A tile of pixels held planar in three small arrays
+ * @details Small enough to stay in L1 while every stage of a conversion runs
+ * over it, so that each stage is a simple loop the compiler can vectorize
+ */
+struct alignas(simd_alignment) Tile {
+    f32 c[3][k_tile];
+};
+
+/**
+ * @brief Calls X(S, D) for every pair of source and destination channel
+ * types supported by the image functions
+ * @details The image functions are templates declared in the public
+ * headers and explicitly instantiated for these pairs
+ */
+#define COLOR_IMAGE_CHANNEL_PAIRS(X)                                           \
+    X(f32, f32)                                                                \
+    X(f32, f16)                                                                \
+    X(f32, u16)                                                                \
+    X(f32, u8)                                                                 \
+    X(f16, f32)                                                                \
+    X(f16, f16)                                                                \
+    X(f16, u16)                                                                \
+    X(f16, u8)                                                                 \
+    X(u16, f32)                                                                \
+    X(u16, f16)                                                                \
+    X(u16, u16)                                                                \
+    X(u16, u8)                                                                 \
+    X(u8, f32)                                                                 \
+    X(u8, f16)                                                                 \
+    X(u8, u16)                                                                 \
+    X(u8, u8)
+
+/// Channel value as a float. Integer code values map [0, max] to [0, 1]
+inline auto to_f32(f32 v) -> f32 { return v; }
+inline auto to_f32(f16 v) -> f32 { return f32(v); }
+inline auto to_f32(u16 v) -> f32 { return f32(v) * (1.0f / 65535.0f); }
+inline auto to_f32(u8 v) -> f32 { return f32(v) * (1.0f / 255.0f); }
+
+/// Load n pixels starting at (x, y) into tile
+template <typename T>
+void load(const ImageView<const T>& img, size_t x, size_t y, size_t n,
+          Tile& tile) {
+    for (int c = 0; c < 3; ++c) {
+        const T* p = img.at(c, x, y);
+        for (size_t i = 0; i < n; ++i) {
+            tile.c[c][i] = to_f32(p[ptrdiff_t(i) * img.pixel_stride]);
+        }
+    }
+}
+
+/// Table of tf over every value of an 8 or 16-bit channel type, or null if
+/// there is none. See TransferFunction::table_f16()
+inline auto transfer_table(const TransferFunction&, const f32*)
+    -> const f32* {
+    return nullptr;
+}
+inline auto transfer_table(const TransferFunction& tf, const f16*)
+    -> const f32* {
+    return tf.table_f16();
+}
+inline auto transfer_table(const TransferFunction& tf, const u16*)
+    -> const f32* {
+    return tf.table_u16();
+}
+inline auto transfer_table(const TransferFunction& tf, const u8*)
+    -> const f32* {
+    return tf.table_u8();
+}
+
+/// Index of v in a table from transfer_table(). f32 has no table, its
+/// overload only exists so that generic code compiles
+inline auto table_index(f16 v) -> u16 { return v.bits(); }
+inline auto table_index(u16 v) -> u16 { return v; }
+inline auto table_index(u8 v) -> u16 { return v; }
+inline auto table_index(f32) -> u16 { return 0; }
+
+/// Load n pixels starting at (x, y) into tile, looking each channel up in
+/// a table from transfer_table()
+template <typename T>
+void load(const ImageView<const T>& img, size_t x, size_t y, size_t n,
+          const f32* table, Tile& tile) {
+    for (int c = 0; c < 3; ++c) {
+        const T* p = img.at(c, x, y);
+        for (size_t i = 0; i < n; ++i) {
+            tile.c[c][i] =
+                table[table_index(p[ptrdiff_t(i) * img.pixel_stride])];
+        }
+    }
+}
+
+/// Store the first n pixels of tile starting at (x, y). Float channels
+/// are not quantized, so are never dithered
+template <typename T>
+void store(const Tile& tile, size_t n, const ImageView<T>& img, size_t x,
+           size_t y, Dither = Dither::None) {
+    for (int c = 0; c < 3; ++c) {
+        T* p = img.at(c, x, y);
+        for (size_t i = 0; i < n; ++i) {
+            p[ptrdiff_t(i) * img.pixel_stride] = T(tile.c[c][i]);
+        }
+    }
+}
+
+/// Store the first n pixels of tile starting at (x, y), dithered and
+/// quantized to code values. See quantize()
+void store(const Tile& tile, size_t n, const ImageView<u8>& img, size_t x,
+           size_t y, Dither dither = Dither::None);
+void store(const Tile& tile, size_t n, const ImageView<u16>& img, size_t x,
+           size_t y, Dither dither = Dither::None);
+
+/// Deinterleave n colours into tile
+void load(const RGBf32* rgb, size_t n, Tile& tile);
+
+/// Interleave the first n colours of tile into rgb
+void store(const Tile& tile, size_t n, RGBf32* rgb);
+
+/// m * c for each of the first n colours in tile, in place
+void transform(const M33f& m, Tile& tile, size_t n);
+
+/// Apply tf to the first n colours in tile, in place
+void apply_transfer(const TransferFunction& tf, Tile& tile, size_t n,
+                    Accuracy accuracy = Accuracy::Exact);
+
+/// Rows handed to each task when processing an image width pixels wide,
+/// aiming for tasks whose float colours in and out fit in k_chunk_bytes
+auto row_grain(size_t width) -> size_t;
+
+} // namespace detail
+} // namespace color
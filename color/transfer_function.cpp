@@ -0,0 +1,116 @@
+#include "color/transfer_function.hpp"
+#include "color/kernels.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace color {
+
+namespace {
+using Curve = TransferFunction::Curve;
+
+// the built-in curves are the ones before Gamma
+constexpr int k_num_tabulated = int(Curve::Gamma);
+
+struct Table {
+    std::once_flag once;
+    std::unique_ptr<f32[]> values;
+};
+
+// table of tf at input(i) for each of the size inputs i. built on first
+// use, after which it is only ever read, so needs no further locking
+template <typename F>
+auto get_table(Table* tables, const TransferFunction& tf, size_t size,
+               F input) -> const f32* {
+    Curve curve = tf.is_linear() ? Curve::Linear : tf.curve();
+    if (int(curve) >= k_num_tabulated) {
+        return nullptr;
+    }
+
+    Table& table = tables[int(curve)];
+    std::call_once(table.once, [&]() {
+        table.values.reset(new f32[size]);
+        f32* v = table.values.get();
+        for (size_t i = 0; i < size; ++i) {
+            v[i] = input(u16(i));
+        }
+        TransferFunction(curve).apply(v, size);
+    });
+    return table.values.get();
+}
+} // namespace
+
+auto TransferFunction::table_f16() const -> const f32* {
+    static Table tables[k_num_tabulated];
+    return get_table(tables, *this, 65536, [](u16 bits) {
+        f16 h;
+        h.setBits(bits);
+        return f32(h);
+    });
+}
+
+auto TransferFunction::table_u16() const -> const f32* {
+    static Table tables[k_num_tabulated];
+    return get_table(tables, *this, 65536,
+                     [](u16 v) { return f32(v) * (1.0f / 65535.0f); });
+}
+
+auto TransferFunction::table_u8() const -> const f32* {
+    static Table tables[k_num_tabulated];
+    return get_table(tables, *this, 256,
+                     [](u16 v) { return f32(v) / 255.0f; });
+}
+
+void TransferFunction::apply(const RGBf16* src, RGBf32* dst, size_t n) const {
+    if (const f32* table = table_f16()) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = RGBf32(table[src[i].r.bits()], table[src[i].g.bits()],
+                            table[src[i].b.bits()]);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = RGBf32(src[i]);
+    }
+    apply(dst, n);
+}
+
+void TransferFunction::apply(const RGBu16* src, RGBf32* dst, size_t n) const {
+    if (const f32* table = table_u16()) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = RGBf32(table[src[i].r], table[src[i].g], table[src[i].b]);
+        }
+        return;
+    }
+
+    const f32 scale = 1.0f / 65535.0f;
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = RGBf32(f32(src[i].r) * scale, f32(src[i].g) * scale,
+                        f32(src[i].b) * scale);
+    }
+    apply(dst, n);
+}
+
+void TransferFunction::apply(const RGBu8* src, RGBf32* dst, size_t n) const {
+    if (const f32* table = table_u8()) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = RGBf32(table[src[i].r], table[src[i].g], table[src[i].b]);
+        }
+        return;
+    }
+
+    const f32 scale = 1.0f / 255.0f;
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = RGBf32(f32(src[i].r) * scale, f32(src[i].g) * scale,
+                        f32(src[i].b) * scale);
+    }
+    apply(dst, n);
+}
+
+void TransferFunction::_apply_approx(f32* v, size_t n,
+                                     Accuracy accuracy) const {
+    detail::kernels().transfer(_curve, accuracy, v, n);
+}
+
+} // namespace color
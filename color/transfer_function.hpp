@@ -0,0 +1,323 @@
+#pragma once
+
+#include "color/fast_math.hpp"
+#include "color/rgb.hpp"
+
+#include <functional>
+
+namespace color {
+
+namespace OETF {
+COLOR_FN_CONST inline auto linear(RGBf32 c) -> RGBf32 { return c; }
+COLOR_FN_CONST inline auto sRGBf(float f) -> float {
+    if (f <= 0.0031308f) {
+        return 12.92f * f;
+    } else {
+        return (1.0f + 0.055f) * powf(f, 1.0f / 2.4f) - 0.055f;
+    }
+}
+
+COLOR_FN_CONST inline auto sRGB(RGBf32 c) -> RGBf32 {
+    return RGBf32(sRGBf(c.r), sRGBf(c.g), sRGBf(c.b));
+}
+
+COLOR_FN_CONST inline auto rec709f(float f) -> float {
+    if (f <= 0.018f) {
+        return f * 4.5f;
+    } else {
+        return 1.099f * powf(f, 0.45f) - 0.099f;
+    }
+}
+COLOR_FN_CONST inline auto rec709(RGBf32 c) -> RGBf32 {
+    return RGBf32(rec709f(c.r), rec709f(c.g), rec709f(c.b));
+}
+
+/// sRGBf to within the error bound of A, without calling powf. Takes
+/// either a float or an f32x
+template <Accuracy A, typename T>
+COLOR_FN_INLINE auto sRGBf_approx(const T& f) -> T {
+    return fast::linear_pow<A>(f, 0.0031308f, 12.92f, 1.0f, 0.0f,
+                               1.0f / 2.4f, 1.055f, -0.055f);
+}
+
+/// rec709f to within the error bound of A, without calling powf
+template <Accuracy A, typename T>
+COLOR_FN_INLINE auto rec709f_approx(const T& f) -> T {
+    return fast::linear_pow<A>(f, 0.018f, 4.5f, 1.0f, 0.0f, 0.45f, 1.099f,
+                               -0.099f);
+}
+}
+
+namespace EOTF {
+COLOR_FN_CONST inline auto linear(RGBf32 c) -> RGBf32 { return c; }
+COLOR_FN_CONST inline auto sRGBf(float f) -> float {
+    if (f <= 0.040449936f) {
+        return f / 12.92f;
+    } else {
+        return powf((f + 0.055f) / 1.055f, 2.4f);
+    }
+}
+COLOR_FN_CONST inline auto sRGB(RGBf32 c) -> RGBf32 {
+    return RGBf32(sRGBf(c.r), sRGBf(c.g), sRGBf(c.b));
+}
+COLOR_FN_CONST inline auto rec709f(float f) -> float {
+    if (f <= 0.018f * 4.5f) {
+        return f / 4.5f;
+    } else {
+        return powf((f + 0.099f) / 1.099f, 1.0f / 0.45f);
+    }
+}
+COLOR_FN_CONST inline auto rec709(RGBf32 c) -> RGBf32 {
+    return RGBf32(rec709f(c.r), rec709f(c.g), rec709f(c.b));
+}
+
+/// sRGBf to within the error bound of A, without calling powf. Takes
+/// either a float or an f32x
+template <Accuracy A, typename T>
+COLOR_FN_INLINE auto sRGBf_approx(const T& f) -> T {
+    return fast::linear_pow<A>(f, 0.040449936f, 1.0f / 12.92f, 1.0f / 1.055f,
+                               0.055f / 1.055f, 2.4f, 1.0f, 0.0f);
+}
+
+/// rec709f to within the error bound of A, without calling powf
+template <Accuracy A, typename T>
+COLOR_FN_INLINE auto rec709f_approx(const T& f) -> T {
+    return fast::linear_pow<A>(f, 0.018f * 4.5f, 1.0f / 4.5f, 1.0f / 1.099f,
+                               0.099f / 1.099f, 1.0f / 0.45f, 1.0f, 0.0f);
+}
+}
+
+/**
+ * @brief A transfer function drawn from a closed set of known curves
+ * @details Knowing which curve is in use lets per-colour evaluation inline
+ * the curve behind a switch, and lets batch functions switch once per
+ * buffer rather than making an indirect call per colour. Arbitrary
+ * functions are still supported as Curve::Custom.
+ */
+class TransferFunction {
+public:
+    enum class Curve : int {
+        Linear = 0,
+        sRGB_OETF,
+        sRGB_EOTF,
+        Rec709_OETF,
+        Rec709_EOTF,
+        /// powf(c, gamma())
+        Gamma,
+        /// calls a user-supplied function
+        Custom
+    };
+
+    using Callback = std::function<RGBf32(RGBf32)>;
+
+    /// One of the built-in curves. gamma is only used by Curve::Gamma
+    TransferFunction(Curve curve = Curve::Linear, f32 gamma = 1.0f)
+        : _curve(curve), _gamma(gamma) {
+        color_assert(curve != Curve::Custom,
+                     "custom transfer functions need a callback");
+    }
+
+    /// The functions in OETF and EOTF are recognised as their curve,
+    /// anything else becomes a Custom curve calling fn
+    TransferFunction(RGBf32 (*fn)(RGBf32)) : _gamma(1.0f) {
+        if (fn == OETF::linear || fn == EOTF::linear) {
+            _curve = Curve::Linear;
+        } else if (fn == OETF::sRGB) {
+            _curve = Curve::sRGB_OETF;
+        } else if (fn == EOTF::sRGB) {
+            _curve = Curve::sRGB_EOTF;
+        } else if (fn == OETF::rec709) {
+            _curve = Curve::Rec709_OETF;
+        } else if (fn == EOTF::rec709) {
+            _curve = Curve::Rec709_EOTF;
+        } else {
+            _curve = Curve::Custom;
+            _custom = fn;
+        }
+    }
+
+    /// A Custom curve calling fn
+    TransferFunction(Callback fn)
+        : _curve(Curve::Custom), _gamma(1.0f), _custom(std::move(fn)) {}
+
+    /// powf(c, g)
+    static auto gamma(f32 g) -> TransferFunction {
+        return TransferFunction(Curve::Gamma, g);
+    }
+
+    Curve curve() const { return _curve; }
+    f32 gamma() const { return _gamma; }
+    bool is_linear() const {
+        return _curve == Curve::Linear ||
+               (_curve == Curve::Gamma && _gamma == 1.0f);
+    }
+
+    /// Custom curves are opaque and have no known inverse
+    bool has_inverse() const { return _curve != Curve::Custom; }
+
+    /// The curve undoing this one, e.g. the sRGB EOTF for the sRGB OETF
+    auto inverse() const -> TransferFunction {
+        switch (_curve) {
+        case Curve::sRGB_OETF:
+            return TransferFunction(Curve::sRGB_EOTF);
+        case Curve::sRGB_EOTF:
+            return TransferFunction(Curve::sRGB_OETF);
+        case Curve::Rec709_OETF:
+            return TransferFunction(Curve::Rec709_EOTF);
+        case Curve::Rec709_EOTF:
+            return TransferFunction(Curve::Rec709_OETF);
+        case Curve::Gamma:
+            return gamma(1.0f / _gamma);
+        case Curve::Linear:
+            return TransferFunction();
+        case Curve::Custom:
+        default:
+            color_assert(false, "custom transfer functions have no inverse");
+            return TransferFunction();
+        }
+    }
+
+    /// True if applying tf then this leaves colours unchanged
+    bool is_inverse_of(const TransferFunction& tf) const {
+        if (!has_inverse() || !tf.has_inverse()) {
+            return false;
+        }
+        if (is_linear() || tf.is_linear()) {
+            return is_linear() && tf.is_linear();
+        }
+        if (_curve == Curve::Gamma) {
+            return tf._curve == Curve::Gamma &&
+                   std::abs(_gamma * tf._gamma - 1.0f) < 1e-6f;
+        }
+        return tf.inverse()._curve == _curve;
+    }
+
+    RGBf32 operator()(RGBf32 c) const {
+        switch (_curve) {
+        case Curve::Linear:
+            return c;
+        case Curve::sRGB_OETF:
+            return OETF::sRGB(c);
+        case Curve::sRGB_EOTF:
+            return EOTF::sRGB(c);
+        case Curve::Rec709_OETF:
+            return OETF::rec709(c);
+        case Curve::Rec709_EOTF:
+            return EOTF::rec709(c);
+        case Curve::Gamma:
+            return pow(c, _gamma);
+        case Curve::Custom:
+        default:
+            return _custom(c);
+        }
+    }
+
+    /**
+     * @brief Apply to n colours in place
+     * @details With an accuracy other than Exact the sRGB and Rec.709
+     * curves are evaluated with polynomial approximations instead of powf.
+     * Gamma and Custom curves are always exact
+     */
+    void apply(RGBf32* c, size_t n, Accuracy accuracy = Accuracy::Exact) const {
+        switch (_curve) {
+        case Curve::Linear:
+            return;
+        case Curve::Custom:
+            for (size_t i = 0; i < n; ++i) {
+                c[i] = _custom(c[i]);
+            }
+            return;
+        default:
+            apply(&c[0].r, 3 * n, accuracy);
+        }
+    }
+
+    /**
+     * @brief Apply to n half-float colours, writing the results to dst
+     * @details Built-in curves are read from a table of the curve at every
+     * f16 bit pattern, see table_f16(), so are exact and cost one load per
+     * channel
+     */
+    void apply(const RGBf16* src, RGBf32* dst, size_t n) const;
+
+    /// Apply to n 16-bit colours, taking code value v as v / 65535, writing
+    /// the results to dst. Built-in curves are read from table_u16()
+    void apply(const RGBu16* src, RGBf32* dst, size_t n) const;
+
+    /// Apply to n 8-bit colours, taking code value v as v / 255, writing
+    /// the results to dst. Built-in curves are read from table_u8()
+    void apply(const RGBu8* src, RGBf32* dst, size_t n) const;
+
+    /**
+     * @brief This curve at every f16 input, indexed by the half's bits
+     * @details 65536 entries, built on first use and shared. Null for Gamma
+     * and Custom curves, which are not tabulated
+     */
+    auto table_f16() const -> const f32*;
+
+    /// This curve at v / 65535 for every 16-bit code value v. See
+    /// table_f16()
+    auto table_u16() const -> const f32*;
+
+    /// This curve at v / 255 for every 8-bit code value v. 256 entries, so
+    /// a table stays in L1 while decoding. See table_f16()
+    auto table_u8() const -> const f32*;
+
+    /// Apply to n channel values in place. Not valid for Custom curves,
+    /// which are defined on whole colours
+    void apply(f32* v, size_t n, Accuracy accuracy = Accuracy::Exact) const {
+        if (accuracy != Accuracy::Exact && _has_approx()) {
+            return _apply_approx(v, n, accuracy);
+        }
+
+        switch (_curve) {
+        case Curve::Linear:
+            return;
+        case Curve::sRGB_OETF:
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = OETF::sRGBf(v[i]);
+            }
+            return;
+        case Curve::sRGB_EOTF:
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = EOTF::sRGBf(v[i]);
+            }
+            return;
+        case Curve::Rec709_OETF:
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = OETF::rec709f(v[i]);
+            }
+            return;
+        case Curve::Rec709_EOTF:
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = EOTF::rec709f(v[i]);
+            }
+            return;
+        case Curve::Gamma:
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = powf(v[i], _gamma);
+            }
+            return;
+        case Curve::Custom:
+        default:
+            color_assert(false, "custom transfer functions cannot be applied "
+                                "to individual channels");
+        }
+    }
+
+private:
+    // the sRGB and Rec.709 curves have approximations
+    bool _has_approx() const {
+        return _curve == Curve::sRGB_OETF || _curve == Curve::sRGB_EOTF ||
+               _curve == Curve::Rec709_OETF || _curve == Curve::Rec709_EOTF;
+    }
+
+    // runs the kernel for the current simd_level()
+    void _apply_approx(f32* v, size_t n, Accuracy accuracy) const;
+
+    Curve _curve;
+    f32 _gamma;
+    Callback _custom;
+};
+
+} // namespace color
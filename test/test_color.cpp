@@ -2,9 +2,27 @@
 #include <catch/catch.hpp>
 
 #include <color/color_checker.hpp>
+#include <color/color_space_conversion.hpp>
 #include <color/color_space_rgb.hpp>
+#include <color/fixed_spd.hpp>
+#include <color/image_conversion.hpp>
+#include <color/kernels.hpp>
+#include <color/lut3d.hpp>
+#include <color/parallel.hpp>
+#include <color/pipeline.hpp>
+#include <color/quantize.hpp>
 #include <color/rgb.hpp>
+#include <color/rgbx.hpp>
+#include <color/simd.hpp>
+#include <color/spd_array.hpp>
 #include <color/spd_conversion.hpp>
+#include <color/spectral_response.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
 
 TEST_CASE("BabelAverage spectral to u8 sRGB matches", "[color]") {
 
@@ -13,10 +31,1184 @@ TEST_CASE("BabelAverage spectral to u8 sRGB matches", "[color]") {
     fmt::print("{:<20}: {}\n", "Illuminant", rgb);
 
     
-    for (const auto& p : color::ColorChecker::BabelAverage::Spectrum::map) {
-        auto rgb = color::rgb_cast<color::u8>(
-            spd_to_rgb(p.second, color::ColorSpaceRGB::ITUR_sRGB));
-        REQUIRE(rgb ==
-                color::ColorChecker::BabelAverage::sRGB::map.at(p.first));
+    using namespace color::ColorChecker::BabelAverage;
+    for (int i = 0; i < num_patches; ++i) {
+        auto rgb = color::rgb_cast<color::u8>(spd_to_rgb(
+            Spectrum::get(Patch(i)), color::ColorSpaceRGB::ITUR_sRGB));
+        REQUIRE(rgb == sRGB::get(Patch(i)));
+    }
+}
+
+TEST_CASE("SPD resampling is exact for linear spectra", "[spd]") {
+    // resampling a straight line with linear interpolation should be exact,
+    // whichever path through the resampler is taken
+    auto f = [](float l) { return 0.5f + 0.01f * (l - 400.0f); };
+
+    std::vector<float> w{400, 410, 425, 430, 460, 500, 550, 600, 690, 700};
+    std::vector<float> v;
+    for (float l : w) {
+        v.push_back(f(l));
+    }
+    color::SPD irregular(w, v);
+    REQUIRE(!irregular.is_uniform());
+
+    color::SPD uniform(400.0f, 710.0f, 10.0f);
+    uniform.interpolate_from(irregular);
+    for (size_t i = 0; i < uniform.num_samples() - 1; ++i) {
+        float l = uniform.grid()[i];
+        REQUIRE(uniform.value(l) == Approx(f(l)));
+    }
+
+    color::SPD dst(405.0f, 705.0f, 2.5f);
+    dst.interpolate_from(uniform);
+    for (size_t i = 0; i < dst.num_samples() - 2; ++i) {
+        float l = dst.grid()[i];
+        REQUIRE(dst.value(l) == Approx(f(l)));
+    }
+}
+
+TEST_CASE("SPD resampling extrapolation policies", "[spd]") {
+    color::SPD src({400, 500, 600}, {1.0f, 2.0f, 4.0f});
+    color::SPD dst(300.0f, 1500.0f, 400.0f); // 300, 700, 1100
+
+    dst.interpolate_from(src);
+    REQUIRE(dst.value(300.0f) == 1.0f);
+    REQUIRE(dst.value(700.0f) == 4.0f);
+
+    dst.interpolate_from(src, color::Extrapolation::Zero);
+    REQUIRE(dst.value(300.0f) == 0.0f);
+    REQUIRE(dst.value(700.0f) == 0.0f);
+
+    dst.interpolate_from(src, color::Extrapolation::Linear);
+    REQUIRE(dst.value(300.0f) == Approx(0.0f));
+    REQUIRE(dst.value(700.0f) == Approx(6.0f));
+}
+
+TEST_CASE("ResamplePlan matches direct resampling", "[spd]") {
+    std::vector<float> w{380, 390, 405, 420, 450, 480, 500, 560, 620, 700, 780};
+    color::WavelengthGrid src(w.data(), w.size());
+    color::WavelengthGrid dst(360.0f, 5.0f, 90);
+
+    const size_t count = 8;
+    std::vector<float> values(count * w.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = float((i * 7919) % 113) / 113.0f;
+    }
+
+    color::ResamplePlan plan(src, dst);
+    std::vector<float> batched(count * dst.size);
+    plan.apply(values.data(), w.size(), batched.data(), dst.size, count);
+
+    std::vector<float> expected(dst.size);
+    for (size_t s = 0; s < count; ++s) {
+        color::resample(src, &values[s * w.size()], dst, expected.data());
+        for (size_t i = 0; i < dst.size; ++i) {
+            REQUIRE(batched[s * dst.size + i] == expected[i]);
+        }
+    }
+
+    color::ResamplePlan nearest(src, dst, color::Interpolation::Nearest);
+    nearest.apply(values.data(), expected.data());
+    REQUIRE(expected[dst.size - 1] == values[w.size() - 1]);
+    REQUIRE(expected[(400 - 360) / 5] == values[2]); // 400 is nearer 405
+}
+
+TEST_CASE("Uniform SPDs are stored without wavelengths", "[spd]") {
+    const color::SPD& x_bar = color::CMF::CIE_1931_2_x;
+    REQUIRE(x_bar.is_uniform());
+    REQUIRE(x_bar.step() == 1.0f);
+    REQUIRE(x_bar.grid().wavelengths == nullptr);
+    REQUIRE(x_bar.wavelength(0) == 360.0f);
+    REQUIRE(x_bar.wavelength(x_bar.num_samples() - 1) == 830.0f);
+    REQUIRE(x_bar.value(555.5f) ==
+            Approx(0.5f * (x_bar.value(555.0f) + x_bar.value(556.0f))));
+}
+
+TEST_CASE("Tabulated SPDs share their static samples", "[spd]") {
+    const color::SPD& d65 = color::Illuminant::D65;
+    color::SPD copy = d65;
+    REQUIRE(copy.data() == d65.data());
+    REQUIRE(copy == d65);
+
+    // writing to the copy leaves the table alone
+    const float v = d65.value(560.0f);
+    color::SPD e(300.0f, 785.0f, 5.0f, 1.0f);
+    copy.interpolate_from(e);
+    REQUIRE(copy.data() != d65.data());
+    REQUIRE(copy.value(560.0f) == 1.0f);
+    REQUIRE(d65.value(560.0f) == v);
+}
+
+TEST_CASE("Built-in spectra are looked up by ID", "[spd]") {
+    using color::CMF;
+    using color::Illuminant;
+    namespace checker = color::ColorChecker::BabelAverage;
+    static_assert(&CMF::get(CMF::ID::CIE_1964_10degree) ==
+                      &CMF::CIE_1964_10degree,
+                  "");
+    static_assert(&Illuminant::get(Illuminant::ID::D65) == &Illuminant::D65,
+                  "");
+    static_assert(&checker::Spectrum::get(checker::Patch::foliage) ==
+                      &checker::Spectrum::foliage,
+                  "");
+
+    Illuminant::ID id;
+    REQUIRE(Illuminant::find("D50", id));
+    REQUIRE(id == Illuminant::ID::D50);
+    REQUIRE(!Illuminant::find("D75", id));
+    checker::Patch patch;
+    REQUIRE(checker::find("cyan", patch));
+    REQUIRE(&checker::sRGB::get(patch) == &checker::sRGB::cyan);
+
+    // anything else is an error, whether or not assertions are enabled
+    REQUIRE_THROWS_AS(Illuminant::get(Illuminant::ID::P3),
+                      const std::out_of_range&);
+    REQUIRE_THROWS_AS(Illuminant::get(Illuminant::ID(-1)),
+                      const std::out_of_range&);
+    REQUIRE_THROWS_AS(Illuminant::get(Illuminant::ID(1000)),
+                      const std::out_of_range&);
+    REQUIRE_THROWS_AS(Illuminant::name(Illuminant::ID(1000)),
+                      const std::out_of_range&);
+    REQUIRE_THROWS_AS(CMF::get(CMF::ID(-1)), const std::out_of_range&);
+    REQUIRE_THROWS_AS(CMF::get(CMF::ID(1000)), const std::out_of_range&);
+    REQUIRE_THROWS_AS(checker::Spectrum::get(checker::Patch(24)),
+                      const std::out_of_range&);
+
+    // the daylight illuminants are normalized to 100 at 560nm, and D65
+    // derived the same way matches its table
+    for (auto d : {Illuminant::ID::D50, Illuminant::ID::D55,
+                   Illuminant::ID::D60}) {
+        REQUIRE(Illuminant::get(d).value(560.0f) == Approx(100.0f));
+    }
+    REQUIRE(Illuminant::D50.value(400.0f) == Approx(49.308f).margin(1e-3));
+
+    // white under each comes out at the illuminant's chromaticity
+    const auto& cmf = CMF::CIE_1931_2degree;
+    auto xyz = spd_to_xyz(Illuminant::D50, cmf);
+    float sum = xyz.x + xyz.y + xyz.z;
+    REQUIRE(xyz.x / sum == Approx(0.3457f).margin(2e-4));
+    REQUIRE(xyz.y / sum == Approx(0.3585f).margin(2e-4));
+    xyz = spd_to_xyz(Illuminant::E, cmf);
+    sum = xyz.x + xyz.y + xyz.z;
+    REQUIRE(xyz.x / sum == Approx(1.0f / 3.0f).margin(2e-4));
+}
+
+TEST_CASE("Spectra can be added at run time", "[spd]") {
+    using color::CMF;
+    using color::Illuminant;
+    color::SPD flat(380.0f, 790.0f, 10.0f, 50.0f);
+    const Illuminant::ID id = Illuminant::add("flat_50", flat);
+    REQUIRE(int(id) >= Illuminant::num_builtin);
+    REQUIRE(flat == Illuminant::get(id));
+    REQUIRE(std::string(Illuminant::name(id)) == "flat_50");
+    Illuminant::ID found;
+    REQUIRE(Illuminant::find("flat_50", found));
+    REQUIRE(found == id);
+
+    // enough to need several segments, looked up while being added
+    const color::SPD* first = &Illuminant::get(id);
+    std::atomic<bool> reading{true};
+    std::atomic<bool> ok{true};
+    std::thread reader([&]() {
+        while (reading) {
+            ok = ok && &Illuminant::get(id) == first &&
+                 Illuminant::get(id).value(500.0f) == 50.0f;
+        }
+    });
+    std::vector<Illuminant::ID> ids;
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(Illuminant::add(fmt::format("added_{}", i),
+                                      color::SPD(380.0f, 790.0f, 10.0f,
+                                                 float(i))));
+    }
+    reading = false;
+    reader.join();
+    REQUIRE(ok);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(Illuminant::get(ids[i]).value(500.0f) == float(i));
+    }
+
+    const auto& cie = CMF::CIE_1931_2degree;
+    const CMF& cmf =
+        CMF::get(CMF::add("copy_1931", cie.x_bar, cie.y_bar, cie.z_bar));
+    REQUIRE(&cmf.x_bar != &cie.x_bar);
+    REQUIRE(spd_to_xyz(flat, cmf).y == spd_to_xyz(flat, cie).y);
+}
+
+TEST_CASE("FixedSPD matches SPD", "[spd]") {
+    using Visible = color::FixedSPD<380, 785, 5>;
+    static_assert(Visible::num_samples() == 81, "");
+    static_assert(Visible::wavelength(80) == 780.0f, "");
+
+    const auto& cs = color::ColorSpaceRGB::ITUR_sRGB;
+    color::FixedCMF<380, 785, 5> cmf(cs.cmf);
+    Visible d65(color::Illuminant::D65);
+
+    // a flat 50% reflector should come out at half the luminance of white
+    Visible grey(0.5f);
+    auto xyz = spd_to_xyz(grey, cmf, d65);
+    REQUIRE(xyz.y == Approx(0.5f));
+
+    auto xyz_ref = spd_to_xyz(grey.to_spd(), cs.cmf, color::Illuminant::D65);
+    REQUIRE(xyz.x == Approx(xyz_ref.x).epsilon(0.01));
+    REQUIRE(xyz.y == Approx(xyz_ref.y).epsilon(0.01));
+    REQUIRE(xyz.z == Approx(xyz_ref.z).epsilon(0.01));
+}
+
+TEST_CASE("SPDArray stores spectra on a shared grid", "[spd]") {
+    using namespace color::ColorChecker::BabelAverage;
+    color::SPDArray spectra(3, 380.0f, 740.0f, 10.0f);
+    REQUIRE(spectra.num_samples() == Spectrum::dark_skin.num_samples());
+    REQUIRE(spectra.stride() % (color::simd_alignment / sizeof(float)) == 0);
+
+    spectra.set(0, Spectrum::dark_skin);
+    spectra.set(1, Spectrum::foliage);
+    spectra.set(2, Spectrum::cyan);
+    for (size_t i = 0; i < spectra.size(); ++i) {
+        REQUIRE(uintptr_t(spectra[i]) % color::simd_alignment == 0);
+    }
+
+    auto foliage = spectra.to_spd(1);
+    REQUIRE(foliage == Spectrum::foliage);
+    REQUIRE(spectra.view(2).values[5] == Spectrum::cyan.data()[5]);
+}
+
+TEST_CASE("Spectral responses are cached per grid", "[spd]") {
+    const auto& cmf = color::CMF::CIE_1931_2degree;
+    const auto& d65 = color::Illuminant::D65;
+    color::WavelengthGrid grid(380.0f, 10.0f, 36);
+
+    auto a = color::xyz_response(grid, cmf, d65);
+    auto b = color::xyz_response(grid, cmf, d65);
+    REQUIRE(a == b);
+    REQUIRE(a != color::xyz_response(color::WavelengthGrid(380.0f, 5.0f, 72),
+                                     cmf, d65));
+    color::clear_spectral_response_cache();
+    REQUIRE(a != color::xyz_response(grid, cmf, d65));
+
+    // a perfect reflector comes out at Y = 1
+    std::vector<float> ones(grid.size, 1.0f);
+    REQUIRE(a->apply(ones.data()).y == Approx(1.0f));
+
+    // a spectrum at the address of one used before gets its own response
+    std::vector<float> values(grid.size);
+    for (size_t i = 0; i < grid.size; ++i) {
+        values[i] = float(i) / float(grid.size);
+    }
+    color::SPD ramp(380.0f, 740.0f, 10.0f, std::move(values));
+    color::SPD illuminant = d65;
+    const float y_d65 = spd_to_xyz(ramp, cmf, illuminant).y;
+    illuminant = color::SPD(380.0f, 740.0f, 10.0f, 1.0f);
+    const float y_flat = spd_to_xyz(ramp, cmf, illuminant).y;
+    REQUIRE(y_flat != Approx(y_d65));
+    color::clear_spectral_response_cache();
+    REQUIRE(y_flat == spd_to_xyz(ramp, cmf, illuminant).y);
+
+    // copies share a response until either is modified
+    color::SPD copy = illuminant;
+    REQUIRE(copy.revision() == illuminant.revision());
+    REQUIRE(color::xyz_response(grid, cmf, copy) ==
+            color::xyz_response(grid, cmf, illuminant));
+    copy.interpolate_from(d65);
+    REQUIRE(copy.revision() != illuminant.revision());
+    REQUIRE(spd_to_xyz(ramp, cmf, copy).y == Approx(y_d65));
+}
+
+TEST_CASE("spd_to_rgb matches going through XYZ", "[spd]") {
+    const auto& cs = color::ColorSpaceRGB::ITUR_BT709_linear;
+    using namespace color::ColorChecker::BabelAverage;
+    for (int i = 0; i < num_patches; ++i) {
+        const color::SPD& spd = Spectrum::get(Patch(i));
+        auto xyz = spd_to_xyz(spd, cs.cmf, color::Illuminant::D65);
+        auto expected = xyz_to_rgb(xyz, cs);
+        auto rgb = spd_to_rgb(spd, cs);
+        REQUIRE(rgb.r == Approx(expected.r).margin(1e-6));
+        REQUIRE(rgb.g == Approx(expected.g).margin(1e-6));
+        REQUIRE(rgb.b == Approx(expected.b).margin(1e-6));
+    }
+
+    // spaces are told apart by value, not address
+    const color::SPD& foliage = Spectrum::foliage;
+    color::ColorSpaceRGB changed = cs;
+    const auto before = spd_to_rgb(foliage, changed);
+    changed.m_xyz_to_rgb =
+        color::M33f(2.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f) *
+        cs.m_xyz_to_rgb;
+    const auto after = spd_to_rgb(foliage, changed);
+    REQUIRE(after.r == Approx(2.0f * before.r));
+    REQUIRE(after.g == Approx(2.0f * before.g));
+    REQUIRE(after.b == Approx(2.0f * before.b));
+}
+
+TEST_CASE("Batch spd_to_rgb matches single conversions", "[spd]") {
+    using namespace color::ColorChecker::BabelAverage;
+    const auto& cs = color::ColorSpaceRGB::ITUR_sRGB;
+
+    // enough copies of the checker to split across several tasks
+    std::vector<const color::SPD*> patches;
+    for (int i = 0; i < num_patches; ++i) {
+        patches.push_back(&Spectrum::get(Patch(i)));
+    }
+    const size_t count = 5000;
+    color::SPDArray spectra(count, *patches[0]);
+    for (size_t i = 0; i < count; ++i) {
+        spectra.set(i, *patches[i % patches.size()]);
+    }
+
+    std::vector<color::RGBf32> rgb(count);
+    std::vector<color::XYZ> xyz(count);
+    spd_to_rgb(spectra, cs, rgb.data());
+    spd_to_xyz(spectra, cs.cmf, color::Illuminant::D65, xyz.data());
+    for (size_t i = 0; i < count; ++i) {
+        const auto& spd = *patches[i % patches.size()];
+        auto expected = spd_to_rgb(spd, cs);
+        REQUIRE(rgb[i].r == Approx(expected.r));
+        REQUIRE(rgb[i].g == Approx(expected.g));
+        REQUIRE(rgb[i].b == Approx(expected.b));
+        REQUIRE(xyz[i].y ==
+                Approx(spd_to_xyz(spd, cs.cmf, color::Illuminant::D65).y));
+    }
+}
+
+TEST_CASE("Transfer functions are recognised as known curves", "[transfer]") {
+    using Curve = color::TransferFunction::Curve;
+    const auto& srgb = color::ColorSpaceRGB::ITUR_sRGB;
+    REQUIRE(srgb.oetf.curve() == Curve::sRGB_OETF);
+    REQUIRE(srgb.eotf.curve() == Curve::sRGB_EOTF);
+    REQUIRE(color::ColorSpaceRGB::ITUR_BT709.oetf.curve() == Curve::Rec709_OETF);
+    REQUIRE(color::ColorSpaceRGB::ITUR_BT709_linear.oetf.is_linear());
+
+    color::TransferFunction halve(color::TransferFunction::Callback(
+        [](color::RGBf32 c) { return c * color::RGBf32(0.5f); }));
+    REQUIRE(halve.curve() == Curve::Custom);
+    REQUIRE(halve(color::RGBf32(1.0f)).g == 0.5f);
+
+    // batches give the same results as single colours
+    std::vector<color::RGBf32> c;
+    for (int i = 0; i <= 100; ++i) {
+        c.push_back(color::RGBf32(i / 100.0f, i / 200.0f, i / 400.0f));
+    }
+    for (auto tf : {srgb.oetf, srgb.eotf, color::TransferFunction::gamma(2.2f),
+                    halve}) {
+        auto batch = c;
+        tf.apply(batch.data(), batch.size());
+        for (size_t i = 0; i < c.size(); ++i) {
+            REQUIRE(batch[i] == tf(c[i]));
+        }
+    }
+}
+
+TEST_CASE("Image conversions match per-pixel conversions", "[image]") {
+    const auto& cs = color::ColorSpaceRGB::ITUR_sRGB;
+    const size_t w = 301, h = 5;
+
+    // interleaved RGBA XYZ in, planar RGB out
+    std::vector<float> xyza(w * h * 4);
+    for (size_t i = 0; i < xyza.size(); ++i) {
+        xyza[i] = float((i * 7919) % 1000) / 1000.0f;
+    }
+    std::vector<float> r(w * h), g(w * h), b(w * h);
+    auto src = color::ImageView<float>::interleaved(xyza.data(), w, h, 4);
+    auto dst = color::ImageView<float>::planar(r.data(), g.data(), b.data(),
+                                               w, h);
+    color::xyz_to_rgb(src, dst, cs);
+
+    for (size_t i = 0; i < w * h; ++i) {
+        color::XYZ xyz(xyza[4 * i], xyza[4 * i + 1], xyza[4 * i + 2]);
+        auto expected = xyz_to_rgb(xyz, cs);
+        REQUIRE(r[i] == Approx(expected.r));
+        REQUIRE(g[i] == Approx(expected.g));
+        REQUIRE(b[i] == Approx(expected.b));
+    }
+
+    // and back again, in place through half floats with a padded stride
+    std::vector<color::f16> half(w * h * 4, color::f16(-1.0f));
+    auto h_view = color::ImageView<color::f16>::interleaved(half.data(), w, h,
+                                                             4);
+    color::rgb_to_xyz(dst, h_view, cs);
+    color::rgb_to_xyz(h_view, h_view, color::ColorSpaceRGB::ITUR_BT709_linear);
+    color::xyz_to_rgb(h_view, h_view, color::ColorSpaceRGB::ITUR_BT709_linear);
+    for (size_t i = 0; i < w * h; ++i) {
+        REQUIRE(float(half[4 * i + 1]) == Approx(xyza[4 * i + 1]).margin(2e-3));
+        REQUIRE(float(half[4 * i + 3]) == -1.0f);
+    }
+}
+
+TEST_CASE("Colour space matrices are derived in double precision",
+          "[color_space]") {
+    // the BT.709 primaries under D65, at compile time
+    constexpr auto xyz_to_rgb = color::detail::xyz_to_rgb_matrix(
+        0.64, 0.33, 0.30, 0.60, 0.15, 0.06, 0.3128, 0.3290);
+    constexpr auto rgb_to_xyz = color::detail::inverse(xyz_to_rgb);
+    static_assert(rgb_to_xyz.m[1][0] + rgb_to_xyz.m[1][1] +
+                          rgb_to_xyz.m[1][2] >
+                      1.0 - 1e-12,
+                  "white has a luminance of 1");
+
+    const auto& srgb = color::ColorSpaceRGB::ITUR_sRGB;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            // the built-in matrices are these, rounded once
+            REQUIRE(srgb.m_xyz_to_rgb[i][j] == float(xyz_to_rgb.m[i][j]));
+            REQUIRE(srgb.m_rgb_to_xyz[i][j] == float(rgb_to_xyz.m[i][j]));
+            float product = 0.0f;
+            for (int k = 0; k < 3; ++k) {
+                product += srgb.m_xyz_to_rgb[i][k] * srgb.m_rgb_to_xyz[k][j];
+            }
+            REQUIRE(product == Approx(i == j ? 1.0f : 0.0f).margin(1e-6));
+        }
+    }
+
+    // spaces made at run time agree, to the rounding of their chromaticities
+    // to single precision
+    color::ColorSpaceRGB runtime("BT.709",
+                                 color::ColorSpaceRGB::Primaries::itur_bt709,
+                                 color::ColorSpaceRGB::WhitePoint::D65);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            REQUIRE(runtime.m_xyz_to_rgb[i][j] ==
+                    Approx(srgb.m_xyz_to_rgb[i][j]).margin(1e-6));
+            REQUIRE(runtime.m_rgb_to_xyz[i][j] ==
+                    Approx(srgb.m_rgb_to_xyz[i][j]).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("RGB to RGB conversions fuse the matrices", "[color_space]") {
+    const auto& srgb = color::ColorSpaceRGB::ITUR_sRGB;
+    const auto& bt709 = color::ColorSpaceRGB::ITUR_BT709;
+    const auto& linear = color::ColorSpaceRGB::ITUR_BT709_linear;
+
+    const auto same = color::ColorSpaceConversion::get(srgb, srgb);
+    REQUIRE(same->is_identity());
+    REQUIRE(same == color::ColorSpaceConversion::get(srgb, srgb));
+    REQUIRE(color::ColorSpaceConversion::get(linear, linear)->is_identity());
+
+    const auto conversion = *color::ColorSpaceConversion::get(srgb, bt709);
+    REQUIRE(conversion.is_matrix_identity());
+    REQUIRE(!conversion.is_identity());
+
+    std::vector<color::RGBf32> c;
+    for (int i = 0; i <= 50; ++i) {
+        c.push_back(color::RGBf32(i / 50.0f, 1.0f - i / 50.0f, i / 100.0f));
+    }
+    auto batch = c;
+    conversion.apply(batch.data(), batch.size());
+    for (size_t i = 0; i < c.size(); ++i) {
+        auto expected = xyz_to_rgb(rgb_to_xyz(c[i], srgb), bt709);
+        auto rgb = color::rgb_to_rgb(c[i], srgb, bt709);
+        REQUIRE(rgb.r == Approx(expected.r).margin(1e-5));
+        REQUIRE(rgb.g == Approx(expected.g).margin(1e-5));
+        REQUIRE(rgb.b == Approx(expected.b).margin(1e-5));
+        REQUIRE(batch[i] == rgb);
+    }
+
+    auto view = color::ImageView<float>::interleaved(&c[0].r, c.size(), 1);
+    color::rgb_to_rgb(view, view, srgb, bt709);
+    for (size_t i = 0; i < c.size(); ++i) {
+        REQUIRE(c[i] == batch[i]);
+    }
+
+    // conversions are shared by value, so short-lived spaces at the same
+    // address don't get each other's
+    using Primaries = color::ColorSpaceRGB::Primaries;
+    const Primaries& p = Primaries::itur_bt709;
+    for (float red_x : {p.red.x, p.red.x - 0.01f}) {
+        const color::ColorSpaceRGB moved(
+            "moved red", Primaries({red_x, p.red.y}, p.green, p.blue),
+            linear.white_point);
+        auto expected = xyz_to_rgb(
+            rgb_to_xyz(color::RGBf32(1.0f, 0.0f, 0.0f), moved), linear);
+        auto rgb = color::rgb_to_rgb(color::RGBf32(1.0f, 0.0f, 0.0f), moved,
+                                     linear);
+        REQUIRE(rgb.r == Approx(expected.r).margin(1e-5));
+        REQUIRE(rgb.g == Approx(expected.g).margin(1e-5));
+        REQUIRE(rgb.b == Approx(expected.b).margin(1e-5));
+    }
+
+    // custom curves can't be told apart, so aren't shared
+    color::TransferFunction::Callback halve = [](color::RGBf32 v) {
+        return color::RGBf32(v.r * 0.5f, v.g * 0.5f, v.b * 0.5f);
+    };
+    const color::ColorSpaceRGB custom("custom", p, linear.white_point,
+                                      color::TransferFunction(halve),
+                                      color::TransferFunction(halve));
+    REQUIRE(color::ColorSpaceConversion::get(custom, linear) !=
+            color::ColorSpaceConversion::get(custom, linear));
+}
+
+TEST_CASE("Chromatic adaptation is folded into conversions", "[color_space]") {
+    using color::ChromaticAdaptation;
+    const auto& d65 = color::ColorSpaceRGB::WhitePoint::D65;
+    const auto& d50 = color::ColorSpaceRGB::WhitePoint::D50;
+
+    // Bradford D65 to D50 as published by Lindbloom
+    const float expected[3][3] = {{1.0478f, 0.0229f, -0.0501f},
+                                  {0.0295f, 0.9905f, -0.0170f},
+                                  {-0.0092f, 0.0150f, 0.7521f}};
+    const auto m = color::chromatic_adaptation_matrix(
+        d65.xy, d50.xy, ChromaticAdaptation::Bradford);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            REQUIRE(m[r][c] == Approx(expected[r][c]).margin(1e-3));
+        }
+    }
+
+    for (auto method : {ChromaticAdaptation::VonKries,
+                        ChromaticAdaptation::Bradford, ChromaticAdaptation::CAT02,
+                        ChromaticAdaptation::CAT16}) {
+        auto w = color::xy_to_xyz(d50.xy);
+        const auto a =
+            color::chromatic_adaptation_matrix(d50.xy, d65.xy, method);
+        color::V3f adapted(a[0][0] * w.x + a[0][1] * w.y + a[0][2] * w.z,
+                           a[1][0] * w.x + a[1][1] * w.y + a[1][2] * w.z,
+                           a[2][0] * w.x + a[2][1] * w.y + a[2][2] * w.z);
+        auto d65_white = color::xy_to_xyz(d65.xy);
+        REQUIRE(adapted.x == Approx(d65_white.x).margin(1e-5));
+        REQUIRE(adapted.y == Approx(d65_white.y).margin(1e-5));
+        REQUIRE(adapted.z == Approx(d65_white.z).margin(1e-5));
+    }
+
+    // white in a D50 space lands on white in sRGB when adapted
+    const color::ColorSpaceRGB d50_linear(
+        "BT.709 (D50)", color::ColorSpaceRGB::Primaries::itur_bt709, d50);
+    const auto& linear = color::ColorSpaceRGB::ITUR_BT709_linear;
+    const auto adapted = color::ColorSpaceConversion::get(
+        d50_linear, linear, ChromaticAdaptation::Bradford);
+    REQUIRE(adapted != color::ColorSpaceConversion::get(d50_linear, linear));
+    const auto& conversion = *adapted;
+    auto rgb = conversion(color::RGBf32(1.0f, 1.0f, 1.0f));
+    REQUIRE(rgb.r == Approx(1.0f).margin(1e-5));
+    REQUIRE(rgb.g == Approx(1.0f).margin(1e-5));
+    REQUIRE(rgb.b == Approx(1.0f).margin(1e-5));
+
+    std::vector<float> xyz = {0.9642f, 1.0f, 0.8251f};
+    auto view = color::ImageView<float>::interleaved(xyz.data(), 1, 1);
+    color::xyz_to_rgb(view, view, linear, d50.xy, ChromaticAdaptation::Bradford);
+    REQUIRE(xyz[0] == Approx(1.0f).margin(1e-3));
+    REQUIRE(xyz[1] == Approx(1.0f).margin(1e-3));
+    REQUIRE(xyz[2] == Approx(1.0f).margin(1e-3));
+
+    // spaces built in turn at the same address get their own matrices
+    for (const auto* white : {&d65, &d50}) {
+        const color::ColorSpaceRGB space(
+            "BT.709", color::ColorSpaceRGB::Primaries::itur_bt709, *white);
+        const color::M33f m = color::xyz_to_rgb_matrix(
+            space, d50.xy, ChromaticAdaptation::Bradford);
+        const color::M33f expected =
+            space.m_xyz_to_rgb *
+            color::chromatic_adaptation_matrix(d50.xy, white->xy,
+                                               ChromaticAdaptation::Bradford);
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                REQUIRE(m[r][c] == expected[r][c]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Compiled pipelines fuse and drop stages", "[pipeline]") {
+    using Kind = color::Pipeline::Stage::Kind;
+    const auto& srgb = color::ColorSpaceRGB::ITUR_sRGB;
+    const auto& bt709 = color::ColorSpaceRGB::ITUR_BT709;
+
+    // decode, two matrices and an exposure, then re-encode. the matrices
+    // and scale fuse into one and the linear round trip through XYZ cancels
+    color::Pipeline p;
+    p.rgb_to_xyz(srgb)
+        .xyz_to_rgb(srgb, true)
+        .scale(2.0f)
+        .clamp(0.0f, 4.0f)
+        .clamp(-1.0f, 1.0f)
+        .transfer(srgb.oetf)
+        .transfer(srgb.eotf)
+        .transfer(bt709.oetf);
+    auto compiled = p.compile();
+    REQUIRE(compiled.size() == 4);
+    REQUIRE(compiled[0].kind == Kind::Transfer);
+    REQUIRE(compiled[1].kind == Kind::Scale);
+    REQUIRE(compiled[1].scale.x == Approx(2.0f));
+    REQUIRE(compiled[2].kind == Kind::Clamp);
+    REQUIRE(compiled[2].lo == 0.0f);
+    REQUIRE(compiled[2].hi == 1.0f);
+    REQUIRE(compiled[3].kind == Kind::Transfer);
+
+    REQUIRE(color::Pipeline()
+                .transfer(srgb.eotf)
+                .transfer(srgb.oetf)
+                .matrix(color::M33f())
+                .compile()
+                .empty());
+
+    std::vector<color::RGBf32> c;
+    for (int i = 0; i <= 300; ++i) {
+        c.push_back(color::RGBf32(i / 300.0f, 1.0f - i / 300.0f, i / 600.0f));
+    }
+    auto batch = c;
+    compiled.apply(batch.data(), batch.size());
+    for (size_t i = 0; i < c.size(); ++i) {
+        auto expected = p(c[i]);
+        REQUIRE(batch[i].r == Approx(expected.r).margin(1e-5));
+        REQUIRE(batch[i].g == Approx(expected.g).margin(1e-5));
+        REQUIRE(batch[i].b == Approx(expected.b).margin(1e-5));
+    }
+
+    std::vector<float> table = {0.0f, 0.25f, 1.0f};
+    color::Pipeline lut;
+    lut.lut(color::Lut1D(table)).scale(color::V3f(1.0f, 0.5f, 2.0f));
+    auto image = c;
+    auto view = color::ImageView<float>::interleaved(&image[0].r, 100, 3);
+    lut.compile().apply(view, view);
+    for (size_t i = 0; i < 300; ++i) {
+        auto expected = lut(c[i]);
+        REQUIRE(image[i].r == Approx(expected.r).margin(1e-6));
+        REQUIRE(image[i].g == Approx(expected.g).margin(1e-6));
+        REQUIRE(image[i].b == Approx(expected.b).margin(1e-6));
+    }
+}
+
+TEST_CASE("3D LUTs approximate the baked pipeline", "[lut]") {
+    using color::LutInterpolation;
+    const auto& srgb = color::ColorSpaceRGB::ITUR_sRGB;
+    const auto& bt709 = color::ColorSpaceRGB::ITUR_BT709;
+
+    color::Pipeline p;
+    p.convert(*color::ColorSpaceConversion::get(bt709, srgb));
+
+    // lattice points are reproduced exactly by both kernels
+    color::Lut3D lut(p, 17);
+    REQUIRE(lut.bytes() == 17 * 17 * 17 * 3 * sizeof(float) + 2 * sizeof(float));
+    for (auto interpolation :
+         {LutInterpolation::Trilinear, LutInterpolation::Tetrahedral}) {
+        for (int i = 0; i < 17; i += 4) {
+            color::RGBf32 c(i / 16.0f, (16 - i) / 16.0f, 0.5f);
+            auto expected = p(c);
+            auto v = lut(c, interpolation);
+            REQUIRE(v.r == Approx(expected.r).margin(1e-5));
+            REQUIRE(v.g == Approx(expected.g).margin(1e-5));
+            REQUIRE(v.b == Approx(expected.b).margin(1e-5));
+        }
+    }
+
+    auto report = color::lut_accuracy_report(p, {9, 33});
+    REQUIRE(report.size() == 4);
+    REQUIRE(report[2].max_error < report[0].max_error);
+    REQUIRE(report[3].max_error < 5e-3f);
+    REQUIRE(report[3].mean_error < 5e-4f);
+
+    // scene-linear inputs up to 16 through a perceptual shaper
+    color::Pipeline hdr;
+    hdr.scale(0.25f).transfer(srgb.oetf);
+    color::Lut3D shaped(hdr, 33, srgb.oetf, 16.0f);
+    auto accuracy = color::measure_accuracy(shaped, hdr, 16.0f,
+                                            LutInterpolation::Tetrahedral);
+    REQUIRE(accuracy.max_error < 2e-3f);
+
+    std::vector<color::RGBf32> c;
+    for (int i = 0; i < 300; ++i) {
+        c.push_back(color::RGBf32(i / 300.0f, 1.0f - i / 300.0f, i / 600.0f));
+    }
+    auto image = c;
+    auto view = color::ImageView<float>::interleaved(&image[0].r, 100, 3);
+    lut.apply(view, view);
+    for (size_t i = 0; i < c.size(); ++i) {
+        REQUIRE(image[i] == lut(c[i]));
+    }
+}
+
+TEST_CASE("Approximate transfer functions are within their bounds",
+          "[transfer]") {
+    using color::Accuracy;
+    using Curve = color::TransferFunction::Curve;
+
+    // every finite half, and every u16 code value
+    std::vector<float> inputs;
+    for (int i = 0; i < 65536; ++i) {
+        color::f16 h;
+        h.setBits(color::u16(i));
+        if (h.isFinite()) {
+            inputs.push_back(float(h));
+        }
+        inputs.push_back(i / 65535.0f);
+    }
+
+    for (auto curve : {Curve::sRGB_OETF, Curve::sRGB_EOTF, Curve::Rec709_OETF,
+                       Curve::Rec709_EOTF}) {
+        color::TransferFunction tf(curve);
+        auto exact = inputs;
+        tf.apply(exact.data(), exact.size());
+        for (auto accuracy : {Accuracy::U16, Accuracy::U8}) {
+            const float bound =
+                0.5f / (accuracy == Accuracy::U16 ? 65535.0f : 255.0f);
+            auto approx = inputs;
+            tf.apply(approx.data(), approx.size(), accuracy);
+            float worst = 0.0f;
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                float e = std::abs(approx[i] - exact[i]) /
+                          std::max(1.0f, std::abs(exact[i]));
+                worst = std::max(worst, e);
+            }
+            INFO("curve " << int(curve) << ", accuracy " << int(accuracy));
+            REQUIRE(worst < bound);
+        }
+    }
+
+    float special[] = {std::numeric_limits<float>::infinity(),
+                       std::numeric_limits<float>::quiet_NaN()};
+    color::TransferFunction(Curve::sRGB_OETF)
+        .apply(special, 2, Accuracy::U16);
+    REQUIRE(special[0] == std::numeric_limits<float>::infinity());
+    REQUIRE(std::isnan(special[1]));
+}
+
+TEST_CASE("16-bit inputs are decoded through tables", "[transfer]") {
+    using Curve = color::TransferFunction::Curve;
+    color::TransferFunction srgb(Curve::sRGB_EOTF);
+    REQUIRE(srgb.table_f16() != nullptr);
+    REQUIRE(srgb.table_f16() == color::TransferFunction(Curve::sRGB_EOTF)
+                                    .table_f16());
+    REQUIRE(color::TransferFunction::gamma(2.2f).table_u16() == nullptr);
+
+    std::vector<color::RGBf16> half;
+    std::vector<color::RGBu16> code;
+    for (int i = 0; i < 1000; ++i) {
+        half.push_back(color::RGBf16(color::f16(i / 999.0f),
+                                     color::f16(1.0f - i / 999.0f),
+                                     color::f16(i / 500.0f)));
+        code.push_back(color::RGBu16(color::u16(i * 65), color::u16(i * 3),
+                                     color::u16(65535 - i * 65)));
+    }
+
+    const auto conversion = *color::ColorSpaceConversion::get(
+        color::ColorSpaceRGB::ITUR_sRGB, color::ColorSpaceRGB::ITUR_BT709);
+    std::vector<color::RGBf32> from_half(half.size());
+    std::vector<color::RGBf32> from_code(code.size());
+    conversion.apply(half.data(), from_half.data(), half.size());
+    conversion.apply(code.data(), from_code.data(), code.size());
+    for (size_t i = 0; i < half.size(); ++i) {
+        REQUIRE(from_half[i] == conversion(color::RGBf32(half[i])));
+        color::RGBf32 c(code[i].r / 65535.0f, code[i].g / 65535.0f,
+                        code[i].b / 65535.0f);
+        auto expected = conversion(c);
+        REQUIRE(from_code[i].r == Approx(expected.r).margin(1e-6));
+        REQUIRE(from_code[i].g == Approx(expected.g).margin(1e-6));
+        REQUIRE(from_code[i].b == Approx(expected.b).margin(1e-6));
+    }
+
+    // images take the same path
+    std::vector<float> xyz(code.size() * 3);
+    auto src = color::ImageView<color::u16>::interleaved(&code[0].r, 100, 10);
+    auto dst = color::ImageView<float>::interleaved(xyz.data(), 100, 10);
+    color::rgb_to_xyz(src, dst, color::ColorSpaceRGB::ITUR_sRGB);
+    for (size_t i = 0; i < code.size(); ++i) {
+        color::RGBf32 c(code[i].r / 65535.0f, code[i].g / 65535.0f,
+                        code[i].b / 65535.0f);
+        auto expected = rgb_to_xyz(c, color::ColorSpaceRGB::ITUR_sRGB);
+        REQUIRE(xyz[3 * i + 0] == Approx(expected.x).margin(1e-6));
+        REQUIRE(xyz[3 * i + 1] == Approx(expected.y).margin(1e-6));
+        REQUIRE(xyz[3 * i + 2] == Approx(expected.z).margin(1e-6));
+    }
+}
+
+TEST_CASE("8-bit decode and quantize round trip", "[quantize]") {
+    using Curve = color::TransferFunction::Curve;
+    color::TransferFunction eotf(Curve::sRGB_EOTF);
+    const float* table = eotf.table_u8();
+    REQUIRE(table != nullptr);
+    for (int i = 0; i < 256; ++i) {
+        REQUIRE(table[i] == color::EOTF::sRGBf(i / 255.0f));
+    }
+
+    // quantize matches rgb_cast, including halfway cases, out of range
+    // values and NaN, in both the vector loop and the tail
+    std::vector<float> v;
+    for (int i = -10; i < 2600; ++i) {
+        v.push_back(i / 2550.0f);
+        v.push_back((i + 0.5f) / 255.0f);
+    }
+    v.push_back(NAN);
+    v.push_back(HUGE_VALF);
+    v.push_back(-HUGE_VALF);
+    std::vector<color::u8> q8(v.size());
+    std::vector<color::u16> q16(v.size());
+    color::quantize(v.data(), q8.data(), v.size());
+    color::quantize(v.data(), q16.data(), v.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        color::RGBf32 c(v[i], 0.0f, 0.0f);
+        REQUIRE(q8[i] == color::rgb_cast<color::u8>(c).r);
+        REQUIRE(q16[i] == color::rgb_cast<color::u16>(c).r);
+    }
+
+    // every code value survives decoding and re-encoding
+    std::vector<color::RGBu8> code;
+    for (int i = 0; i < 256; ++i) {
+        code.push_back(color::RGBu8(color::u8(i), color::u8(255 - i),
+                                    color::u8(i / 2)));
+    }
+    std::vector<color::RGBf32> linear(code.size());
+    eotf.apply(code.data(), linear.data(), code.size());
+    std::vector<color::RGBu8> encoded(code.size());
+    color::quantize(linear.data(), encoded.data(), linear.size(),
+                    color::TransferFunction(Curve::sRGB_OETF),
+                    color::Accuracy::U8);
+    for (size_t i = 0; i < code.size(); ++i) {
+        REQUIRE(encoded[i] == code[i]);
+    }
+
+    // 8-bit images round trip through a pipeline too
+    std::vector<color::RGBu8> out(code.size());
+    auto src = color::ImageView<color::u8>::interleaved(&code[0].r, 64, 4);
+    auto dst = color::ImageView<color::u8>::interleaved(&out[0].r, 64, 4);
+    color::Pipeline()
+        .transfer(eotf)
+        .scale(2.0f)
+        .scale(0.5f)
+        .transfer(eotf.inverse())
+        .apply(src, dst);
+    for (size_t i = 0; i < code.size(); ++i) {
+        REQUIRE(out[i] == code[i]);
+    }
+}
+
+TEST_CASE("Dithered quantization preserves the mean", "[quantize]") {
+    REQUIRE(color::dither_mask(color::Dither::None) == nullptr);
+    for (auto dither : {color::Dither::Ordered, color::Dither::BlueNoise}) {
+        const float* mask = color::dither_mask(dither);
+        REQUIRE(mask == color::dither_mask(dither));
+        const size_t size = color::k_dither_size * color::k_dither_size;
+        std::vector<float> sorted(mask, mask + size);
+        std::sort(sorted.begin(), sorted.end());
+        REQUIRE(sorted.front() > -0.5f);
+        REQUIRE(sorted.back() < 0.5f);
+        if (dither == color::Dither::BlueNoise) {
+            // every pixel has its own rank
+            REQUIRE(std::adjacent_find(sorted.begin(), sorted.end()) ==
+                    sorted.end());
+        }
+
+        // a flat field halfway between two codes averages out to it, where
+        // rounding alone puts every pixel on the upper code
+        const size_t width = 3 * color::k_dither_size + 5;
+        const size_t height = color::k_dither_size;
+        std::vector<color::RGBf32> flat(width * height,
+                                        color::RGBf32(76.5f / 255.0f));
+        std::vector<color::RGBu8> out(flat.size());
+        color::quantize(flat.data(), out.data(), width, height, dither);
+        double sum = 0.0;
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < 3 * color::k_dither_size; ++x) {
+                const auto& c = out[y * width + x];
+                REQUIRE(c.r == c.g);
+                REQUIRE(c.g == c.b);
+                sum += c.r;
+            }
+        }
+        REQUIRE(sum / (3 * color::k_dither_size * height) ==
+                Approx(76.5).margin(1e-3));
+
+        // colours already on a code value are left alone
+        std::vector<color::RGBu8> code(width * height);
+        for (size_t i = 0; i < code.size(); ++i) {
+            code[i] = color::RGBu8(color::u8(i), color::u8(i * 7),
+                                   color::u8(i * 13));
+        }
+        std::vector<color::RGBu8> requantized(code.size());
+        auto src = color::ImageView<color::u8>::interleaved(&code[0].r, width,
+                                                            height);
+        auto dst = color::ImageView<color::u8>::interleaved(
+            &requantized[0].r, width, height);
+        color::Pipeline().scale(0.5f).scale(2.0f).apply(src, dst, dither);
+        for (size_t i = 0; i < code.size(); ++i) {
+            REQUIRE(requantized[i] == code[i]);
+        }
+    }
+}
+
+TEST_CASE("RGBx lanes match per-colour arithmetic", "[rgbx]") {
+    using color::RGBf32;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<RGBf32> c(21);
+    for (size_t i = 0; i < c.size(); ++i) {
+        c[i] = RGBf32(0.1f * i - 0.5f, 0.37f * i, 1.5f - 0.11f * i);
+    }
+    c[3].g = nan;
+    c[9].b = inf;
+    c[10].r = -inf;
+    const color::M33f m(0.4124f, 0.3576f, 0.1805f, 0.2126f, 0.7152f, 0.0722f,
+                        0.0193f, 0.1192f, 0.9505f);
+    auto same = [](float a, float b) {
+        return (std::isnan(a) && std::isnan(b)) || a == b;
+    };
+
+    // whole batches and a zero padded tail
+    for (size_t i = 0; i < c.size(); i += color::RGBx8::size) {
+        const size_t n = std::min(size_t(color::RGBx8::size), c.size() - i);
+        const auto x = color::RGBx8::load(&c[i], n);
+        const auto sum = x + x * x;
+        const auto clamped = clamp(x, color::RGBx8(0.0f), color::RGBx8(1.0f));
+        const auto lo = hmin(x), hi = hmax(x);
+        const auto real = is_real(x);
+        const auto t = transform(m, x);
+
+        std::vector<RGBf32> out(color::RGBx8::size, RGBf32(-1.0f));
+        x.store(out.data(), n);
+        for (size_t j = 0; j < n; ++j) {
+            const RGBf32& e = c[i + j];
+            REQUIRE(std::memcmp(&out[j], &e, sizeof(e)) == 0);
+            REQUIRE(same(sum[j].r, (e + e * e).r));
+            REQUIRE(same(sum[j].b, (e + e * e).b));
+            REQUIRE(same(clamped[j].g, color::clamp(e.g, 0.0f, 1.0f)));
+            REQUIRE(same(lo[j], hmin(e)));
+            REQUIRE(same(hi[j], hmax(e)));
+            REQUIRE(bool(real[j]) == is_real(e));
+            REQUIRE(same(t[j].g, m[1][0] * e.r + m[1][1] * e.g +
+                                     m[1][2] * e.b));
+        }
+        for (size_t j = n; j < color::RGBx8::size; ++j) {
+            REQUIRE(x[j] == RGBf32(0.0f));
+            REQUIRE(out[j] == RGBf32(-1.0f));
+        }
+    }
+
+    // NaN clamps to the lower bound, as color::clamp() does
+    REQUIRE(clamp(color::f32x<4>(nan), color::f32x<4>(0.0f),
+                  color::f32x<4>(1.0f))[2] == 0.0f);
+    REQUIRE(all(color::f32x<16>(2.0f) > 1.0f));
+    REQUIRE(!any(color::f32x<16>(2.0f) < 1.0f));
+    REQUIRE(hsum(color::f32x<8>(0.5f)) == 4.0f);
+
+    // narrowing stores keep lane order
+    float values[16];
+    for (int i = 0; i < 16; ++i) {
+        values[i] = 17.0f * i;
+    }
+    const auto ramp = color::f32x<16>::load(values);
+    color::u8 u8s[16];
+    color::u16 u16s[16];
+    store_as(truncate(ramp), u8s);
+    store_as(truncate(ramp * 257.0f), u16s);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(u8s[i] == 17 * i);
+        REQUIRE(u16s[i] == 17 * 257 * i);
+    }
+}
+
+TEST_CASE("Every SIMD level gives the same results", "[simd]") {
+    using color::SimdLevel;
+    const SimdLevel initial = color::simd_level();
+    REQUIRE(color::simd_supported(SimdLevel::SSE2));
+    REQUIRE(color::simd_supported(initial));
+
+    // an odd count, so every kernel has a tail, with some values outside
+    // [0, 1] and some that aren't real
+    const size_t n = 3 * 1001;
+    std::vector<float> values(n), offsets(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = float(i % 1500) / 1200.0f - 0.1f;
+        offsets[i] = float(i % 97) / 97.0f - 0.49f;
+    }
+    values[5] = std::numeric_limits<float>::quiet_NaN();
+    values[6] = std::numeric_limits<float>::infinity();
+    values[n - 1] = -std::numeric_limits<float>::infinity();
+    const auto* colours = reinterpret_cast<const color::RGBf32*>(values.data());
+
+    std::vector<color::SPD> spectra;
+    for (int i = 0; i < color::ColorChecker::BabelAverage::num_patches; ++i) {
+        spectra.push_back(color::ColorChecker::BabelAverage::Spectrum::get(
+            color::ColorChecker::BabelAverage::Patch(i)));
+    }
+    color::SPDArray spd_array(spectra.size(), spectra[0]);
+    for (size_t i = 0; i < spectra.size(); ++i) {
+        spd_array.set(i, spectra[i]);
+    }
+
+    const color::M33f m(0.4124f, 0.3576f, 0.1805f, 0.2126f, 0.7152f, 0.0722f,
+                        0.0193f, 0.1192f, 0.9505f);
+    const auto pipeline = color::Pipeline()
+                              .matrix(m)
+                              .clamp(0.0f, 1.0f)
+                              .transfer(color::OETF::sRGB,
+                                        color::Accuracy::U16);
+
+    // everything that goes through the kernels, as bytes
+    auto run = [&]() {
+        std::vector<char> out;
+        auto append = [&](const void* p, size_t size) {
+            const char* c = static_cast<const char*>(p);
+            out.insert(out.end(), c, c + size);
+        };
+        for (auto curve : {color::OETF::sRGB, color::EOTF::sRGB,
+                           color::OETF::rec709, color::EOTF::rec709}) {
+            for (auto a : {color::Accuracy::U16, color::Accuracy::U8}) {
+                std::vector<float> v = values;
+                color::TransferFunction(curve).apply(v.data(), n, a);
+                append(v.data(), n * sizeof(float));
+            }
+        }
+        std::vector<color::u8> u8s(n);
+        std::vector<color::u16> u16s(n);
+        const float* dithers[] = {nullptr, offsets.data()};
+        for (const float* d : dithers) {
+            color::quantize(values.data(), u8s.data(), n, d);
+            color::quantize(values.data(), u16s.data(), n, d);
+            append(u8s.data(), n);
+            append(u16s.data(), n * sizeof(color::u16));
+        }
+        std::vector<color::RGBf32> c(colours, colours + n / 3);
+        color::detail::kernels().transform(m[0], c.data(), c.size());
+        append(c.data(), c.size() * sizeof(color::RGBf32));
+        c.assign(colours, colours + n / 3);
+        pipeline.apply(c.data(), c.size());
+        append(c.data(), c.size() * sizeof(color::RGBf32));
+        std::vector<color::RGBf32> rgb(spectra.size());
+        spd_to_rgb(spd_array, color::ColorSpaceRGB::ITUR_sRGB, rgb.data());
+        append(rgb.data(), rgb.size() * sizeof(color::RGBf32));
+        const auto single =
+            spd_to_rgb(spectra[0], color::ColorSpaceRGB::ITUR_sRGB);
+        append(&single, sizeof(single));
+        return out;
+    };
+
+    color::set_simd_level(SimdLevel::SSE2);
+    REQUIRE(color::simd_level() == SimdLevel::SSE2);
+    const std::vector<char> expected = run();
+    for (auto level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (!color::simd_supported(level)) {
+            continue;
+        }
+        INFO(color::to_string(level));
+        color::set_simd_level(level);
+        REQUIRE(run() == expected);
+    }
+    color::set_simd_level(initial);
+}
+
+TEST_CASE("Parallel results don't depend on the threads", "[parallel]") {
+    // every item is visited once, including by nested calls
+    for (int threads : {1, 2, 3, 8}) {
+        color::set_num_threads(threads);
+        for (size_t n : {0, 1, 7, 1000, 100003}) {
+            for (size_t grain : {1, 3, 64, 1000}) {
+                // Catch can't be called from the workers
+                std::vector<std::atomic<int>> counts(n);
+                std::atomic<bool> oversized{false};
+                color::parallel_for(n, grain, [&](size_t begin, size_t end) {
+                    oversized = oversized || end - begin > grain;
+                    for (size_t i = begin; i < end; ++i) {
+                        counts[i]++;
+                    }
+                });
+                REQUIRE(!oversized);
+                REQUIRE(std::all_of(counts.begin(), counts.end(),
+                                    [](const std::atomic<int>& c) {
+                                        return c == 1;
+                                    }));
+            }
+        }
+        std::vector<std::atomic<int>> counts(16 * 1000);
+        color::parallel_for(16, 1, [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j) {
+                color::parallel_for(1000, 7, [&](size_t b, size_t e) {
+                    for (size_t i = b; i < e; ++i) {
+                        counts[j * 1000 + i]++;
+                    }
+                });
+            }
+        });
+        REQUIRE(std::all_of(counts.begin(), counts.end(),
+                            [](const std::atomic<int>& c) { return c == 1; }));
+    }
+
+    const size_t n = 100003;
+    std::vector<color::RGBf32> colours(n);
+    for (size_t i = 0; i < n; ++i) {
+        colours[i] = color::RGBf32(float(i % 1000) / 999.0f,
+                                   float(i % 617) / 616.0f,
+                                   float(i % 89) / 88.0f);
+    }
+    std::vector<color::SPD> spectra;
+    for (int i = 0; i < color::ColorChecker::BabelAverage::num_patches; ++i) {
+        spectra.push_back(color::ColorChecker::BabelAverage::Spectrum::get(
+            color::ColorChecker::BabelAverage::Patch(i)));
+    }
+    color::SPDArray spd_array(5000, spectra[0]);
+    for (size_t i = 0; i < spd_array.size(); ++i) {
+        spd_array.set(i, spectra[i % spectra.size()]);
+    }
+    const auto conversion = *color::ColorSpaceConversion::get(
+        color::ColorSpaceRGB::ITUR_sRGB, color::ColorSpaceRGB::ITUR_BT709);
+
+    // the results, as bytes
+    auto run = [&]() {
+        std::vector<color::RGBf32> c = colours;
+        conversion.apply(c.data(), n);
+        std::vector<color::RGBu8> u8s(n);
+        color::quantize(c.data(), u8s.data(), n,
+                        color::TransferFunction(color::OETF::sRGB));
+        std::vector<color::RGBf32> rgb(spd_array.size());
+        spd_to_rgb(spd_array, color::ColorSpaceRGB::ITUR_sRGB, rgb.data());
+        std::vector<char> out;
+        auto append = [&](const void* p, size_t size) {
+            const char* b = static_cast<const char*>(p);
+            out.insert(out.end(), b, b + size);
+        };
+        append(c.data(), n * sizeof(color::RGBf32));
+        append(u8s.data(), n * sizeof(color::RGBu8));
+        append(rgb.data(), rgb.size() * sizeof(color::RGBf32));
+        return out;
+    };
+
+    color::set_num_threads(1);
+    const auto expected = run();
+    for (int threads : {2, 5, 16}) {
+        color::set_num_threads(threads);
+        REQUIRE(run() == expected);
+    }
+
+    // an executor running the chunks backwards, one at a time
+    size_t tasks = 0;
+    color::set_executor(
+        [&](size_t count, const std::function<void(size_t)>& task) {
+            for (size_t i = count; i-- > 0;) {
+                task(i);
+                ++tasks;
+            }
+        });
+    REQUIRE(run() == expected);
+    REQUIRE(tasks > 0);
+    color::set_executor(nullptr);
+    color::set_num_threads(0);
+}
+
+TEST_CASE("Exceptions thrown by parallel_for's fn reach the caller",
+          "[parallel]") {
+    auto throw_at = [](size_t at) {
+        return [at](size_t begin, size_t end) {
+            if (begin <= at && at < end) {
+                throw std::runtime_error("item " + std::to_string(at));
+            }
+        };
+    };
+    for (int threads : {1, 4}) {
+        color::set_num_threads(threads);
+        for (size_t at : {0, 500, 999}) {
+            REQUIRE_THROWS_WITH(color::parallel_for(1000, 7, throw_at(at)),
+                                "item " + std::to_string(at));
+        }
+        REQUIRE_THROWS_WITH(
+            color::parallel_for(16, 1,
+                                [&](size_t, size_t) {
+                                    color::parallel_for(100, 1, throw_at(42));
+                                }),
+            "item 42");
+
+        // and the pool still runs jobs afterwards
+        std::atomic<size_t> count{0};
+        color::parallel_for(1000, 7, [&](size_t begin, size_t end) {
+            count += end - begin;
+        });
+        REQUIRE(count == 1000);
     }
+    color::set_num_threads(0);
 }